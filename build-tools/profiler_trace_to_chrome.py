@@ -0,0 +1,141 @@
+# Copyright (c) 2026 Advanced Robotics at the University of Washington <robomstr@uw.edu>
+#
+# This file is part of Taproot.
+#
+# Taproot is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# Taproot is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with Taproot.  If not, see <https://www.gnu.org/licenses/>.
+
+
+"""
+Converts a profiler trace dumped with the `profiler trace dump` terminal command into a Chrome
+trace JSON file, which can be opened in chrome://tracing or https://ui.perfetto.dev.
+
+Usage: python3 profiler_trace_to_chrome.py <dump.txt> [<output.json>]
+
+The dump may contain other terminal output, only the lines between "profiler trace begin" and
+"profiler trace end" are used. Each execution context (thread mode or an interrupt) is shown as
+its own thread.
+"""
+
+import json
+import sys
+
+TIMESTAMP_RANGE = 1 << 32
+
+
+def parse_dump(lines):
+    """
+    Returns the timestamp frequency in Hz, a dict of profile names by key and a list of
+    (timestamp, phase, key, context) events from the dump's lines.
+    """
+    frequency = 1000000
+    names = {}
+    events = []
+    in_trace = False
+    for line in lines:
+        fields = line.split()
+        if line.strip() == "profiler trace begin":
+            names = {}
+            events = []
+            in_trace = True
+        elif not in_trace or not fields:
+            continue
+        elif fields[0] == "frequency" and len(fields) == 2:
+            frequency = int(fields[1])
+        elif fields[0] == "name" and len(fields) >= 3:
+            names[int(fields[1])] = " ".join(fields[2:])
+        elif fields[0] == "event" and len(fields) == 5:
+            events.append((int(fields[1]), fields[2], int(fields[3]), int(fields[4])))
+        elif fields[0] == "profiler" and fields[1:3] == ["trace", "end"]:
+            in_trace = False
+    return frequency, names, events
+
+
+def unwrap_timestamps(events):
+    """
+    Timestamps are 32-bit tick counts that wrap (every ~24 s at 180 MHz), makes them monotonic.
+    Interrupts may record events slightly out of order, so only large backwards jumps are
+    treated as wraps.
+    """
+    offset = 0
+    previous = None
+    unwrapped = []
+    for timestamp, phase, key, context in events:
+        if previous is not None and previous - timestamp > TIMESTAMP_RANGE // 2:
+            offset += TIMESTAMP_RANGE
+        previous = timestamp
+        unwrapped.append((timestamp + offset, phase, key, context))
+    return unwrapped
+
+
+def to_chrome_trace(frequency, names, events):
+    """
+    Returns the Chrome trace for the events. End events whose begin event was overwritten or
+    recorded before the trace started are dropped so the remaining events nest correctly.
+    """
+    trace_events = []
+    open_keys = {}
+    for timestamp, phase, key, context in unwrap_timestamps(events):
+        stack = open_keys.setdefault(context, [])
+        if phase == "B":
+            stack.append(key)
+        elif key in stack:
+            while stack.pop() != key:
+                pass
+        else:
+            continue
+        trace_events.append(
+            {
+                "name": names.get(key, "profile {}".format(key)),
+                "ph": phase,
+                "ts": timestamp * 1e6 / frequency,
+                "pid": 0,
+                "tid": context,
+            }
+        )
+
+    for context in sorted(open_keys):
+        trace_events.append(
+            {
+                "name": "thread_name",
+                "ph": "M",
+                "pid": 0,
+                "tid": context,
+                "args": {"name": "thread mode" if context == 0 else "exception {}".format(context)},
+            }
+        )
+
+    return {"traceEvents": trace_events, "displayTimeUnit": "ms"}
+
+
+def main():
+    if len(sys.argv) not in (2, 3):
+        print(__doc__)
+        sys.exit(1)
+
+    with open(sys.argv[1]) as dump:
+        frequency, names, events = parse_dump(dump)
+
+    if not events:
+        print("no profiler trace found in {}".format(sys.argv[1]))
+        sys.exit(1)
+
+    output_path = sys.argv[2] if len(sys.argv) == 3 else sys.argv[1].rsplit(".", 1)[0] + ".json"
+    with open(output_path, "w") as output:
+        json.dump(to_chrome_trace(frequency, names, events), output)
+
+    print("wrote {} events to {}".format(len(events), output_path))
+
+
+if __name__ == "__main__":
+    main()
@@ -61,6 +61,14 @@ DRIVERS_AND_MODULE_DEPENDENCIES = [
         "constructor": "this",
         "module-dependencies": [":communication:can"],
     },
+    {
+        "object-name": "can::CanTxQueue",
+        "mock-object-name": nice_mock("mock::CanTxQueueMock"),
+        "src-file": "tap/communication/can/can_tx_queue.hpp",
+        "mock-header": "tap/mock/can_tx_queue_mock.hpp",
+        "constructor": "this",
+        "module-dependencies": [":communication:can"],
+    },
     {
         "object-name": "gpio::Digital",
         "mock-object-name": nice_mock("mock::DigitalMock"),
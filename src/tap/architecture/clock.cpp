@@ -17,14 +17,17 @@
  * along with Taproot.  If not, see <https://www.gnu.org/licenses/>.
  */
 
-#if defined(PLATFORM_HOSTED) && defined(ENV_UNIT_TESTS)
-
 #include "clock.hpp"
 
+#if defined(PLATFORM_HOSTED) && defined(ENV_UNIT_TESTS)
 #include "modm/architecture/interface/assert.h"
+#else
+#include "modm/architecture/interface/atomic_lock.hpp"
+#endif
 
 namespace tap::arch::clock
 {
+#if defined(PLATFORM_HOSTED) && defined(ENV_UNIT_TESTS)
 static ClockStub *globalStubInstance = nullptr;
 
 ClockStub::ClockStub()
@@ -46,6 +49,25 @@ uint32_t getTimeMicroseconds()
 {
     return globalStubInstance == nullptr ? 0 : 1000 * globalStubInstance->time;
 }
-}  // namespace tap::arch::clock
 
+uint64_t getTimeMicroseconds64()
+{
+    return globalStubInstance == nullptr ? 0 : 1000ull * globalStubInstance->time;
+}
+#else
+uint64_t getTimeMicroseconds64()
+{
+    static uint32_t wraps = 0;
+    static uint32_t prevTime = 0;
+
+    modm::atomic::Lock lock;
+    uint32_t time = getTimeMicroseconds();
+    if (time < prevTime)
+    {
+        wraps++;
+    }
+    prevTime = time;
+    return (static_cast<uint64_t>(wraps) << 32) | time;
+}
 #endif
+}  // namespace tap::arch::clock
@@ -53,6 +53,12 @@ class ClockStub final
 
 uint32_t getTimeMilliseconds();
 uint32_t getTimeMicroseconds();
+
+/**
+ * @return `time` in microseconds, without wrapping. Setting `time` past 4'294'967 ms pushes
+ * `getTimeMicroseconds()` across the 32-bit boundary.
+ */
+uint64_t getTimeMicroseconds64();
 #else
 inline uint32_t getTimeMilliseconds() { return modm::Clock().now().time_since_epoch().count(); }
 
@@ -63,6 +69,13 @@ inline uint32_t getTimeMicroseconds()
 {
     return modm::PreciseClock().now().time_since_epoch().count();
 }
+
+/**
+ * A monotonic microsecond clock that does not wrap in practice (~584'000 years). Extends
+ * `getTimeMicroseconds()` by counting its wraps, so it must be called at least once every 71
+ * minutes, which anything polling a 64-bit timer does. Safe to call from interrupts.
+ */
+uint64_t getTimeMicroseconds64();
 #endif
 }  // namespace tap::arch::clock
 
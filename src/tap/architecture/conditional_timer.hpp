@@ -42,7 +42,7 @@ class ConditionalTimer
     /**
      * @param[in] timeout: the timeout for this timer to use
      */
-    explicit ConditionalTimer(uint32_t timeout) : timeout(timeout) {}
+    explicit ConditionalTimer(typename Timeout::TimeType timeout) : timeout(timeout) {}
 
     /**
      * Set the timer to expire `this->timeout` units of time away from the time at
@@ -55,7 +55,7 @@ class ConditionalTimer
      *
      * @param[in] period: the new period to use for this `PeriodicTimer`
      */
-    inline void restart(uint32_t newTimeout)
+    inline void restart(typename Timeout::TimeType newTimeout)
     {
         timeout = newTimeout;
         timer.restart(newTimeout);
@@ -88,10 +88,11 @@ class ConditionalTimer
 
 private:
     Timeout timer;
-    uint32_t timeout;
+    typename Timeout::TimeType timeout;
 };
 
 using ConditionalMilliTimer = ConditionalTimer<MilliTimeout>;
+using ConditionalMicroTimer64 = ConditionalTimer<MicroTimeout64>;
 
 }  // namespace arch
 
@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2026 Advanced Robotics at the University of Washington <robomstr@uw.edu>
+ *
+ * This file is part of Taproot.
+ *
+ * Taproot is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Taproot is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Taproot.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef TAPROOT_LATENCY_HISTOGRAM_HPP_
+#define TAPROOT_LATENCY_HISTOGRAM_HPP_
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+namespace tap::arch
+{
+/**
+ * A histogram of durations with power of two sized buckets, used to estimate percentiles of
+ * rare, long durations that a min/max/average hides. Adding a sample is a count leading zeros
+ * and an increment; there is no allocation.
+ *
+ * Bucket 0 holds durations of 0, bucket `i` holds durations in `[2^(i-1), 2^i)` and the last
+ * bucket also holds everything longer.
+ *
+ * @tparam BUCKETS The number of buckets. With microsecond durations, 20 buckets resolve up to
+ * about 262 ms.
+ */
+template <std::size_t BUCKETS>
+class LatencyHistogram
+{
+public:
+    static_assert(BUCKETS >= 2 && BUCKETS <= 33, "BUCKETS must be in [2, 33]");
+
+    /// Records a duration.
+    inline void add(uint32_t duration)
+    {
+        std::size_t bucket = getBucket(duration);
+        counts[bucket]++;
+        totalCount++;
+    }
+
+    /// @return The number of durations recorded since the last `reset()`.
+    inline uint32_t getCount() const { return totalCount; }
+
+    /// @return The number of durations recorded in `bucket`.
+    inline uint32_t getBucketCount(std::size_t bucket) const
+    {
+        return bucket < BUCKETS ? counts[bucket] : 0;
+    }
+
+    /// @return The bucket a duration is recorded in.
+    static inline std::size_t getBucket(uint32_t duration)
+    {
+        std::size_t bucket = std::bit_width(duration);
+        return bucket < BUCKETS ? bucket : BUCKETS - 1;
+    }
+
+    /// @return The smallest duration recorded in `bucket`.
+    static inline uint32_t getBucketLowerBound(std::size_t bucket)
+    {
+        return bucket == 0 ? 0 : UINT32_C(1) << (bucket - 1);
+    }
+
+    /**
+     * Estimates a percentile by finding the bucket it falls in and interpolating linearly within
+     * the bucket. The estimate is within a factor of two of the true value. For the last bucket,
+     * which has no upper bound, the bucket's lower bound is returned.
+     *
+     * @param[in] fraction The percentile as a fraction in `[0, 1]`, e.g. 0.999 for p99.9.
+     * @return The estimated duration, or 0 if no durations have been recorded.
+     */
+    uint32_t getPercentile(float fraction) const
+    {
+        if (totalCount == 0)
+        {
+            return 0;
+        }
+
+        fraction = fraction < 0.0f ? 0.0f : (fraction > 1.0f ? 1.0f : fraction);
+        // The rank of the sample looked for, counting from 1
+        float rank = fraction * totalCount;
+        rank = rank < 1.0f ? 1.0f : rank;
+
+        uint32_t countBefore = 0;
+        for (std::size_t bucket = 0; bucket < BUCKETS; bucket++)
+        {
+            if (counts[bucket] == 0 || countBefore + counts[bucket] < rank)
+            {
+                countBefore += counts[bucket];
+                continue;
+            }
+
+            if (bucket == 0 || bucket == BUCKETS - 1)
+            {
+                return getBucketLowerBound(bucket);
+            }
+
+            uint32_t lower = getBucketLowerBound(bucket);
+            uint32_t width = getBucketLowerBound(bucket + 1) - lower;
+            float position = (rank - countBefore) / counts[bucket];
+            return lower + static_cast<uint32_t>(position * (width - 1));
+        }
+
+        return getBucketLowerBound(BUCKETS - 1);
+    }
+
+    /// Clears all recorded durations.
+    inline void reset()
+    {
+        for (std::size_t i = 0; i < BUCKETS; i++)
+        {
+            counts[i] = 0;
+        }
+        totalCount = 0;
+    }
+
+private:
+    uint32_t counts[BUCKETS] = {};
+    uint32_t totalCount = 0;
+};  // class LatencyHistogram
+}  // namespace tap::arch
+
+#endif  // TAPROOT_LATENCY_HISTOGRAM_HPP_
@@ -39,7 +39,7 @@ class PeriodicTimer
 public:
     PeriodicTimer() : period(0) {}
 
-    explicit PeriodicTimer(uint32_t period) : period(period), timeout(period) {}
+    explicit PeriodicTimer(typename T::TimeType period) : period(period), timeout(period) {}
 
     /**
      * Set the timer to expire `period` units of time away from the time at which
@@ -52,7 +52,7 @@ class PeriodicTimer
      *
      * @param[in] period: the new period to use for this `PeriodicTimer`
      */
-    inline void restart(uint32_t period)
+    inline void restart(typename T::TimeType period)
     {
         this->period = period;
         restart();
@@ -76,7 +76,7 @@ class PeriodicTimer
     {
         if (timeout.execute())
         {
-            uint32_t now = T::TimeFunc();
+            typename T::TimeType now = T::TimeFunc();
 
             do
             {
@@ -96,12 +96,13 @@ class PeriodicTimer
     inline bool isStopped() const { return timeout.isStopped(); }
 
 private:
-    uint32_t period;
+    typename T::TimeType period;
     T timeout;
 };
 
 using PeriodicMilliTimer = PeriodicTimer<MilliTimeout>;
 using PeriodicMicroTimer = PeriodicTimer<MicroTimeout>;
+using PeriodicMicroTimer64 = PeriodicTimer<MicroTimeout64>;
 
 }  // namespace arch
 }  // namespace tap
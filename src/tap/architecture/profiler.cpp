@@ -24,50 +24,212 @@
 
 #include "../algorithms/math_user_utils.hpp"
 
-#include "clock.hpp"
-
 namespace tap::arch
 {
-Profiler::Profiler(tap::Drivers *drivers) : drivers(drivers) {}
+Profiler::Profiler(tap::Drivers *drivers) : drivers(drivers) { timebase::initialize(); }
 
 std::size_t Profiler::push(const char *profile)
 {
-    auto index = elementNameToIndexMap.find(profile);
-    if (index != elementNameToIndexMap.end())
+    std::size_t key = registerProfile(profile);
+    if (key < numProfiledElements)
+    {
+        start(key);
+    }
+    return key;
+}
+
+std::size_t Profiler::registerProfile(const char *profile)
+{
+    // Only reached the first time a call site pushes a profile when using the PROFILE macro
+    for (std::size_t key = 0; key < numProfiledElements; key++)
     {
-        ProfilerData *data = &profiledElements[index->second];
-        data->prevPushedTime = clock::getTimeMicroseconds();
-        return index->second;
+        if (profiledElements[key].name == profile)
+        {
+            return key;
+        }
     }
-    else if (!profiledElements.isFull())
+
+    if (numProfiledElements < MAX_PROFILED_ELEMENTS)
     {
-        profiledElements.append(ProfilerData(profile));
-        std::size_t key = profiledElements.getSize() - 1;
-        elementNameToIndexMap[profile] = key;
-        profiledElements[key].prevPushedTime = clock::getTimeMicroseconds();
+        std::size_t key = numProfiledElements++;
+        profiledElements[key] = ProfilerData(profile);
         return key;
     }
     else
     {
         RAISE_ERROR(drivers, "profiler full, no more additional profiling data allowed");
-        return profiledElements.getSize();
+        return numProfiledElements;
     }
 }
 
 void Profiler::pop(std::size_t key)
 {
-    if (key >= profiledElements.getSize())
+    if (key >= numProfiledElements)
     {
         RAISE_ERROR(drivers, "attempting to pop profile, but never pushed");
     }
     else
     {
         ProfilerData *data = &profiledElements[key];
-        uint32_t dt = clock::getTimeMicroseconds() - data->prevPushedTime;
+        uint32_t now = timebase::getTicks();
+#ifdef TAPROOT_PROFILER_HIERARCHY
+        uint32_t pushedTime = hierarchical ? popFrame(key, now) : data->prevPushedTime;
+#else
+        uint32_t pushedTime = data->prevPushedTime;
+#endif
+        uint32_t dtTicks = now - pushedTime;
+#ifdef TAPROOT_PROFILER_TRACE
+        trace.record(now, key, ProfilerTraceEventType::END);
+#endif
+        uint32_t dt = static_cast<uint32_t>(timebase::ticksToMicroseconds(dtTicks));
         data->max = std::max(dt, data->max);
         data->min = std::min(dt, data->min);
-        data->avg = algorithms::lowPassFilter(data->avg, dt, AVG_LOW_PASS_ALPHA);
+        data->avg = algorithms::lowPassFilter(
+            data->avg,
+            timebase::ticksToMicrosecondsFloat(dtTicks),
+            AVG_LOW_PASS_ALPHA);
+#ifdef TAPROOT_PROFILER_HISTOGRAMS
+        if (histogramWindow != 0 && data->histogram.getCount() >= histogramWindow)
+        {
+            data->histogram.reset();
+        }
+        data->histogram.add(dt);
+#endif
+    }
+}
+
+#ifdef TAPROOT_PROFILER_HISTOGRAMS
+Profiler::LatencyPercentiles Profiler::getPercentiles(std::size_t key) const
+{
+    LatencyPercentiles percentiles;
+
+    if (key < numProfiledElements)
+    {
+        const auto &histogram = profiledElements[key].histogram;
+        percentiles.p50 = histogram.getPercentile(0.5f);
+        percentiles.p90 = histogram.getPercentile(0.9f);
+        percentiles.p99 = histogram.getPercentile(0.99f);
+        percentiles.p999 = histogram.getPercentile(0.999f);
+    }
+
+    return percentiles;
+}
+#endif
+
+#ifdef TAPROOT_PROFILER_HIERARCHY
+void Profiler::setHierarchicalProfilingEnabled(bool enabled)
+{
+    hierarchical = enabled;
+    resetCallTree();
+}
+
+void Profiler::resetCallTree()
+{
+    numNodes = 0;
+    firstRootNode = NO_NODE;
+    stackDepth = 0;
+    overflowDepth = 0;
+}
+
+void Profiler::pushFrame(std::size_t key, uint32_t now)
+{
+    if (stackDepth == MAX_STACK_DEPTH)
+    {
+        overflowDepth++;
+        return;
+    }
+
+    // Recursion reuses the node of the outermost call to this profile that is still running
+    int16_t node = NO_NODE;
+    for (std::size_t i = 0; i < stackDepth; i++)
+    {
+        if (stack[i].key == key)
+        {
+            node = stack[i].node;
+            break;
+        }
+    }
+
+    if (node == NO_NODE)
+    {
+        int16_t parent = stackDepth == 0 ? NO_NODE : stack[stackDepth - 1].node;
+        // Profiles below one that did not fit in the tree are not added either
+        if (stackDepth == 0 || parent != NO_NODE)
+        {
+            node = findOrAddNode(parent, key);
+        }
     }
+
+    if (node != NO_NODE)
+    {
+        nodes[node].activeCount++;
+    }
+
+    stack[stackDepth++] = {now, 0, static_cast<uint16_t>(key), node};
+}
+
+uint32_t Profiler::popFrame(std::size_t key, uint32_t now)
+{
+    if (overflowDepth > 0)
+    {
+        overflowDepth--;
+        return profiledElements[key].prevPushedTime;
+    }
+
+    if (stackDepth == 0 || stack[stackDepth - 1].key != key)
+    {
+        RAISE_ERROR(drivers, "profiles popped in a different order than they were pushed");
+        return profiledElements[key].prevPushedTime;
+    }
+
+    const StackFrame &frame = stack[--stackDepth];
+    uint32_t dt = now - frame.pushedTime;
+
+    if (frame.node != NO_NODE)
+    {
+        ProfilerNode &node = nodes[frame.node];
+        node.callCount++;
+        node.selfTime += dt - frame.childTime;
+        // Recursive calls are already included in the outermost call's time
+        if (--node.activeCount == 0)
+        {
+            node.inclusiveTime += dt;
+        }
+    }
+
+    if (stackDepth > 0)
+    {
+        stack[stackDepth - 1].childTime += dt;
+    }
+
+    return frame.pushedTime;
+}
+
+int16_t Profiler::findOrAddNode(int16_t parent, std::size_t key)
+{
+    int16_t *link = parent == NO_NODE ? &firstRootNode : &nodes[parent].firstChild;
+
+    while (*link != NO_NODE)
+    {
+        if (nodes[*link].key == key)
+        {
+            return *link;
+        }
+        link = &nodes[*link].nextSibling;
+    }
+
+    if (numNodes == MAX_PROFILER_NODES)
+    {
+        return NO_NODE;
+    }
+
+    int16_t index = static_cast<int16_t>(numNodes++);
+    nodes[index] = ProfilerNode();
+    nodes[index].key = static_cast<uint16_t>(key);
+    nodes[index].parent = parent;
+    *link = index;
+    return index;
 }
+#endif
 
 }  // namespace tap::arch
@@ -20,17 +20,33 @@
 #ifndef TAPROOT_PROFILER_HPP_
 #define TAPROOT_PROFILER_HPP_
 
-#include <unordered_map>
+#include <cstddef>
+#include <cstdint>
 
-#include "modm/container.hpp"
+#include "latency_histogram.hpp"
+#include "profiler_trace.hpp"
+#include "timebase.hpp"
+
+#if defined(RUN_WITH_PROFILING) || defined(ENV_UNIT_TESTS)
+/// When defined, each profile also keeps a histogram of its durations, see `Profiler`.
+#define TAPROOT_PROFILER_HISTOGRAMS
+/// When defined, the profiler can record a timeline of profiles, see `Profiler::getTrace`.
+#define TAPROOT_PROFILER_TRACE
+/**
+ * When defined, the profiler can build a call tree of nested profiles, see
+ * `Profiler::setHierarchicalProfilingEnabled`.
+ */
+#define TAPROOT_PROFILER_HIERARCHY
+#endif
 
 #ifdef RUN_WITH_PROFILING
-#define PROFILE(profiler, func, params) \
-    do                                  \
-    {                                   \
-        int key = profiler.push(#func); \
-        func params;                    \
-        profiler.pop(key);              \
+#define PROFILE(profiler, func, params)                                      \
+    do                                                                       \
+    {                                                                        \
+        static std::size_t profileCallSiteKey = tap::arch::Profiler::NO_KEY; \
+        std::size_t key = profiler.push(#func, profileCallSiteKey);          \
+        func params;                                                         \
+        profiler.pop(key);                                                   \
     } while (0);
 #else
 #define PROFILE(profiler, func, params) func params
@@ -70,14 +86,33 @@ namespace tap::arch
  * In the example above, `profiler` is a pointer to a valid `Profiler` class. If you call `baz`, it
  * will add the profile "bar" and "foo" to the profiler.
  *
+ * When built with profiling (or for unit tests) each profile also keeps a `LatencyHistogram` of
+ * its durations in power of two buckets, from which `getPercentiles` estimates p50, p90, p99 and
+ * p99.9 to show rare spikes the average hides. `setHistogramWindow` limits the histograms to
+ * recent samples.
+ *
+ * When built with profiling (or for unit tests) the profiler can also record a timeline of
+ * begin/end events into a ProfilerTrace, see `getTrace`. Interrupts, which must not call `push` or
+ * `pop`, can add themselves to the timeline with `traceBegin` and `traceEnd` using a key from
+ * `registerProfile`. ProfilerTerminalHandler dumps the trace and
+ * `build-tools/profiler_trace_to_chrome.py` converts the dump into a Chrome trace for
+ * `chrome://tracing` or Perfetto.
+ *
+ * Each `PROFILE` call site caches the key of its profile in a function-local static, so after the
+ * first call pushing and popping a profile is two timestamp reads and a few array accesses.
+ *
+ * Durations are measured with the `timebase` tick counter (the cycle counter on target) and
+ * converted to microseconds when a profile is popped, so the average of code that takes less than
+ * a microsecond is still meaningful.
+ *
  * The profiler is limited in size to `MAX_PROFILED_ELEMENTS`. Once a element is registered with the
  * profiler, the profiler will keep track of the min, max, and rolling average time (in
  * microseconds) it takes to run the code associated with the profile. The profiled elements can
- * then be inspected using a debugger, or in the future can be accessed via the terminal serial (not
- * yet implemented).
+ * then be inspected using a debugger or printed over the terminal serial with
+ * ProfilerTerminalHandler.
  *
- * One known limitation is this profiler doesn't handle recursion well. For example, consider the
- * following:
+ * By default the profiler only keeps one start time per profile, so it doesn't handle recursion
+ * well. For example, consider the following:
  *
  * ```cpp
  * void foo(int i)
@@ -87,9 +122,18 @@ namespace tap::arch
  * }
  * ```
  *
- * In this example, the `PROFILE` macro will overwrite the entry in the profiler in a way that makes
- * the profiler information not useful for the `foo` function, so it is recommended that you do not
- * use the `PROFILE` macro for a recursive call.
+ * Here the inner `PROFILE` overwrites the start time of the outer one, so the information for
+ * `foo` is not useful.
+ *
+ * When built with profiling (or for unit tests), enabling hierarchical profiling with
+ * `setHierarchicalProfilingEnabled` fixes this. The profiler
+ * then keeps a stack of the profiles currently pushed and builds a call tree of `ProfilerNode`s,
+ * one per distinct path of nested profiles, each with a call count, inclusive time (including
+ * nested profiles) and self time (excluding them). A profile pushed while it is already on the
+ * stack, i.e. recursion, is folded into the node of its outermost call, so its inclusive time is
+ * only counted once. The tree is stored in a fixed array of `MAX_PROFILER_NODES` nodes; profiles
+ * nested deeper than `MAX_STACK_DEPTH` or pushed once the tree is full only update the flat
+ * `ProfilerData`.
  */
 class Profiler
 {
@@ -98,6 +142,18 @@ class Profiler
     static constexpr std::size_t MAX_PROFILED_ELEMENTS = 128;
     /// Low pass alpha to be used when averaging time it takes for some code to run.
     static constexpr float AVG_LOW_PASS_ALPHA = 0.01f;
+    /// Initial value of a call site's cached key, see `push(const char*, std::size_t&)`.
+    static constexpr std::size_t NO_KEY = SIZE_MAX;
+#ifdef TAPROOT_PROFILER_HIERARCHY
+    /// Max number of nodes in the hierarchical profiling call tree.
+    static constexpr std::size_t MAX_PROFILER_NODES = 128;
+    /// Max nesting depth of profiles tracked by hierarchical profiling.
+    static constexpr std::size_t MAX_STACK_DEPTH = 32;
+    /// Index of a node that does not exist, e.g. the parent of a root node.
+    static constexpr int16_t NO_NODE = -1;
+#endif
+    /// Number of buckets in each profile's histogram, resolving durations up to ~262 ms.
+    static constexpr std::size_t HISTOGRAM_BUCKETS = 20;
 
     /**
      * Stores profile information.
@@ -113,9 +169,14 @@ class Profiler
         /// Average value, in microseconds, averaged using a low pass filter.
         float avg = 0;
         /**
-         * Value used to measure a "dt" between pushing and popping the profile from the profiler.
+         * Value used to measure a "dt" between pushing and popping the profile from the profiler,
+         * in timebase ticks.
          */
         uint32_t prevPushedTime = 0;
+#ifdef TAPROOT_PROFILER_HISTOGRAMS
+        /// Histogram of durations, in microseconds.
+        LatencyHistogram<HISTOGRAM_BUCKETS> histogram;
+#endif
 
         ProfilerData() {}
         explicit ProfilerData(const char* name) : name(name) {}
@@ -126,9 +187,49 @@ class Profiler
             min = UINT32_MAX;
             max = 0;
             avg = 0;
+#ifdef TAPROOT_PROFILER_HISTOGRAMS
+            histogram.reset();
+#endif
         }
     };
 
+    /**
+     * Percentiles of a profile's durations, in microseconds, estimated from its histogram.
+     */
+    struct LatencyPercentiles
+    {
+        uint32_t p50 = 0;
+        uint32_t p90 = 0;
+        uint32_t p99 = 0;
+        uint32_t p999 = 0;
+    };
+
+#ifdef TAPROOT_PROFILER_HIERARCHY
+    /**
+     * A node in the hierarchical profiling call tree, see `setHierarchicalProfilingEnabled`.
+     * Nodes are linked to their parent, first child and next sibling by index.
+     */
+    struct ProfilerNode
+    {
+        /**
+         * Total time spent in this node including nested profiles, in timebase ticks (see
+         * `timebase::ticksToMicroseconds`).
+         */
+        uint64_t inclusiveTime = 0;
+        /// Total time spent in this node excluding nested profiles, in timebase ticks.
+        uint64_t selfTime = 0;
+        /// Number of times the profile was pushed and popped along this path.
+        uint32_t callCount = 0;
+        /// Key of the profile, as returned by `push`.
+        uint16_t key = 0;
+        int16_t parent = NO_NODE;
+        int16_t firstChild = NO_NODE;
+        int16_t nextSibling = NO_NODE;
+        /// Number of frames on the stack currently using this node.
+        uint16_t activeCount = 0;
+    };
+#endif
+
     Profiler(tap::Drivers* drivers);
 
     /**
@@ -143,6 +244,36 @@ class Profiler
      */
     std::size_t push(const char* profile);
 
+    /**
+     * Adds a profile to the profiler without starting its stopwatch, or finds it if it was
+     * already added. Raises an error if the profiler is full.
+     *
+     * @param[in] profile The name of the profile, as for `push`.
+     * @return The profile's key, or an invalid key (`>= MAX_PROFILED_ELEMENTS`) if the profiler
+     * is full.
+     */
+    std::size_t registerProfile(const char* profile);
+
+    /**
+     * Same as `push(const char*)`, but first tries the key cached by the call site, which avoids
+     * searching for the profile. Used by the `PROFILE` macro.
+     *
+     * @param[in] profile The name of the profile, as for `push(const char*)`.
+     * @param[in, out] cachedKey Key previously returned for this call site, or `NO_KEY`. Updated
+     * if it does not refer to `profile` in this profiler.
+     */
+    inline std::size_t push(const char* profile, std::size_t& cachedKey)
+    {
+        if (cachedKey < numProfiledElements && profiledElements[cachedKey].name == profile)
+        {
+            start(cachedKey);
+            return cachedKey;
+        }
+
+        cachedKey = push(profile);
+        return cachedKey;
+    }
+
     /**
      * "Pops" a profile data, to stop the stopwatch that is timing how long some code takes to run.
      *
@@ -154,40 +285,179 @@ class Profiler
     /// @return The data associated with some particular key.
     inline ProfilerData getData(std::size_t key)
     {
-        if (key >= profiledElements.getSize())
+        if (key >= numProfiledElements)
         {
             return ProfilerData();
         }
         else
         {
-            return profiledElements.get(key);
+            return profiledElements[key];
         }
     }
 
+    /// @return The number of profiles registered, keys are `0` to `getNumProfiles() - 1`.
+    inline std::size_t getNumProfiles() const { return numProfiledElements; }
+
     /// Reset the ProfilerData associated with some particular key.
     inline void reset(std::size_t key)
     {
-        if (key < profiledElements.getSize())
+        if (key < numProfiledElements)
         {
             profiledElements[key].reset();
         }
     }
 
+#ifdef TAPROOT_PROFILER_TRACE
+    /// @return The timeline of profile begin/end events. Recording is disabled by default.
+    inline ProfilerTrace& getTrace() { return trace; }
+
+    /**
+     * Records the beginning of the profile with the given key in the trace only, without
+     * updating its statistics. Safe to call from interrupts.
+     *
+     * @param[in] key A key returned by `registerProfile` or `push`.
+     */
+    inline void traceBegin(std::size_t key)
+    {
+        trace.record(timebase::getTicks(), key, ProfilerTraceEventType::BEGIN);
+    }
+
+    /// Records the end of a profile begun with `traceBegin`. Safe to call from interrupts.
+    inline void traceEnd(std::size_t key)
+    {
+        trace.record(timebase::getTicks(), key, ProfilerTraceEventType::END);
+    }
+#endif
+
+#ifdef TAPROOT_PROFILER_HISTOGRAMS
+    /**
+     * @return Estimated percentiles of the durations of the profile with the given key, all 0 if
+     * the key is invalid or nothing has been recorded.
+     */
+    LatencyPercentiles getPercentiles(std::size_t key) const;
+
+    /**
+     * Limits each profile's histogram to a window of recent samples. Once a histogram holds
+     * `samples` durations, it is cleared before the next one is added.
+     *
+     * @param[in] samples The window size, or 0 (the default) to keep every sample until `reset`.
+     */
+    inline void setHistogramWindow(uint32_t samples) { histogramWindow = samples; }
+
+    inline uint32_t getHistogramWindow() const { return histogramWindow; }
+#endif
+
+#ifdef TAPROOT_PROFILER_HIERARCHY
+    /**
+     * Enables or disables hierarchical profiling. Changing the mode clears the call tree and
+     * should only be done while no profiles are pushed.
+     */
+    void setHierarchicalProfilingEnabled(bool enabled);
+
+    inline bool isHierarchicalProfilingEnabled() const { return hierarchical; }
+
+    /// @return The number of nodes in the call tree.
+    inline std::size_t getNodeCount() const { return numNodes; }
+
+    /**
+     * @return The call tree node at `index`, or `nullptr` if there is none. Nodes are stored in
+     * the order they were first reached, so a node's parent always has a smaller index.
+     */
+    inline const ProfilerNode* getNode(std::size_t index) const
+    {
+        return index < numNodes ? &nodes[index] : nullptr;
+    }
+
+    /// @return The index of the first root node of the call tree, or `NO_NODE` if it is empty.
+    inline int16_t getFirstRootNode() const { return firstRootNode; }
+
+    /**
+     * Clears the call tree. Should only be called while no profiles are pushed.
+     */
+    void resetCallTree();
+#endif
+
 private:
+#ifdef TAPROOT_PROFILER_HIERARCHY
+    /**
+     * A profile currently pushed, used by hierarchical profiling.
+     */
+    struct StackFrame
+    {
+        uint32_t pushedTime;
+        /// Inclusive time of the profiles pushed and popped while this one was on top.
+        uint32_t childTime;
+        uint16_t key;
+        /// Node in the call tree, or NO_NODE if the tree was full.
+        int16_t node;
+    };
+#endif
+
     tap::Drivers* drivers;
 
+#ifdef TAPROOT_PROFILER_HIERARCHY
+    bool hierarchical = false;
+
+    ProfilerNode nodes[MAX_PROFILER_NODES];
+
+    std::size_t numNodes = 0;
+
+    int16_t firstRootNode = NO_NODE;
+
+    StackFrame stack[MAX_STACK_DEPTH];
+
+    std::size_t stackDepth = 0;
+
+    /// Number of profiles pushed beyond `MAX_STACK_DEPTH` and not yet popped.
+    std::size_t overflowDepth = 0;
+#endif
+
+    /// Starts timing the profile with the given key.
+    inline void start(std::size_t key)
+    {
+        uint32_t now = timebase::getTicks();
+        profiledElements[key].prevPushedTime = now;
+#ifdef TAPROOT_PROFILER_HIERARCHY
+        if (hierarchical)
+        {
+            pushFrame(key, now);
+        }
+#endif
+#ifdef TAPROOT_PROFILER_TRACE
+        trace.record(now, key, ProfilerTraceEventType::BEGIN);
+#endif
+    }
+
+#ifdef TAPROOT_PROFILER_HIERARCHY
+    void pushFrame(std::size_t key, uint32_t now);
+
     /**
-     * Map element names (function names) to index in profiledElements. Don't directly store
-     * ProfilerData's in this map to allow for easier accessability of the elements during
-     * debugging. std::map on the embedded system is scuffed and doesn't allow for easy access to
-     * internal elements.
+     * Pops the frame of `key` off the stack and updates its call tree node.
+     *
+     * @return The time the frame was pushed, or the profile's `prevPushedTime` if `key` is not
+     * on top of the stack.
      */
-    std::unordered_map<const char*, std::size_t> elementNameToIndexMap;
+    uint32_t popFrame(std::size_t key, uint32_t now);
+
+    /// @return The node for `key` under `parent` (or a root node), added if not found.
+    int16_t findOrAddNode(int16_t parent, std::size_t key);
+#endif
 
     /**
-     * Array of profiling data information
+     * Array of profiling data information, indexed by key. Only the first `numProfiledElements`
+     * are in use.
      */
-    modm::BoundedDeque<ProfilerData, MAX_PROFILED_ELEMENTS> profiledElements;
+    ProfilerData profiledElements[MAX_PROFILED_ELEMENTS];
+
+    std::size_t numProfiledElements = 0;
+
+#ifdef TAPROOT_PROFILER_HISTOGRAMS
+    uint32_t histogramWindow = 0;
+#endif
+
+#ifdef TAPROOT_PROFILER_TRACE
+    ProfilerTrace trace;
+#endif
 };
 
 }  // namespace tap::arch
@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2026 Advanced Robotics at the University of Washington <robomstr@uw.edu>
+ *
+ * This file is part of Taproot.
+ *
+ * Taproot is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Taproot is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Taproot.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "profiler_terminal_handler.hpp"
+
+#include <cstring>
+
+#include "tap/algorithms/strtok.hpp"
+#include "tap/drivers.hpp"
+
+namespace tap
+{
+namespace arch
+{
+constexpr char ProfilerTerminalHandler::HEADER[];
+constexpr char ProfilerTerminalHandler::USAGE[];
+
+ProfilerTerminalHandler::ProfilerTerminalHandler(Drivers* drivers) : drivers(drivers) {}
+
+void ProfilerTerminalHandler::init() { drivers->terminalSerial.addHeader(HEADER, this); }
+
+void ProfilerTerminalHandler::terminalSerialStreamCallback(modm::IOStream& outputStream)
+{
+    printStats(outputStream);
+}
+
+bool ProfilerTerminalHandler::terminalSerialCallback(
+    char* inputLine,
+    modm::IOStream& outputStream,
+    bool streamingEnabled)
+{
+    char* arg = strtokR(inputLine, communication::serial::TerminalSerial::DELIMITERS, &inputLine);
+
+    if (arg != nullptr && strcmp(arg, "stats") == 0)
+    {
+        printStats(outputStream);
+        return true;
+    }
+#ifdef TAPROOT_PROFILER_TRACE
+    else if (arg != nullptr && !streamingEnabled && strcmp(arg, "trace") == 0)
+    {
+        return handleTraceCommand(inputLine, outputStream);
+    }
+#endif
+    else
+    {
+        outputStream << USAGE;
+        return (arg != nullptr) && !streamingEnabled && (strcmp(arg, "-H") == 0);
+    }
+}
+
+void ProfilerTerminalHandler::printStats(modm::IOStream& outputStream)
+{
+    Profiler& profiler = drivers->profiler;
+
+#ifdef TAPROOT_PROFILER_HISTOGRAMS
+    outputStream << "name\tmin\tmax\tavg\tp50\tp90\tp99\tp99.9" << modm::endl;
+#else
+    outputStream << "name\tmin\tmax\tavg" << modm::endl;
+#endif
+
+    for (std::size_t key = 0; key < profiler.getNumProfiles(); key++)
+    {
+        Profiler::ProfilerData data = profiler.getData(key);
+        outputStream << " " << data.name << "\t";
+        if (data.min > data.max)
+        {
+            outputStream << "-\t-\t-";
+        }
+        else
+        {
+            outputStream << data.min << "\t" << data.max << "\t";
+            outputStream.printf("%.1f", static_cast<double>(data.avg));
+        }
+#ifdef TAPROOT_PROFILER_HISTOGRAMS
+        Profiler::LatencyPercentiles percentiles = profiler.getPercentiles(key);
+        outputStream << "\t" << percentiles.p50 << "\t" << percentiles.p90 << "\t"
+                     << percentiles.p99 << "\t" << percentiles.p999;
+#endif
+        outputStream << modm::endl;
+    }
+}
+
+#ifdef TAPROOT_PROFILER_TRACE
+bool ProfilerTerminalHandler::handleTraceCommand(char* inputLine, modm::IOStream& outputStream)
+{
+    ProfilerTrace& trace = drivers->profiler.getTrace();
+    char* arg = strtokR(inputLine, communication::serial::TerminalSerial::DELIMITERS, &inputLine);
+
+    if (arg != nullptr && strcmp(arg, "start") == 0)
+    {
+        trace.setEnabled(false);
+        trace.clear();
+        trace.setEnabled(true);
+        outputStream << "Profiler trace started" << modm::endl;
+        return true;
+    }
+    else if (arg != nullptr && strcmp(arg, "stop") == 0)
+    {
+        trace.setEnabled(false);
+        outputStream << "Profiler trace stopped, " << trace.size() << " events" << modm::endl;
+        return true;
+    }
+    else if (arg != nullptr && strcmp(arg, "dump") == 0)
+    {
+        trace.setEnabled(false);
+        dumpTrace(outputStream);
+        return true;
+    }
+    else
+    {
+        outputStream << USAGE;
+        return false;
+    }
+}
+
+void ProfilerTerminalHandler::dumpTrace(modm::IOStream& outputStream)
+{
+    Profiler& profiler = drivers->profiler;
+    const ProfilerTrace& trace = profiler.getTrace();
+
+    outputStream << "profiler trace begin" << modm::endl;
+    outputStream << "frequency " << timebase::getTicksPerSecond() << modm::endl;
+    for (std::size_t key = 0; key < profiler.getNumProfiles(); key++)
+    {
+        outputStream << "name " << key << " " << profiler.getData(key).name << modm::endl;
+    }
+
+    for (std::size_t i = 0; i < trace.size(); i++)
+    {
+        const ProfilerTraceEvent& event = trace.getEvent(i);
+        outputStream << "event " << event.timestamp << " "
+                     << (event.type == ProfilerTraceEventType::BEGIN ? "B" : "E") << " "
+                     << event.key << " " << static_cast<uint32_t>(event.context)
+                     << modm::endl;
+    }
+
+    outputStream << "profiler trace end " << (trace.getTotalRecorded() - trace.size())
+                 << modm::endl;
+}
+#endif
+}  // namespace arch
+
+}  // namespace tap
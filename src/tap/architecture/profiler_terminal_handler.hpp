@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2026 Advanced Robotics at the University of Washington <robomstr@uw.edu>
+ *
+ * This file is part of Taproot.
+ *
+ * Taproot is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Taproot is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Taproot.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef TAPROOT_PROFILER_TERMINAL_HANDLER_HPP_
+#define TAPROOT_PROFILER_TERMINAL_HANDLER_HPP_
+
+#include "tap/communication/serial/terminal_serial.hpp"
+#include "tap/util_macros.hpp"
+
+#include "profiler.hpp"
+
+namespace tap
+{
+class Drivers;
+namespace arch
+{
+/**
+ * Terminal handler that prints the statistics of the drivers' Profiler and, when built with
+ * profiling, starts, stops and dumps its ProfilerTrace.
+ *
+ * A dump is plain text so it can be copied out of any serial terminal:
+ *
+ * ```
+ * profiler trace begin
+ * frequency <timebase ticks per second>
+ * name <key> <profile name>
+ * event <timestamp in ticks> <B|E> <key> <context>
+ * profiler trace end <number of events dropped>
+ * ```
+ *
+ * `build-tools/profiler_trace_to_chrome.py` converts a dump into a Chrome trace JSON file.
+ */
+class ProfilerTerminalHandler : public communication::serial::TerminalSerialCallbackInterface
+{
+public:
+    static constexpr char HEADER[] = "profiler";
+
+    ProfilerTerminalHandler(Drivers* drivers);
+    DISALLOW_COPY_AND_ASSIGN(ProfilerTerminalHandler);
+    mockable ~ProfilerTerminalHandler() = default;
+
+    mockable void init();
+
+    bool terminalSerialCallback(
+        char* inputLine,
+        modm::IOStream& outputStream,
+        bool streamingEnabled) override;
+
+    void terminalSerialStreamCallback(modm::IOStream& outputStream) override;
+
+private:
+    Drivers* drivers;
+
+    static constexpr char USAGE[] =
+        "Usage: profiler <target>\n"
+        "  Where \"<target>\" is one of:\n"
+        "    - \"-H\": displays possible commands.\n"
+        "    - \"stats\" prints min, max and average time (in microseconds) of all profiles.\n"
+#ifdef TAPROOT_PROFILER_TRACE
+        "    - \"trace start\" clears the trace and starts recording.\n"
+        "    - \"trace stop\" stops recording.\n"
+        "    - \"trace dump\" stops recording and prints the trace.\n"
+#endif
+        ;
+
+    void printStats(modm::IOStream& outputStream);
+
+#ifdef TAPROOT_PROFILER_TRACE
+    bool handleTraceCommand(char* inputLine, modm::IOStream& outputStream);
+
+    void dumpTrace(modm::IOStream& outputStream);
+#endif
+};
+}  // namespace arch
+
+}  // namespace tap
+
+#endif  // TAPROOT_PROFILER_TERMINAL_HANDLER_HPP_
@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2026 Advanced Robotics at the University of Washington <robomstr@uw.edu>
+ *
+ * This file is part of Taproot.
+ *
+ * Taproot is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Taproot is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Taproot.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef TAPROOT_PROFILER_TRACE_HPP_
+#define TAPROOT_PROFILER_TRACE_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace tap::arch
+{
+enum class ProfilerTraceEventType : uint8_t
+{
+    BEGIN = 0,
+    END,
+};
+
+/**
+ * A profile beginning or ending at some point in time, see ProfilerTrace.
+ */
+struct ProfilerTraceEvent
+{
+    /// Time of the event, in timebase ticks (see `timebase::getTicks`).
+    uint32_t timestamp;
+    /// Key of the profile in the Profiler.
+    uint16_t key;
+    ProfilerTraceEventType type;
+    /**
+     * The context the event was recorded from: 0 in thread mode, otherwise the active exception
+     * number (16 + IRQ number for interrupts), saturated at 255. Always 0 on hosted platforms.
+     */
+    uint8_t context;
+};
+static_assert(sizeof(ProfilerTraceEvent) == 8, "ProfilerTraceEvent must stay 8 bytes");
+
+/**
+ * A fixed-size ring buffer of timestamped begin/end events, giving a timeline of what ran when.
+ * Once full, the oldest events are overwritten.
+ *
+ * Recording is lock-free and may be done from interrupts as well as the main thread: a slot is
+ * reserved with a single atomic increment, then written. Reading is meant for a single reader in
+ * thread mode, e.g. a terminal command, and should be done while recording is disabled so events
+ * are not overwritten while they are read.
+ */
+class ProfilerTrace
+{
+public:
+    /// Number of events stored, a power of two.
+    static constexpr std::size_t CAPACITY = 1024;
+    static_assert((CAPACITY & (CAPACITY - 1)) == 0, "CAPACITY must be a power of two");
+
+    /**
+     * Records an event if recording is enabled.
+     */
+    inline void record(uint32_t timestamp, std::size_t key, ProfilerTraceEventType type)
+    {
+        if (!enabled.load(std::memory_order_relaxed))
+        {
+            return;
+        }
+
+        uint32_t index = writeIndex.fetch_add(1, std::memory_order_relaxed);
+        events[index & (CAPACITY - 1)] = {
+            timestamp,
+            static_cast<uint16_t>(key),
+            type,
+            getExecutionContext()};
+    }
+
+    inline void setEnabled(bool enable) { enabled.store(enable, std::memory_order_relaxed); }
+
+    inline bool isEnabled() const { return enabled.load(std::memory_order_relaxed); }
+
+    /// @return The number of events stored.
+    inline std::size_t size() const
+    {
+        uint32_t written = writeIndex.load(std::memory_order_relaxed);
+        return written < CAPACITY ? written : CAPACITY;
+    }
+
+    /// @return The number of events ever recorded, including ones that have been overwritten.
+    inline uint32_t getTotalRecorded() const { return writeIndex.load(std::memory_order_relaxed); }
+
+    /**
+     * @param[in] index Index of the event, where 0 is the oldest stored event. Must be less than
+     * `size()`.
+     */
+    inline const ProfilerTraceEvent &getEvent(std::size_t index) const
+    {
+        uint32_t written = writeIndex.load(std::memory_order_relaxed);
+        uint32_t oldest = written < CAPACITY ? 0 : written - CAPACITY;
+        return events[(oldest + index) & (CAPACITY - 1)];
+    }
+
+    /// Removes all stored events. Should only be called while recording is disabled.
+    inline void clear() { writeIndex.store(0, std::memory_order_relaxed); }
+
+    /// @return The context events recorded now are tagged with, see ProfilerTraceEvent.
+    static inline uint8_t getExecutionContext()
+    {
+#ifdef PLATFORM_HOSTED
+        return 0;
+#else
+        uint32_t ipsr;
+        asm volatile("mrs %0, ipsr" : "=r"(ipsr));
+        ipsr &= 0x1ff;
+        return ipsr > UINT8_MAX ? UINT8_MAX : static_cast<uint8_t>(ipsr);
+#endif
+    }
+
+private:
+    ProfilerTraceEvent events[CAPACITY];
+
+    std::atomic<uint32_t> writeIndex{0};
+
+    std::atomic<bool> enabled{false};
+};  // class ProfilerTrace
+}  // namespace tap::arch
+
+#endif  // TAPROOT_PROFILER_TRACE_HPP_
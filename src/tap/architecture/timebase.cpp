@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2026 Advanced Robotics at the University of Washington <robomstr@uw.edu>
+ *
+ * This file is part of Taproot.
+ *
+ * Taproot is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Taproot is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Taproot.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if defined(PLATFORM_HOSTED) && defined(ENV_UNIT_TESTS)
+
+#include "timebase.hpp"
+
+#include "modm/architecture/interface/assert.h"
+
+#include "clock.hpp"
+
+namespace tap::arch::timebase
+{
+static TimebaseStub *globalStubInstance = nullptr;
+
+TimebaseStub::TimebaseStub()
+{
+    modm_assert(
+        globalStubInstance == nullptr,
+        "TimebaseStub",
+        "multiple timebase stubs defined at the same time");
+    globalStubInstance = this;
+}
+TimebaseStub::~TimebaseStub() { globalStubInstance = nullptr; }
+
+uint32_t getTicks()
+{
+    return globalStubInstance == nullptr ? clock::getTimeMicroseconds() : globalStubInstance->ticks;
+}
+
+uint32_t getTicksPerSecond()
+{
+    return globalStubInstance == nullptr ? 1'000'000 : globalStubInstance->ticksPerSecond;
+}
+}  // namespace tap::arch::timebase
+
+#endif
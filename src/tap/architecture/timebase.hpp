@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2026 Advanced Robotics at the University of Washington <robomstr@uw.edu>
+ *
+ * This file is part of Taproot.
+ *
+ * Taproot is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Taproot is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Taproot.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef TAPROOT_TIMEBASE_HPP_
+#define TAPROOT_TIMEBASE_HPP_
+
+#include <cstdint>
+
+#ifndef PLATFORM_HOSTED
+#include "modm/platform.hpp"
+#elif !defined(ENV_UNIT_TESTS)
+#include <chrono>
+#endif
+
+/**
+ * A high resolution free-running tick counter for measuring short durations, such as how long a
+ * CRC or filter kernel takes. Used by the `Profiler`.
+ *
+ * - On target it is the Cortex-M DWT cycle counter, counting at the core clock frequency.
+ * - On hosted platforms it is `std::chrono::steady_clock`, counting nanoseconds.
+ * - In unit tests it is controlled by a `TimebaseStub`, or follows the `clock::ClockStub` at one
+ *   tick per microsecond if there is none.
+ *
+ * Ticks are 32-bit and wrap (every ~24 s at 180 MHz, ~4.3 s on hosted), so only differences
+ * between two reads are meaningful, and only for durations shorter than the wrap period. Use the
+ * `ticksTo*` functions to convert differences to time rather than assuming a tick rate.
+ */
+namespace tap::arch::timebase
+{
+#if defined(PLATFORM_HOSTED) && defined(ENV_UNIT_TESTS)
+/**
+ * Object that controls the ticks returned by `getTicks()` and their frequency in tests. Works like
+ * `clock::ClockStub`: only one may exist at a time, and it installs itself on construction and
+ * removes itself on destruction.
+ */
+class TimebaseStub final
+{
+public:
+    TimebaseStub();
+    ~TimebaseStub();
+    uint32_t ticks = 0;
+    uint32_t ticksPerSecond = 1'000'000;
+};
+
+/**
+ * Does nothing in unit tests.
+ */
+inline void initialize() {}
+
+uint32_t getTicks();
+
+uint32_t getTicksPerSecond();
+#elif defined(PLATFORM_HOSTED)
+inline void initialize() {}
+
+inline uint32_t getTicks()
+{
+    return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                     std::chrono::steady_clock::now().time_since_epoch())
+                                     .count());
+}
+
+inline uint32_t getTicksPerSecond() { return 1'000'000'000; }
+#else
+/**
+ * Enables the cycle counter. Safe to call more than once. The `Profiler` calls this when
+ * constructed, other users must call it before `getTicks()`.
+ */
+inline void initialize()
+{
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+inline uint32_t getTicks() { return DWT->CYCCNT; }
+
+inline uint32_t getTicksPerSecond() { return SystemCoreClock; }
+#endif
+
+/**
+ * @return The number of whole microseconds in a duration of `ticks`. Valid for durations of up to
+ * ~28 hours at 180 MHz.
+ */
+inline uint64_t ticksToMicroseconds(uint64_t ticks)
+{
+    return ticks * 1'000'000 / getTicksPerSecond();
+}
+
+/**
+ * @return A duration of `ticks` in microseconds, including the fraction of a microsecond.
+ */
+inline float ticksToMicrosecondsFloat(uint64_t ticks)
+{
+    return static_cast<float>(ticks) * (1'000'000.0f / static_cast<float>(getTicksPerSecond()));
+}
+
+/**
+ * @return The number of whole nanoseconds in a duration of `ticks`. Valid for durations of up to
+ * ~100 seconds at 180 MHz.
+ */
+inline uint64_t ticksToNanoseconds(uint64_t ticks)
+{
+    return ticks * 1'000'000'000 / getTicksPerSecond();
+}
+}  // namespace tap::arch::timebase
+
+#endif  // TAPROOT_TIMEBASE_HPP_
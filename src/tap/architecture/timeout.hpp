@@ -30,24 +30,33 @@ namespace arch
 {
 /**
  * A class for keeping track of a timer that expires. Template argument
- * expects a function pointer that returns a uin32_t representing some absolute
- * measure of time.
+ * expects a function pointer that returns an unsigned integer (`uint32_t` or
+ * `uint64_t`) representing some absolute measure of time.
+ *
+ * Times are compared directly, so a timer running across a wrap of the time
+ * function misfires. `getTimeMicroseconds()` wraps every ~71 minutes; use the
+ * `*64` timers, built on `getTimeMicroseconds64()`, for anything that may run
+ * longer than that.
  *
  * Doesn't start until `restart()` is called
  */
-template <uint32_t (*T)()>
+template <auto T>
 class Timeout
 {
     template <typename H>
     friend class PeriodicTimer;
 
+public:
+    static constexpr auto TimeFunc = T;
+    /// Type of the times and durations this timeout works with.
+    using TimeType = decltype(T());
+
 private:
     bool isRunning;
     bool isExecuted;
-    uint32_t expireTime;
+    TimeType expireTime;
 
 public:
-    static constexpr auto TimeFunc = T;
 
     Timeout()
     {
@@ -55,7 +64,7 @@ class Timeout
         this->expireTime = 0;
     }
 
-    explicit Timeout(uint32_t timeout) { restart(timeout); }
+    explicit Timeout(TimeType timeout) { restart(timeout); }
 
     /**
      * Set the timer to expire in `timeout` units of time.
@@ -63,7 +72,7 @@ class Timeout
      * @param[in] timeout: the amount of time from when this function
      * is called that the timer should expire.
      */
-    inline void restart(uint32_t timeout)
+    inline void restart(TimeType timeout)
     {
         this->isRunning = true;
         this->isExecuted = false;
@@ -93,7 +102,7 @@ class Timeout
     /**
      * @return time left in timer if still running and not yet expired
      */
-    inline uint32_t timeRemaining() const
+    inline TimeType timeRemaining() const
     {
         if (this->isRunning && TimeFunc() < this->expireTime)
             return this->expireTime - TimeFunc();
@@ -122,6 +131,8 @@ class Timeout
 
 using MicroTimeout = Timeout<tap::arch::clock::getTimeMicroseconds>;
 using MilliTimeout = Timeout<tap::arch::clock::getTimeMilliseconds>;
+/// A microsecond timeout that does not wrap, see `clock::getTimeMicroseconds64()`.
+using MicroTimeout64 = Timeout<tap::arch::clock::getTimeMicroseconds64>;
 }  // namespace arch
 }  // namespace tap
 
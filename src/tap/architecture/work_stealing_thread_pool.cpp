@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2026 Advanced Robotics at the University of Washington <robomstr@uw.edu>
+ *
+ * This file is part of Taproot.
+ *
+ * Taproot is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Taproot is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Taproot.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifdef PLATFORM_HOSTED
+
+#include "work_stealing_thread_pool.hpp"
+
+namespace tap::arch
+{
+WorkStealingThreadPool::WorkStealingThreadPool(int numThreads)
+    : ranges(numThreads < 1 ? 1 : numThreads)
+{
+    // Thread 0 is the caller of run()
+    for (int i = 1; i < getNumThreads(); i++)
+    {
+        workers.emplace_back(&WorkStealingThreadPool::workerLoop, this, i);
+    }
+}
+
+WorkStealingThreadPool::~WorkStealingThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    batchReady.notify_all();
+
+    for (auto &worker : workers)
+    {
+        worker.join();
+    }
+}
+
+void WorkStealingThreadPool::run(int numTasks, const std::function<void(int)> &task)
+{
+    if (numTasks <= 0)
+    {
+        return;
+    }
+
+    if (workers.empty() || numTasks == 1)
+    {
+        for (int i = 0; i < numTasks; i++)
+        {
+            task(i);
+        }
+        return;
+    }
+
+    const int numThreads = getNumThreads();
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (int i = 0; i < numThreads; i++)
+        {
+            ranges[i].next.store(numTasks * i / numThreads, std::memory_order_relaxed);
+            ranges[i].end = numTasks * (i + 1) / numThreads;
+        }
+        currentTask = &task;
+        finishedWorkers = 0;
+        batchGeneration++;
+    }
+    batchReady.notify_all();
+
+    executeTasks(0);
+
+    // Workers may still be running tasks they took before the ranges emptied
+    std::unique_lock<std::mutex> lock(mutex);
+    workerFinished.wait(lock, [&] { return finishedWorkers == static_cast<int>(workers.size()); });
+    currentTask = nullptr;
+}
+
+void WorkStealingThreadPool::workerLoop(int threadIndex)
+{
+    uint64_t seenGeneration = 0;
+
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            batchReady.wait(lock, [&] { return stopping || batchGeneration != seenGeneration; });
+            if (stopping)
+            {
+                return;
+            }
+            seenGeneration = batchGeneration;
+        }
+
+        executeTasks(threadIndex);
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            finishedWorkers++;
+        }
+        workerFinished.notify_one();
+    }
+}
+
+void WorkStealingThreadPool::executeTasks(int threadIndex)
+{
+    const int numThreads = getNumThreads();
+    const std::function<void(int)> &task = *currentTask;
+
+    // Start with our own range, then move on to the other threads' ranges in turn
+    for (int offset = 0; offset < numThreads; offset++)
+    {
+        TaskRange &range = ranges[(threadIndex + offset) % numThreads];
+
+        int i;
+        while ((i = range.next.fetch_add(1, std::memory_order_relaxed)) < range.end)
+        {
+            task(i);
+        }
+    }
+}
+}  // namespace tap::arch
+
+#endif  // PLATFORM_HOSTED
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2026 Advanced Robotics at the University of Washington <robomstr@uw.edu>
+ *
+ * This file is part of Taproot.
+ *
+ * Taproot is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Taproot is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Taproot.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef TAPROOT_WORK_STEALING_THREAD_POOL_HPP_
+#define TAPROOT_WORK_STEALING_THREAD_POOL_HPP_
+
+#ifdef PLATFORM_HOSTED
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "tap/util_macros.hpp"
+
+namespace tap::arch
+{
+/**
+ * A small fork-join thread pool for hosted builds. `run()` executes a batch of independent
+ * tasks, identified by index, on the calling thread plus `numThreads - 1` worker threads and
+ * returns once every task has finished.
+ *
+ * Each batch is split into one contiguous range of task indices per thread. A thread works
+ * through its own range and, once it is empty, steals the remaining tasks from other threads'
+ * ranges, so uneven task costs are balanced without a shared queue.
+ *
+ * Only one thread may call `run()` at a time.
+ */
+class WorkStealingThreadPool
+{
+public:
+    /**
+     * @param[in] numThreads The total number of threads that execute tasks, including the thread
+     * calling `run()`. Values less than 1 are treated as 1, in which case `run()` executes every
+     * task on the calling thread.
+     */
+    explicit WorkStealingThreadPool(int numThreads);
+    DISALLOW_COPY_AND_ASSIGN(WorkStealingThreadPool);
+    ~WorkStealingThreadPool();
+
+    /**
+     * Calls `task(i)` exactly once for each `i` in `[0, numTasks)`, in no particular order and
+     * possibly concurrently, then returns.
+     */
+    void run(int numTasks, const std::function<void(int)> &task);
+
+    /// @return The number of threads, including the caller, that execute tasks.
+    int getNumThreads() const { return static_cast<int>(ranges.size()); }
+
+private:
+    /**
+     * A thread's share of the current batch. `next` is advanced atomically both by the owning
+     * thread and by thieves.
+     */
+    struct alignas(64) TaskRange
+    {
+        std::atomic<int> next{0};
+        int end = 0;
+    };
+
+    std::vector<TaskRange> ranges;
+
+    std::vector<std::thread> workers;
+
+    std::mutex mutex;
+
+    /// Signals workers that a new batch is ready or that the pool is shutting down.
+    std::condition_variable batchReady;
+
+    /// Signals the caller of `run()` that a worker finished its part of the batch.
+    std::condition_variable workerFinished;
+
+    /// Incremented each time a batch is started.
+    uint64_t batchGeneration = 0;
+
+    /// The number of workers that have finished the current batch.
+    int finishedWorkers = 0;
+
+    bool stopping = false;
+
+    const std::function<void(int)> *currentTask = nullptr;
+
+    void workerLoop(int threadIndex);
+
+    /**
+     * Runs tasks from the range of `threadIndex`, then steals from the others until every range
+     * is empty.
+     */
+    void executeTasks(int threadIndex);
+};  // class WorkStealingThreadPool
+}  // namespace tap::arch
+
+#endif  // PLATFORM_HOSTED
+
+#endif  // TAPROOT_WORK_STEALING_THREAD_POOL_HPP_
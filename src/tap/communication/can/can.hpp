@@ -20,9 +20,13 @@
 #ifndef TAPROOT_CAN_HPP_
 #define TAPROOT_CAN_HPP_
 
+#include <cstdint>
+
 #include "tap/util_macros.hpp"
 
 #include "can_bus.hpp"
+#include "can_bus_load_monitor.hpp"
+#include "can_capture.hpp"
 
 namespace modm::can
 {
@@ -33,8 +37,15 @@ namespace tap
 {
 namespace can
 {
+#ifdef PLATFORM_HOSTED
+class VirtualCanBus;
+#endif
+
 /**
  * A simple CAN wrapper class that handles I/O from both CAN bus 1 and 2.
+ *
+ * In hosted builds, each bus is an in-process `VirtualCanBus` that the robot code talks to
+ * through a simulated peripheral, see `getVirtualBus`.
  */
 class Can
 {
@@ -68,13 +79,22 @@ class Can
      * acquired, returns true and places the message in the return parameter
      * message.
      *
+     * Frames are taken out of the peripheral by the CAN receive interrupt as
+     * soon as they arrive, timestamped, and kept in a `CanRxRing` until read
+     * here.
+     *
      * @param[in] bus the CanBus to acquire a message from.
      * @param[out] message a return parameter which the message is
      *      placed in.
+     * @param[out] arrivalTime if not `nullptr`, set to the time the message
+     *      arrived, in microseconds (see `tap::arch::clock::getTimeMicroseconds`).
      * @return true if a valid message was placed in the parameter
      *      message. False otherwise.
      */
-    mockable bool getMessage(CanBus bus, modm::can::Message *message);
+    mockable bool getMessage(
+        CanBus bus,
+        modm::can::Message *message,
+        uint32_t *arrivalTime = nullptr);
 
     /**
      * Checks the given CanBus to see if the CanBus is idle.
@@ -99,6 +119,58 @@ class Can
      * @return true if the message was successfully sent, false otherwise.
      */
     mockable bool sendMessage(CanBus bus, const modm::can::Message &message);
+
+    /**
+     * @param[in] bus the CanBus to check.
+     * @return the bus's transmit error counter, as kept by the CAN peripheral. The peripheral
+     *      goes error passive once this passes 127 and bus off once it passes 255.
+     */
+    mockable uint8_t getTransmitErrorCount(CanBus bus) const;
+
+    /**
+     * @param[in] bus the CanBus to check.
+     * @return the bus's receive error counter, as kept by the CAN peripheral.
+     */
+    mockable uint8_t getReceiveErrorCount(CanBus bus) const;
+
+    /**
+     * @param[in] bus the CanBus to check.
+     * @return the number of received frames lost because the receive ring or the peripheral's
+     *      FIFO was full, i.e. `getMessage` was not called often enough.
+     */
+    mockable uint32_t getRxOverflowCount(CanBus bus) const;
+
+    /**
+     * @return the monitor every frame passed to `sendMessage` and every frame received by the
+     *      `CanRxHandler` is recorded into.
+     */
+    CanBusLoadMonitor &getBusLoadMonitor() { return busLoadMonitor; }
+
+    /**
+     * Sets the capture that frames sent by `sendMessage` and received by the `CanRxHandler` are
+     * recorded into, while it is running.
+     *
+     * @param[in] capture The capture to record into, or `nullptr` (the default) to stop recording.
+     */
+    void setCapture(CanCapture *capture) { this->capture = capture; }
+
+    /// @return The capture frames are being recorded into, or `nullptr` if there is none.
+    CanCapture *getCapture() const { return capture; }
+
+#ifdef PLATFORM_HOSTED
+    /**
+     * @return the in-process bus that `bus` is connected to in hosted builds. Simulated devices,
+     *      such as `DjiMotorSimNode` and `RevMotorSimNode`, and the `SocketCanBridge` attach to
+     *      it as nodes. A `DjiMotorSimNode` for the sims registered with
+     *      `DjiMotorSimHandler::getInstance()` is always attached.
+     */
+    static VirtualCanBus &getVirtualBus(CanBus bus);
+#endif
+
+private:
+    CanBusLoadMonitor busLoadMonitor;
+
+    CanCapture *capture = nullptr;
 };  // class Can
 
 }  // namespace can
@@ -0,0 +1,291 @@
+/*
+ * Copyright (c) 2026 Advanced Robotics at the University of Washington <robomstr@uw.edu>
+ *
+ * This file is part of Taproot.
+ *
+ * Taproot is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Taproot is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Taproot.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "can_bus_load_monitor.hpp"
+
+#include <algorithm>
+
+#include "tap/architecture/clock.hpp"
+
+#include "modm/architecture/interface/can_message.hpp"
+
+namespace tap::can
+{
+namespace
+{
+/**
+ * Counts the stuff bits and computes the CRC of a frame as its bits are fed in, most significant
+ * bit first.
+ */
+class FrameBitCounter
+{
+public:
+    /// Adds `count` bits of `value` that are covered by the CRC.
+    void addBits(uint32_t value, uint8_t count)
+    {
+        for (int i = count - 1; i >= 0; i--)
+        {
+            bool bit = (value >> i) & 1;
+            bool crcNext = bit != ((crc >> 14) & 1);
+            crc = (crc << 1) & 0x7fff;
+            if (crcNext)
+            {
+                crc ^= CRC_POLYNOMIAL;
+            }
+            addStuffedBit(bit);
+        }
+    }
+
+    /// Adds the CRC computed so far, then returns the total number of bits added, stuff bits
+    /// included.
+    uint16_t finish()
+    {
+        uint16_t frameCrc = crc;
+        for (int i = 14; i >= 0; i--)
+        {
+            addStuffedBit((frameCrc >> i) & 1);
+        }
+        // A run of 5 at the end of the CRC is still followed by a stuff bit
+        if (run == 5)
+        {
+            bits++;
+        }
+        return bits;
+    }
+
+private:
+    static constexpr uint16_t CRC_POLYNOMIAL = 0x4599;
+
+    uint16_t crc = 0;
+    uint16_t bits = 0;
+    uint8_t run = 0;
+    bool last = false;
+
+    void addStuffedBit(bool bit)
+    {
+        if (run == 5)
+        {
+            // Stuff bit, the complement of the previous 5
+            bits++;
+            last = !last;
+            run = 1;
+        }
+
+        if (run != 0 && bit == last)
+        {
+            run++;
+        }
+        else
+        {
+            last = bit;
+            run = 1;
+        }
+        bits++;
+    }
+};
+}  // namespace
+
+CanBusLoadMonitor::CanBusLoadMonitor() { reset(); }
+
+void CanBusLoadMonitor::recordTx(CanBus bus, const modm::can::Message &message, bool sent)
+{
+    if (sent)
+    {
+        record(bus, message, true);
+    }
+    else
+    {
+        buses[static_cast<int>(bus)].stats.txFailures++;
+    }
+}
+
+void CanBusLoadMonitor::recordRx(CanBus bus, const modm::can::Message &message)
+{
+    record(bus, message, false);
+}
+
+void CanBusLoadMonitor::record(CanBus bus, const modm::can::Message &message, bool transmit)
+{
+    advanceWindow();
+
+    uint16_t frameBits = getFrameBits(message);
+
+    BusCounters &counters = buses[static_cast<int>(bus)];
+    if (transmit)
+    {
+        counters.stats.txFrames++;
+    }
+    else
+    {
+        counters.stats.rxFrames++;
+    }
+    counters.stats.totalBits += frameBits;
+    counters.bucketBits[currentBucket] += frameBits;
+
+    TrackedId *tracked = findOrTrackId(bus, message, transmit);
+    if (tracked != nullptr)
+    {
+        tracked->stats.frames++;
+        tracked->stats.bitsPerFrame = frameBits;
+        tracked->bucketFrames[currentBucket]++;
+    }
+    else
+    {
+        untrackedFrames++;
+    }
+}
+
+CanBusLoadMonitor::TrackedId *CanBusLoadMonitor::findOrTrackId(
+    CanBus bus,
+    const modm::can::Message &message,
+    bool transmit)
+{
+    for (uint8_t i = 0; i < numTrackedIds; i++)
+    {
+        IdStats &stats = trackedIds[i].stats;
+        if (stats.identifier == message.getIdentifier() && stats.bus == bus &&
+            stats.extended == message.isExtended() && stats.transmit == transmit)
+        {
+            return &trackedIds[i];
+        }
+    }
+
+    if (numTrackedIds == MAX_TRACKED_IDS)
+    {
+        return nullptr;
+    }
+
+    TrackedId &tracked = trackedIds[numTrackedIds++];
+    tracked = {};
+    tracked.stats.identifier = message.getIdentifier();
+    tracked.stats.bus = bus;
+    tracked.stats.extended = message.isExtended();
+    tracked.stats.transmit = transmit;
+    return &tracked;
+}
+
+CanBusLoadMonitor::BusStats CanBusLoadMonitor::getBusStats(CanBus bus)
+{
+    advanceWindow();
+
+    const BusCounters &counters = buses[static_cast<int>(bus)];
+    BusStats stats = counters.stats;
+    stats.windowBits = sumWindow(counters.bucketBits);
+    stats.utilization = getUtilization(counters);
+    return stats;
+}
+
+CanBusLoadMonitor::IdStats CanBusLoadMonitor::getIdStats(uint8_t index)
+{
+    advanceWindow();
+
+    const TrackedId &tracked = trackedIds[index];
+    IdStats stats = tracked.stats;
+    stats.framesPerWindow = sumWindow(tracked.bucketFrames);
+    return stats;
+}
+
+void CanBusLoadMonitor::reset()
+{
+    for (BusCounters &counters : buses)
+    {
+        counters = {};
+    }
+    numTrackedIds = 0;
+    untrackedFrames = 0;
+    currentBucket = 0;
+    currentBucketStart = arch::clock::getTimeMilliseconds();
+}
+
+void CanBusLoadMonitor::advanceWindow()
+{
+    uint32_t elapsedBuckets =
+        (arch::clock::getTimeMilliseconds() - currentBucketStart) / BUCKET_PERIOD_MS;
+    if (elapsedBuckets == 0)
+    {
+        return;
+    }
+
+    currentBucketStart += elapsedBuckets * BUCKET_PERIOD_MS;
+
+    for (uint32_t i = 0; i < std::min(elapsedBuckets, NUM_BUCKETS); i++)
+    {
+        currentBucket = (currentBucket + 1) % NUM_BUCKETS;
+
+        for (BusCounters &counters : buses)
+        {
+            counters.bucketBits[currentBucket] = 0;
+            if (i == 0)
+            {
+                // Only the first step completes a window with data in every bucket
+                counters.stats.peakUtilization =
+                    std::max(counters.stats.peakUtilization, getUtilization(counters));
+            }
+        }
+        for (uint8_t id = 0; id < numTrackedIds; id++)
+        {
+            trackedIds[id].bucketFrames[currentBucket] = 0;
+        }
+    }
+}
+
+float CanBusLoadMonitor::getUtilization(const BusCounters &counters) const
+{
+    static constexpr float BITS_PER_WINDOW = static_cast<float>(BITRATE) * WINDOW_MS / 1000.0f;
+    return sumWindow(counters.bucketBits) / BITS_PER_WINDOW;
+}
+
+uint16_t CanBusLoadMonitor::getFrameBits(const modm::can::Message &message)
+{
+    FrameBitCounter counter;
+
+    uint32_t identifier = message.getIdentifier();
+    bool remote = message.isRemoteTransmitRequest();
+    uint8_t length = std::min<uint8_t>(message.getLength(), 8);
+
+    // Start of frame
+    counter.addBits(0, 1);
+    if (message.isExtended())
+    {
+        // Base identifier, SRR, IDE, extended identifier, RTR, r1, r0
+        counter.addBits((identifier >> 18) & 0x7ff, 11);
+        counter.addBits(0b11, 2);
+        counter.addBits(identifier & 0x3ffff, 18);
+        counter.addBits(remote, 1);
+        counter.addBits(0b00, 2);
+    }
+    else
+    {
+        // Identifier, RTR, IDE, r0
+        counter.addBits(identifier & 0x7ff, 11);
+        counter.addBits(remote, 1);
+        counter.addBits(0b00, 2);
+    }
+    counter.addBits(length, 4);
+    if (!remote)
+    {
+        for (uint8_t i = 0; i < length; i++)
+        {
+            counter.addBits(message.data[i], 8);
+        }
+    }
+
+    return counter.finish() + FRAME_TRAILER_BITS;
+}
+}  // namespace tap::can
@@ -0,0 +1,223 @@
+/*
+ * Copyright (c) 2026 Advanced Robotics at the University of Washington <robomstr@uw.edu>
+ *
+ * This file is part of Taproot.
+ *
+ * Taproot is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Taproot is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Taproot.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef TAPROOT_CAN_BUS_LOAD_MONITOR_HPP_
+#define TAPROOT_CAN_BUS_LOAD_MONITOR_HPP_
+
+#include <cstdint>
+
+#include "tap/util_macros.hpp"
+
+#include "can_bus.hpp"
+
+namespace modm::can
+{
+class Message;
+}
+
+namespace tap::can
+{
+/**
+ * Keeps track of how much of each CAN bus is in use, so bus bandwidth can be budgeted before a
+ * device is added to a bus that is already close to saturated.
+ *
+ * `Can::sendMessage` records every frame sent and `CanRxHandler` every frame received. Each
+ * frame is counted as the number of bits it takes up on the wire: the header, data and CRC with
+ * the stuff bits they need, plus the CRC delimiter, ACK, end of frame and interframe space.
+ *
+ * Utilization is measured over a sliding window of `WINDOW_MS`, made of `NUM_WINDOW_BUCKETS`
+ * buckets that are advanced as frames are recorded or stats are read. Frame rates are kept for
+ * the first `MAX_TRACKED_IDS` (bus, identifier, direction) combinations seen, frames with any
+ * other combination are only counted in the bus totals.
+ */
+class CanBusLoadMonitor
+{
+public:
+    /// Number of CAN buses monitored.
+    static constexpr int NUM_CAN_BUSES = 2;
+
+    /// Bit rate both buses are configured to run at, see `Can::initialize`.
+    static constexpr uint32_t BITRATE = 1'000'000;
+
+    /// Length of the window utilization and frame rates are measured over.
+    static constexpr uint32_t WINDOW_MS = 1000;
+
+    /// Number of buckets the window is split into.
+    static constexpr uint32_t NUM_WINDOW_BUCKETS = 10;
+
+    static constexpr uint32_t BUCKET_PERIOD_MS = WINDOW_MS / NUM_WINDOW_BUCKETS;
+
+    /// Max number of (bus, identifier, direction) combinations frame rates are kept for.
+    static constexpr uint8_t MAX_TRACKED_IDS = 32;
+
+    /**
+     * Bits after the CRC that are never stuffed: CRC delimiter, ACK slot and delimiter, 7 bit end
+     * of frame and 3 bit interframe space.
+     */
+    static constexpr uint16_t FRAME_TRAILER_BITS = 13;
+
+    /**
+     * Totals for a single bus, see `getBusStats`.
+     */
+    struct BusStats
+    {
+        /// Frames successfully handed to the CAN peripheral.
+        uint32_t txFrames = 0;
+        /// Frames `Can::sendMessage` failed to send, typically because all TX mailboxes were full.
+        uint32_t txFailures = 0;
+        /// Frames received.
+        uint32_t rxFrames = 0;
+        /// Total bits on the wire of every frame sent or received.
+        uint64_t totalBits = 0;
+        /// Bits on the wire during the most recent window.
+        uint32_t windowBits = 0;
+        /// Fraction of the bus in use during the most recent window, in [0, 1].
+        float utilization = 0;
+        /// Highest utilization of any window since the last `reset`.
+        float peakUtilization = 0;
+    };
+
+    /**
+     * Traffic of a single (bus, identifier, direction) combination, see `getIdStats`.
+     */
+    struct IdStats
+    {
+        uint32_t identifier = 0;
+        CanBus bus = CanBus::CAN_BUS1;
+        bool extended = false;
+        /// `true` for frames sent by `Can::sendMessage`, `false` for frames received.
+        bool transmit = false;
+        /// Bits on the wire of the most recent frame.
+        uint16_t bitsPerFrame = 0;
+        /// Total number of frames.
+        uint32_t frames = 0;
+        /// Number of frames during the most recent window, equal to frames per second.
+        uint32_t framesPerWindow = 0;
+    };
+
+    CanBusLoadMonitor();
+    DISALLOW_COPY_AND_ASSIGN(CanBusLoadMonitor)
+
+    /**
+     * Records a frame passed to `Can::sendMessage`.
+     *
+     * @param[in] sent `true` if the frame was handed to the peripheral. Frames that were not are
+     *      counted as failures and not included in the bus load.
+     */
+    void recordTx(CanBus bus, const modm::can::Message &message, bool sent);
+
+    /**
+     * Records a frame received on `bus`.
+     */
+    void recordRx(CanBus bus, const modm::can::Message &message);
+
+    /**
+     * @return The totals and utilization of `bus` as of now.
+     */
+    BusStats getBusStats(CanBus bus);
+
+    /// @return The number of (bus, identifier, direction) combinations tracked.
+    inline uint8_t getNumTrackedIds() const { return numTrackedIds; }
+
+    /**
+     * @param[in] index Index of the tracked combination, in the order they were first seen. Must
+     *      be less than `getNumTrackedIds()`.
+     */
+    IdStats getIdStats(uint8_t index);
+
+    /// @return The number of frames not tracked per identifier because the table was full.
+    inline uint32_t getUntrackedFrames() const { return untrackedFrames; }
+
+    /// Clears all counters and tracked identifiers.
+    void reset();
+
+    /**
+     * @return The number of bits `message` takes up on the wire, including stuff bits and
+     *      `FRAME_TRAILER_BITS`. Stuff bits are counted exactly, from the frame's contents and CRC.
+     */
+    static uint16_t getFrameBits(const modm::can::Message &message);
+
+    /**
+     * @return The most bits a data frame with `length` data bytes can take up on the wire,
+     *      assuming the worst possible bit stuffing. Useful for budgeting bandwidth ahead of time.
+     */
+    static constexpr uint16_t getWorstCaseFrameBits(uint8_t length, bool extended)
+    {
+        // SOF, arbitration, control, data and CRC fields, which are all stuffed
+        uint16_t stuffedBits = (extended ? 54 : 34) + 8 * length;
+        return stuffedBits + (stuffedBits - 1) / 4 + FRAME_TRAILER_BITS;
+    }
+
+private:
+    /// The window's buckets plus the one currently being filled.
+    static constexpr uint32_t NUM_BUCKETS = NUM_WINDOW_BUCKETS + 1;
+
+    struct TrackedId
+    {
+        IdStats stats;
+        uint16_t bucketFrames[NUM_BUCKETS];
+    };
+
+    struct BusCounters
+    {
+        BusStats stats;
+        uint32_t bucketBits[NUM_BUCKETS];
+    };
+
+    BusCounters buses[NUM_CAN_BUSES];
+
+    TrackedId trackedIds[MAX_TRACKED_IDS];
+
+    uint8_t numTrackedIds = 0;
+
+    uint32_t untrackedFrames = 0;
+
+    /// Index of the bucket frames are currently recorded into.
+    uint32_t currentBucket = 0;
+
+    /// Time the current bucket started, in milliseconds.
+    uint32_t currentBucketStart;
+
+    /**
+     * Moves to the bucket that covers the current time, clearing every bucket skipped over and
+     * updating peak utilization with each window that completes.
+     */
+    void advanceWindow();
+
+    void record(CanBus bus, const modm::can::Message &message, bool transmit);
+
+    TrackedId *findOrTrackId(CanBus bus, const modm::can::Message &message, bool transmit);
+
+    /// @return The sum of every bucket except the current one, which is still being filled.
+    template <typename T>
+    uint32_t sumWindow(const T (&buckets)[NUM_BUCKETS]) const
+    {
+        uint32_t sum = 0;
+        for (uint32_t i = 0; i < NUM_BUCKETS; i++)
+        {
+            sum += i == currentBucket ? 0 : buckets[i];
+        }
+        return sum;
+    }
+
+    float getUtilization(const BusCounters &bus) const;
+};  // class CanBusLoadMonitor
+}  // namespace tap::can
+
+#endif  // TAPROOT_CAN_BUS_LOAD_MONITOR_HPP_
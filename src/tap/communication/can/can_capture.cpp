@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2026 Advanced Robotics at the University of Washington <robomstr@uw.edu>
+ *
+ * This file is part of Taproot.
+ *
+ * Taproot is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Taproot is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Taproot.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "can_capture.hpp"
+
+#include <cstdio>
+
+namespace tap::can
+{
+int CanCapture::formatRecord(const CanCaptureRecord &record, char *buffer, std::size_t size)
+{
+    if (size < MAX_LOG_LINE_LENGTH)
+    {
+        return 0;
+    }
+
+    int written = snprintf(
+        buffer,
+        size,
+        (record.flags & CanCaptureRecord::FLAG_EXTENDED) ? "(%lu.%06lu) can%d %08lX#"
+                                                          : "(%lu.%06lu) can%d %03lX#",
+        static_cast<unsigned long>(record.timestamp / 1'000'000),
+        static_cast<unsigned long>(record.timestamp % 1'000'000),
+        record.getBus() == CanBus::CAN_BUS1 ? 1 : 2,
+        static_cast<unsigned long>(record.identifier));
+
+    if (record.flags & CanCaptureRecord::FLAG_REMOTE)
+    {
+        written += snprintf(buffer + written, size - written, "R");
+    }
+    else
+    {
+        for (uint8_t i = 0; i < record.length && i < sizeof(record.data); i++)
+        {
+            written += snprintf(buffer + written, size - written, "%02X", record.data[i]);
+        }
+    }
+
+    written += snprintf(buffer + written, size - written, record.isTransmit() ? " T\n" : " R\n");
+    return written;
+}
+}  // namespace tap::can
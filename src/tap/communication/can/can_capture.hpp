@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) 2026 Advanced Robotics at the University of Washington <robomstr@uw.edu>
+ *
+ * This file is part of Taproot.
+ *
+ * Taproot is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Taproot is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Taproot.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef TAPROOT_CAN_CAPTURE_HPP_
+#define TAPROOT_CAN_CAPTURE_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include "tap/util_macros.hpp"
+
+#include "modm/architecture/interface/can_message.hpp"
+
+#include "can_bus.hpp"
+
+namespace tap::can
+{
+/**
+ * A single frame recorded by a CanCapture.
+ */
+struct CanCaptureRecord
+{
+    /// Set in `flags` for frames sent by this board, clear for frames it received.
+    static constexpr uint8_t FLAG_TRANSMIT = 1 << 0;
+    static constexpr uint8_t FLAG_EXTENDED = 1 << 1;
+    static constexpr uint8_t FLAG_REMOTE = 1 << 2;
+    /// Set in `flags` for frames on CAN 2, clear for CAN 1.
+    static constexpr uint8_t FLAG_CAN_BUS2 = 1 << 3;
+
+    /// Time the frame was sent or received, in microseconds.
+    uint32_t timestamp;
+    uint32_t identifier;
+    uint8_t data[8];
+    uint8_t length;
+    uint8_t flags;
+
+    inline CanBus getBus() const
+    {
+        return (flags & FLAG_CAN_BUS2) ? CanBus::CAN_BUS2 : CanBus::CAN_BUS1;
+    }
+
+    inline bool isTransmit() const { return (flags & FLAG_TRANSMIT) != 0; }
+};
+static_assert(sizeof(CanCaptureRecord) == 20, "CanCaptureRecord must stay 20 bytes");
+
+/**
+ * A fixed-size ring buffer that records the frames sent and received on both CAN buses, to be
+ * saved as a log after a match. Once full, the oldest frames are overwritten. Recording never
+ * allocates. Set the capture with `Can::setCapture`; frames are recorded by `Can::sendMessage`
+ * and `CanRxHandler::pollCanData`, from the main loop only.
+ *
+ * Logs are written in the format of `candump -l` (see `formatRecord`), so they can be read by
+ * can-utils (`canplayer`, `log2asc`), Wireshark, python-can and `CanLogReplayer`. Dump them with
+ * the `can capture dump` terminal command.
+ *
+ * The storage is provided by the caller, use StaticCanCapture to have it allocated inline.
+ */
+class CanCapture
+{
+public:
+    /// Longest line `formatRecord` writes, including the newline and null terminator.
+    static constexpr std::size_t MAX_LOG_LINE_LENGTH = 64;
+
+    /**
+     * @param[in] storage Buffer frames are recorded into, must outlive the capture.
+     * @param[in] capacity Number of frames `storage` can hold, must be > 0.
+     */
+    CanCapture(CanCaptureRecord *storage, std::size_t capacity)
+        : storage(storage),
+          capacity(capacity)
+    {
+    }
+    DISALLOW_COPY_AND_ASSIGN(CanCapture)
+
+    /// Starts or resumes recording frames. Frames already stored are kept.
+    inline void start() { running = true; }
+
+    /// Stops recording frames, keeping the ones recorded.
+    inline void stop() { running = false; }
+
+    inline bool isRunning() const { return running; }
+
+    /**
+     * Appends a frame, overwriting the oldest one if the capture is full. Does nothing if the
+     * capture is stopped.
+     *
+     * @param[in] timestamp Time the frame was sent or received, in microseconds.
+     * @param[in] transmit `true` if this board sent the frame.
+     */
+    inline void record(
+        CanBus bus,
+        const modm::can::Message &message,
+        uint32_t timestamp,
+        bool transmit)
+    {
+        if (!running)
+        {
+            return;
+        }
+
+        CanCaptureRecord &record = storage[next];
+        record.timestamp = timestamp;
+        record.identifier = message.getIdentifier();
+        record.length = message.getLength();
+        record.flags = (transmit ? CanCaptureRecord::FLAG_TRANSMIT : 0) |
+                       (message.isExtended() ? CanCaptureRecord::FLAG_EXTENDED : 0) |
+                       (message.isRemoteTransmitRequest() ? CanCaptureRecord::FLAG_REMOTE : 0) |
+                       (bus == CanBus::CAN_BUS2 ? CanCaptureRecord::FLAG_CAN_BUS2 : 0);
+        std::memcpy(record.data, message.data, sizeof(record.data));
+
+        next = next + 1 == capacity ? 0 : next + 1;
+        totalRecorded++;
+    }
+
+    /// @return The number of frames currently stored.
+    inline std::size_t size() const
+    {
+        return totalRecorded < capacity ? static_cast<std::size_t>(totalRecorded) : capacity;
+    }
+
+    inline std::size_t getCapacity() const { return capacity; }
+
+    /// @return The number of frames ever recorded, including ones that have been overwritten.
+    inline uint32_t getTotalRecorded() const { return totalRecorded; }
+
+    /// @return The number of frames that were overwritten before being read.
+    inline uint32_t getDroppedCount() const { return totalRecorded - size(); }
+
+    /**
+     * @param[in] index Index of the frame, where 0 is the oldest stored frame. Must be less than
+     * `size()`.
+     */
+    inline const CanCaptureRecord &getRecord(std::size_t index) const
+    {
+        std::size_t oldest = totalRecorded < capacity ? 0 : next;
+        std::size_t i = oldest + index;
+        return storage[i >= capacity ? i - capacity : i];
+    }
+
+    /// Removes all stored frames.
+    inline void clear()
+    {
+        next = 0;
+        totalRecorded = 0;
+    }
+
+    /**
+     * Writes `record` as a line of a `candump -l` log, for example
+     * `(12.000345) can1 201#11223344AABBCCDD R\n`. The interface is `can1` or `can2` after the
+     * bus. The line ends with `T` for frames this board sent and `R` for frames it received;
+     * tools that only read the first three fields ignore it.
+     *
+     * @param[out] buffer Buffer of `size` bytes.
+     * @return The number of characters written, not counting the null terminator, or 0 if `size`
+     *      is less than `MAX_LOG_LINE_LENGTH`.
+     */
+    static int formatRecord(const CanCaptureRecord &record, char *buffer, std::size_t size);
+
+private:
+    CanCaptureRecord *storage;
+    std::size_t capacity;
+    /// Index `record()` writes to next.
+    std::size_t next = 0;
+    uint32_t totalRecorded = 0;
+    bool running = false;
+};  // class CanCapture
+
+/**
+ * A CanCapture that holds its own storage for `CAPACITY` frames.
+ */
+template <std::size_t CAPACITY>
+class StaticCanCapture : public CanCapture
+{
+public:
+    static_assert(CAPACITY > 0, "capture capacity must be positive");
+
+    StaticCanCapture() : CanCapture(records, CAPACITY) {}
+
+private:
+    CanCaptureRecord records[CAPACITY];
+};  // class StaticCanCapture
+}  // namespace tap::can
+
+#endif  // TAPROOT_CAN_CAPTURE_HPP_
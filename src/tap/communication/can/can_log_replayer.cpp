@@ -0,0 +1,294 @@
+/*
+ * Copyright (c) 2026 Advanced Robotics at the University of Washington <robomstr@uw.edu>
+ *
+ * This file is part of Taproot.
+ *
+ * Taproot is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Taproot is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Taproot.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifdef PLATFORM_HOSTED
+
+#include "can_log_replayer.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+
+namespace tap::can
+{
+/// Set in the identifier of error frames in candump logs.
+static constexpr uint32_t CANDUMP_ERROR_FLAG = 0x2000'0000;
+
+CanLogReplayer::CanLogReplayer(VirtualCanBus *can1Bus, VirtualCanBus *can2Bus)
+    : nodes{{this, can1Bus, CanBus::CAN_BUS1}, {this, can2Bus, CanBus::CAN_BUS2}}
+{
+}
+
+CanLogReplayer::~CanLogReplayer() { stop(); }
+
+void CanLogReplayer::setInterfaceName(CanBus bus, const std::string &name)
+{
+    interfaceNames[static_cast<int>(bus)] = name;
+}
+
+static bool parseHex(const char *begin, const char *end, uint32_t *value)
+{
+    if (begin == end)
+    {
+        return false;
+    }
+
+    *value = 0;
+    for (const char *c = begin; c != end; c++)
+    {
+        char digit = *c;
+        uint32_t nibble;
+        if (digit >= '0' && digit <= '9')
+        {
+            nibble = digit - '0';
+        }
+        else if (digit >= 'a' && digit <= 'f')
+        {
+            nibble = digit - 'a' + 10;
+        }
+        else if (digit >= 'A' && digit <= 'F')
+        {
+            nibble = digit - 'A' + 10;
+        }
+        else
+        {
+            return false;
+        }
+        *value = (*value << 4) | nibble;
+    }
+    return true;
+}
+
+bool CanLogReplayer::parseLogLine(const std::string &line, CanLogFrame *frame) const
+{
+    unsigned long long seconds = 0;
+    char micros[16] = {};
+    char interface[32] = {};
+    char frameText[64] = {};
+    char direction[4] = {};
+    int fields = sscanf(
+        line.c_str(),
+        " (%llu.%15[0-9]) %31s %63s %3s",
+        &seconds,
+        micros,
+        interface,
+        frameText,
+        direction);
+    if (fields < 4 || std::strlen(micros) != 6)
+    {
+        return false;
+    }
+
+    if (interface == interfaceNames[0])
+    {
+        frame->bus = CanBus::CAN_BUS1;
+    }
+    else if (interface == interfaceNames[1])
+    {
+        frame->bus = CanBus::CAN_BUS2;
+    }
+    else
+    {
+        return false;
+    }
+
+    const char *separator = std::strchr(frameText, '#');
+    // CAN FD frames are written with "##"
+    if (separator == nullptr || separator[1] == '#')
+    {
+        return false;
+    }
+
+    std::size_t identifierLength = separator - frameText;
+    uint32_t identifier;
+    if ((identifierLength != 3 && identifierLength != 8) ||
+        !parseHex(frameText, separator, &identifier) || (identifier & CANDUMP_ERROR_FLAG))
+    {
+        return false;
+    }
+    bool extended = identifierLength == 8;
+
+    modm::can::Message message(identifier, 0, 0, extended);
+    const char *payload = separator + 1;
+    if (payload[0] == 'R')
+    {
+        message.setRemoteTransmitRequest(true);
+        uint32_t length = 0;
+        if (payload[1] != '\0' && (!parseHex(payload + 1, payload + 2, &length) || length > 8))
+        {
+            return false;
+        }
+        message.setLength(length);
+    }
+    else
+    {
+        std::size_t payloadLength = std::strlen(payload);
+        if (payloadLength % 2 != 0 || payloadLength > 16)
+        {
+            return false;
+        }
+        for (std::size_t i = 0; i < payloadLength / 2; i++)
+        {
+            uint32_t byte;
+            if (!parseHex(payload + 2 * i, payload + 2 * i + 2, &byte))
+            {
+                return false;
+            }
+            message.data[i] = byte;
+        }
+        message.setLength(payloadLength / 2);
+    }
+
+    frame->timestamp = seconds * 1'000'000 + std::strtoull(micros, nullptr, 10);
+    frame->transmit = fields == 5 && std::strcmp(direction, "T") == 0;
+    frame->message = message;
+    return true;
+}
+
+bool CanLogReplayer::readLogFile(const std::string &path, std::vector<CanLogFrame> &frames) const
+{
+    std::ifstream file(path);
+    if (!file.is_open())
+    {
+        return false;
+    }
+
+    std::string line;
+    CanLogFrame frame;
+    bool first = true;
+    uint64_t previousRawTimestamp = 0;
+    uint64_t previousTimestamp = 0;
+    uint64_t wrapOffset = 0;
+    while (std::getline(file, line))
+    {
+        if (!parseLogLine(line, &frame))
+        {
+            continue;
+        }
+
+        uint64_t rawTimestamp = frame.timestamp;
+        if (!first && rawTimestamp < previousRawTimestamp &&
+            previousRawTimestamp < TIMESTAMP_WRAP_US &&
+            previousRawTimestamp - rawTimestamp > TIMESTAMP_WRAP_US / 2)
+        {
+            wrapOffset += TIMESTAMP_WRAP_US;
+        }
+        frame.timestamp = rawTimestamp + wrapOffset;
+        if (!first)
+        {
+            frame.timestamp = std::max(frame.timestamp, previousTimestamp);
+        }
+
+        first = false;
+        previousRawTimestamp = rawTimestamp;
+        previousTimestamp = frame.timestamp;
+        frames.push_back(frame);
+    }
+    return true;
+}
+
+void CanLogReplayer::start(const std::vector<CanLogFrame> &frames, float speed)
+{
+    this->frames = frames;
+    this->speed = speed;
+    nodes[0].start();
+    nodes[1].start();
+}
+
+void CanLogReplayer::stop()
+{
+    nodes[0].stop();
+    nodes[1].stop();
+}
+
+bool CanLogReplayer::isFinished() const { return nodes[0].isFinished() && nodes[1].isFinished(); }
+
+CanLogReplayer::ReplayNode::ReplayNode(CanLogReplayer *replayer, VirtualCanBus *bus, CanBus canBus)
+    : replayer(replayer),
+      bus(bus),
+      canBus(canBus)
+{
+}
+
+void CanLogReplayer::ReplayNode::start()
+{
+    stop();
+
+    running = true;
+    nextFrame = 0;
+    numReplayed = 0;
+    startTime = bus->getTime();
+    // Attaching schedules an update at the current bus time
+    bus->attachNode(this);
+    attached = true;
+}
+
+void CanLogReplayer::ReplayNode::stop()
+{
+    if (attached)
+    {
+        bus->detachNode(this);
+        attached = false;
+    }
+    running = false;
+}
+
+void CanLogReplayer::ReplayNode::onFrameReceived(const modm::can::Message &message, uint64_t time)
+{
+    UNUSED(message);
+    UNUSED(time);
+}
+
+uint64_t CanLogReplayer::ReplayNode::update(uint64_t time)
+{
+    const std::vector<CanLogFrame> &frames = replayer->frames;
+
+    while (running && findNextFrame())
+    {
+        uint64_t offset = frames[nextFrame].timestamp - frames[0].timestamp;
+        uint64_t dueTime = startTime + static_cast<uint64_t>(offset / replayer->speed);
+        if (dueTime > time)
+        {
+            return dueTime;
+        }
+
+        bus->transmit(this, frames[nextFrame].message);
+        nextFrame++;
+        numReplayed++;
+    }
+
+    running = false;
+    return NO_UPDATE;
+}
+
+bool CanLogReplayer::ReplayNode::findNextFrame()
+{
+    const std::vector<CanLogFrame> &frames = replayer->frames;
+    while (nextFrame < frames.size() &&
+           (frames[nextFrame].bus != canBus || frames[nextFrame].transmit))
+    {
+        nextFrame++;
+    }
+    return nextFrame < frames.size();
+}
+}  // namespace tap::can
+
+#endif  // PLATFORM_HOSTED
@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2026 Advanced Robotics at the University of Washington <robomstr@uw.edu>
+ *
+ * This file is part of Taproot.
+ *
+ * Taproot is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Taproot is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Taproot.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef TAPROOT_CAN_LOG_REPLAYER_HPP_
+#define TAPROOT_CAN_LOG_REPLAYER_HPP_
+
+#ifdef PLATFORM_HOSTED
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "tap/util_macros.hpp"
+
+#include "modm/architecture/interface/can_message.hpp"
+
+#include "can_bus.hpp"
+#include "virtual_can_bus.hpp"
+
+namespace tap::can
+{
+/**
+ * A frame read from a candump log.
+ */
+struct CanLogFrame
+{
+    /// Time from the log, in microseconds.
+    uint64_t timestamp;
+    CanBus bus;
+    /// `true` if the log marks the frame as sent by the board that recorded it.
+    bool transmit;
+    modm::can::Message message;
+};
+
+/**
+ * Hosted tool that plays a candump log, such as one dumped from a CanCapture, back onto the
+ * `VirtualCanBus`es of hosted builds (see `Can::getVirtualBus`). The robot code receives the
+ * recorded frames through `Can` and `CanRxHandler` as it would on the robot, so feedback related
+ * bugs in listeners such as motors can be reproduced and debugged without one.
+ *
+ * Frames are sent at their recorded times relative to the first frame, scaled by the replay
+ * speed. Frames the log marks as sent by the recording board (`T`) are skipped, since the robot
+ * code sends its own. The virtual bus still takes a frame's real transmission time, so replaying
+ * faster than the recorded bus load allows delays frames.
+ */
+class CanLogReplayer
+{
+public:
+    /// Microseconds after which CanCapture timestamps wrap.
+    static constexpr uint64_t TIMESTAMP_WRAP_US = 1ull << 32;
+
+    /**
+     * @param[in] can1Bus, can2Bus Buses to play frames recorded on CAN 1 and CAN 2 onto.
+     */
+    CanLogReplayer(VirtualCanBus *can1Bus, VirtualCanBus *can2Bus);
+    DISALLOW_COPY_AND_ASSIGN(CanLogReplayer)
+    ~CanLogReplayer();
+
+    /**
+     * Sets the interface name that frames recorded on `bus` have in logs, `can1` and `can2` by
+     * default. Frames on other interfaces are skipped when reading logs.
+     */
+    void setInterfaceName(CanBus bus, const std::string &name);
+
+    /**
+     * Parses a line of a candump log, `(<seconds>.<microseconds>) <interface> <frame>`, with an
+     * optional `T` or `R` direction at the end.
+     *
+     * @return `false` if the line is malformed, is on an unknown interface or is a CAN FD or
+     *      error frame.
+     */
+    bool parseLogLine(const std::string &line, CanLogFrame *frame) const;
+
+    /**
+     * Reads the frames of a candump log, skipping lines `parseLogLine` rejects.
+     *
+     * Timestamps are made non-decreasing so the frames can be passed to `start`. CanCapture
+     * timestamps are 32 bit microseconds that wrap every ~71.6 minutes, so a timestamp below
+     * `TIMESTAMP_WRAP_US` that is more than half that range before the previous one is taken to
+     * have wrapped and it and every later timestamp are moved forward by `TIMESTAMP_WRAP_US`.
+     * Any other timestamp before the previous one, such as frames logged slightly out of order,
+     * is raised to the previous timestamp.
+     *
+     * @return `false` if the file could not be opened.
+     */
+    bool readLogFile(const std::string &path, std::vector<CanLogFrame> &frames) const;
+
+    /**
+     * Starts playing `frames`, which must be in time order, from the buses' current time.
+     *
+     * @param[in] speed How much faster than recorded to play frames, must be > 0.
+     */
+    void start(const std::vector<CanLogFrame> &frames, float speed = 1.0f);
+
+    /// Stops playing frames.
+    void stop();
+
+    /// @return `true` if every frame has been sent or the replay was stopped.
+    bool isFinished() const;
+
+    /// @return The number of frames sent so far.
+    inline std::size_t getNumReplayed() const
+    {
+        return nodes[0].getNumReplayed() + nodes[1].getNumReplayed();
+    }
+
+private:
+    /**
+     * Sends the frames recorded on one bus.
+     */
+    class ReplayNode : public VirtualCanNode
+    {
+    public:
+        ReplayNode(CanLogReplayer *replayer, VirtualCanBus *bus, CanBus canBus);
+
+        void start();
+        void stop();
+
+        inline bool isFinished() const { return !running; }
+        inline std::size_t getNumReplayed() const { return numReplayed; }
+
+        void onFrameReceived(const modm::can::Message &message, uint64_t time) override;
+        uint64_t update(uint64_t time) override;
+
+    private:
+        CanLogReplayer *replayer;
+        VirtualCanBus *bus;
+        const CanBus canBus;
+        bool running = false;
+        bool attached = false;
+        uint64_t startTime = 0;
+        std::size_t nextFrame = 0;
+        std::size_t numReplayed = 0;
+
+        /// Moves `nextFrame` to the next frame this node sends, if any.
+        bool findNextFrame();
+    };
+
+    std::vector<CanLogFrame> frames;
+    double speed = 1.0;
+    std::string interfaceNames[2] = {"can1", "can2"};
+    ReplayNode nodes[2];
+};  // class CanLogReplayer
+}  // namespace tap::can
+
+#endif  // PLATFORM_HOSTED
+
+#endif  // TAPROOT_CAN_LOG_REPLAYER_HPP_
@@ -19,6 +19,8 @@
 
 #include "can_rx_handler.hpp"
 
+#include <algorithm>
+
 #include "tap/drivers.hpp"
 #include "tap/errors/create_errors.hpp"
 
@@ -31,175 +33,150 @@ namespace tap::can
 {
 CanRxHandler::CanRxHandler(Drivers* drivers)
     : drivers(drivers),
-      messageHandlerStoreDjiCan1(),
-      messageHandlerStoreRevCan1(),
-      messageHandlerStoreDjiCan2(),
-      messageHandlerStoreRevCan2()
+      listeners(),
+      standardIdTable(),
+      revDeviceTable()
 {
 }
 
 void CanRxHandler::attachReceiveHandler(CanRxListener* const listener)
 {
-    if (listener->canBus == can::CanBus::CAN_BUS1)
+    uint8_t* entry = getTableEntry(*listener);
+
+    if (entry == nullptr)
     {
-        if (isRevCanId(listener->canIdentifier))
-        {
-            attachReceiveHandler(listener, messageHandlerStoreRevCan1);
-        }
-        else if (isDjiCanId(listener->canIdentifier))
-        {
-            attachReceiveHandler(listener, messageHandlerStoreDjiCan1);
-        }
+        RAISE_ERROR(drivers, "can rx listener identifier out of range");
+        return;
     }
-    else
+
+    if (*entry != 0)
     {
-        if (isRevCanId(listener->canIdentifier))
-        {
-            attachReceiveHandler(listener, messageHandlerStoreRevCan2);
-        }
-        else if (isDjiCanId(listener->canIdentifier))
-        {
-            attachReceiveHandler(listener, messageHandlerStoreDjiCan2);
-        }
+        RAISE_ERROR(drivers, "overloading can rx listener");
+        return;
     }
-}
-
-void CanRxHandler::attachReceiveHandler(
-    CanRxListener* const canRxListener,
-    CanRxListener** messageHandlerStore)
-{
-    uint16_t bin = binIndexForCanId(canRxListener->canIdentifier);
 
-    if (messageHandlerStore[bin] == nullptr)
+    for (int i = 0; i < MAX_LISTENERS; i++)
     {
-        messageHandlerStore[bin] = canRxListener;
+        if (listeners[i] == nullptr)
+        {
+            listeners[i] = listener;
+            *entry = i + 1;
+            return;
+        }
     }
-    else
-    {
-        CanRxListener* node = messageHandlerStore[bin];
 
-        do
-        {
-            if (node->canIdentifier == canRxListener->canIdentifier)
-            {
-                RAISE_ERROR(drivers, "overloading can rx listener");
-                return;
-            }
+    RAISE_ERROR(drivers, "can rx handler full, no more listeners allowed");
+}
 
-            if (node->next == nullptr) break;
-            node = node->next;
-        } while (true);
+void CanRxHandler::pollCanData()
+{
+    pollBus(CanBus::CAN_BUS1);
+    pollBus(CanBus::CAN_BUS2);
 
-        node->next = canRxListener;
-    }
+    drivers->canTxQueue.drain();
 }
 
-void CanRxHandler::pollCanData()
+void CanRxHandler::pollBus(CanBus bus)
 {
     modm::can::Message rxMessage;
+    uint32_t arrivalTime = 0;
+    CanCapture* capture = drivers->can.getCapture();
 
-    // handle incoming CAN 1 messages
-    if (drivers->can.getMessage(CanBus::CAN_BUS1, &rxMessage))
+    uint16_t processed = 0;
+    while (processed < pollBudget && drivers->can.getMessage(bus, &rxMessage, &arrivalTime))
     {
-        // small hack to switch between the two motor stores without having to change a large chunk
-        // of code
-        if (rxMessage.isExtended())
-        {
-            processReceivedCanData(rxMessage, messageHandlerStoreRevCan1);
-        }
-        else
+        drivers->can.getBusLoadMonitor().recordRx(bus, rxMessage);
+        if (capture != nullptr)
         {
-            processReceivedCanData(rxMessage, messageHandlerStoreDjiCan1);
+            capture->record(bus, rxMessage, arrivalTime, false);
         }
+        processReceivedCanData(bus, rxMessage, arrivalTime);
+        processed++;
     }
 
-    // handle incoming CAN 2 messages
-    if (drivers->can.getMessage(CanBus::CAN_BUS2, &rxMessage))
+    RxStats& stats = rxStats[static_cast<int>(bus)];
+    stats.framesProcessed += processed;
+    stats.framesProcessedLastPoll = processed;
+    stats.maxFramesProcessedPerPoll = std::max(stats.maxFramesProcessedPerPoll, processed);
+    stats.framesPending = processed == pollBudget && drivers->can.isMessageAvailable(bus);
+    if (stats.framesPending)
     {
-        if (rxMessage.isExtended())
-        {
-            processReceivedCanData(rxMessage, messageHandlerStoreRevCan2);
-        }
-        else
-        {
-            processReceivedCanData(rxMessage, messageHandlerStoreDjiCan2);
-        }
+        stats.pollsWithFramesPending++;
     }
 }
 
 void CanRxHandler::processReceivedCanData(
+    CanBus bus,
     const modm::can::Message& rxMessage,
-    CanRxListener* const* messageHandlerStore)
+    uint32_t arrivalTime)
 {
-    uint16_t bin = binIndexForCanId(rxMessage.getIdentifier());
-
-    CanRxListener* listener = messageHandlerStore[bin];
-    while (listener != nullptr &&
-           listener->canIdentifier != (rxMessage.isExtended() ? bin : rxMessage.identifier))
-    {
-        listener = listener->next;
-    }
+    CanRxListener* listener = getListener(
+        bus,
+        rxMessage.getIdentifier(),
+        rxMessage.isExtended() ? CanRxIdType::REV_DEVICE : CanRxIdType::STANDARD);
 
     if (listener != nullptr)
     {
+        listener->messageArrivalTime = arrivalTime;
         listener->processMessage(rxMessage);
     }
 }
 
-void CanRxHandler::removeReceiveHandler(const CanRxListener& canRxListener)
+CanRxListener* CanRxHandler::getListener(CanBus bus, uint32_t identifier, CanRxIdType idType)
+    const
 {
-    if (canRxListener.canBus == CanBus::CAN_BUS1)
+    uint8_t entry;
+
+    if (idType == CanRxIdType::STANDARD)
     {
-        if (isRevCanId(canRxListener.canIdentifier))
+        if (identifier >= NUM_STANDARD_CAN_IDS)
         {
-            removeReceiveHandler(canRxListener, messageHandlerStoreRevCan1);
-        }
-        else if (isDjiCanId(canRxListener.canIdentifier))
-        {
-            removeReceiveHandler(canRxListener, messageHandlerStoreDjiCan1);
+            return nullptr;
         }
+        entry = standardIdTable[static_cast<int>(bus)][identifier];
     }
     else
     {
-        if (isRevCanId(canRxListener.canIdentifier))
-        {
-            removeReceiveHandler(canRxListener, messageHandlerStoreRevCan2);
-        }
-        else if (isDjiCanId(canRxListener.canIdentifier))
+        // Extended identifiers are full REV arbitration identifiers
+        if (!isRevCanId(identifier))
         {
-            removeReceiveHandler(canRxListener, messageHandlerStoreDjiCan2);
+            return nullptr;
         }
+        entry = revDeviceTable[static_cast<int>(bus)][getRevDeviceId(identifier)];
     }
+
+    return entry == 0 ? nullptr : listeners[entry - 1];
 }
 
-void CanRxHandler::removeReceiveHandler(
-    const CanRxListener& canRxListener,
-    CanRxListener** messageHandlerStore)
+void CanRxHandler::removeReceiveHandler(const CanRxListener& canRxListener)
 {
-    int bin = binIndexForCanId(canRxListener.canIdentifier);
+    uint8_t* entry = getTableEntry(canRxListener);
 
-    if (messageHandlerStore[bin] == nullptr)
+    if (entry == nullptr || *entry == 0 || listeners[*entry - 1] != &canRxListener)
     {
         RAISE_ERROR(drivers, "listener not in handler storage");
         return;
     }
 
-    if (messageHandlerStore[bin]->canIdentifier == canRxListener.canIdentifier)
+    listeners[*entry - 1] = nullptr;
+    *entry = 0;
+}
+
+uint8_t* CanRxHandler::getTableEntry(const CanRxListener& listener)
+{
+    int bus = static_cast<int>(listener.canBus);
+
+    if (listener.canIdType == CanRxIdType::STANDARD)
     {
-        messageHandlerStore[bin] = messageHandlerStore[bin]->next;
+        return listener.canIdentifier < NUM_STANDARD_CAN_IDS
+                   ? &standardIdTable[bus][listener.canIdentifier]
+                   : nullptr;
     }
     else
     {
-        CanRxListener* node = messageHandlerStore[bin];
-        while (node->next != nullptr)
-        {
-            if (node->next->canIdentifier == canRxListener.canIdentifier)
-            {
-                node->next = node->next->next;
-                return;
-            }
-        }
-        RAISE_ERROR(drivers, "listener not in handler storage");
+        return listener.canIdentifier < NUM_REV_DEVICE_IDS
+                   ? &revDeviceTable[bus][listener.canIdentifier]
+                   : nullptr;
     }
 }
 
@@ -25,6 +25,7 @@
 #include "tap/util_macros.hpp"
 
 #include "can_bus.hpp"
+#include "can_rx_listener.hpp"
 
 namespace modm::can
 {
@@ -38,8 +39,6 @@ class Drivers;
 
 namespace tap::can
 {
-class CanRxListener;
-
 /**
  * A handler that stores pointers to CanRxListener and that watches
  * CAN 1 and CAN 2 for messages. If messages are received, it checks
@@ -61,10 +60,14 @@ class CanRxListener;
  * pollCanData function be called at a very high frequency,
  * so call this in a high frequency thread.
  *
- * @note The CAN handler can handle 64 CAN ids between [`0x1E4`, `0x224`). In the middle of this
- *      range, CAN ids [`0x201`, `0x20B`] are used by the `DjiMotor` objects to receive data from
- *      DJI branded motors. If you would like to define your own protocol, it is recommended to
- *      avoid avoid using CAN ids in this range.
+ * Listeners are found with a single table lookup per message: each bus has a table indexed by
+ * every standard (11-bit) CAN identifier and one indexed by REV device number (see
+ * `CanRxIdType`), filled in when listeners are attached. Each entry is one byte, the index of the
+ * listener in a shared array, so the tables take ~4.2 KB in total.
+ *
+ * @note Any standard CAN id may be listened to. CAN ids [`0x201`, `0x20B`] are used by the
+ *      `DjiMotor` objects to receive data from DJI branded motors. If you would like to define
+ *      your own protocol, it is recommended to avoid using CAN ids in this range.
  * @note the DjiMotor driver reserves `0x1FF` and `0x200` for commanding motors,
  *      and thus you should not attach listeners for these ids.
  *
@@ -75,33 +78,69 @@ class CanRxListener;
 class CanRxHandler
 {
 public:
+    /// Number of CAN buses the handler polls.
+    static constexpr int NUM_CAN_BUSES = 2;
+
+    /// Number of standard (11-bit) CAN identifiers.
+    static constexpr uint16_t NUM_STANDARD_CAN_IDS = 1 << 11;
+
+    /// Number of REV device numbers, the low 6 bits of a REV arbitration identifier.
+    static constexpr uint8_t NUM_REV_DEVICE_IDS = 1 << 6;
+
+    /**
+     * Bits [16, 28] of the arbitration identifier of messages sent by REV motor controllers:
+     * device type 2 (motor controller) and manufacturer 5 (REV Robotics).
+     */
+    static constexpr uint32_t REV_MOTOR_CONTROLLER_ID_PREFIX = (0x02 << 8) | 0x05;
+
+    /// Max number of listeners that may be attached at once, across both buses.
+    static constexpr uint8_t MAX_LISTENERS = UINT8_MAX;
+
+    /**
+     * Default max number of frames `pollCanData` processes per bus per call. At 1 Mbps a bus
+     * carries at most ~9 standard 8 byte frames per millisecond, so this keeps up with a
+     * saturated bus when polled every few milliseconds.
+     */
+    static constexpr uint16_t DEFAULT_POLL_BUDGET = 32;
+
     /**
-     * The number of "hash" bins to store listeners in. `8` is choosen as most users will only have
-     * DJI Motors on their can bus, reducing any unnecessary overhead storing empty bins. The bus
-     * also become saturated near this limit, so the performance hit of a linked list traversal is
-     * minimal.
+     * Receive counters for a single bus, see `getRxStats`.
      */
-    static constexpr uint8_t CAN_BINS = 8;
+    struct RxStats
+    {
+        /// Total number of frames processed.
+        uint32_t framesProcessed = 0;
+        /// Number of frames processed by the most recent `pollCanData` call.
+        uint16_t framesProcessedLastPoll = 0;
+        /// Max number of frames processed by a single `pollCanData` call.
+        uint16_t maxFramesProcessedPerPoll = 0;
+        /**
+         * `true` if the most recent `pollCanData` call used up its budget with frames still
+         * waiting to be read.
+         */
+        bool framesPending = false;
+        /// Number of `pollCanData` calls that left frames waiting to be read.
+        uint32_t pollsWithFramesPending = 0;
+    };
 
     CanRxHandler(Drivers* drivers);
     mockable ~CanRxHandler() = default;
     DISALLOW_COPY_AND_ASSIGN(CanRxHandler)
 
     /**
-     * @return true if canId lies in either the DJI or REV CAN ID ranges.
+     * @return true if `identifier`, an extended 29-bit arbitration identifier, belongs to a
+     *      message sent by a REV motor controller.
      */
-    static inline bool isValidCanId(uint16_t canId)
+    static inline bool isRevCanId(uint32_t identifier)
     {
-        return isDjiCanId(canId) || isRevCanId(canId);
+        return (identifier >> 16) == REV_MOTOR_CONTROLLER_ID_PREFIX;
     }
 
-    static bool isDjiCanId(uint16_t canId) { return (canId >= 0X201 && canId <= 0x208); }
-    static bool isRevCanId(uint16_t canId) { return (canId >= 0x001 && canId <= 0x008); }
-
-    /**
-     * Given a CAN identifier, returns the bin index between [0, NUM_CAN_IDS) for the identifier.
-     */
-    static inline uint16_t binIndexForCanId(uint16_t canId) { return canId % CAN_BINS; }
+    /// @return The device number in a REV arbitration identifier.
+    static inline uint8_t getRevDeviceId(uint32_t identifier)
+    {
+        return identifier & (NUM_REV_DEVICE_IDS - 1);
+    }
 
     /**
      * Call this function to add a CanRxListener to the list of CanRxListener's
@@ -112,7 +151,8 @@ class CanRxHandler
      *      store listeners may or not be properly allocated if you do and
      *      undefined behavior will follow.
      * @note if you attempt to add a listener with an identifier identical to
-     *      something already in the `CanRxHandler`, an error is thrown and
+     *      something already in the `CanRxHandler`, an identifier out of range for its
+     *      `CanRxIdType`, or more than `MAX_LISTENERS` listeners, an error is thrown and
      *      the handler does not add the listener.
      * @see `CanRxListener`
      *
@@ -125,6 +165,11 @@ class CanRxHandler
      * Function handles receiving messages and calling the appropriate
      * processMessage function given the CAN bus and can identifier.
      *
+     * Reads every pending message on both buses, up to the poll budget (see
+     * `setPollBudget`) per bus so a flooded bus cannot stall the caller.
+     * Afterwards drains the drivers' `CanTxQueue`, so frames waiting for a free
+     * transmit mailbox go out as soon as one frees up.
+     *
      * @attention you should call this function as frequently as you receive
      *      messages if you want to receive the most up to date messages.
      *      modm's IQR puts CAN messages in a queue, and this function
@@ -132,6 +177,33 @@ class CanRxHandler
      */
     mockable void pollCanData();
 
+    /**
+     * Sets the max number of frames `pollCanData` processes per bus per call.
+     *
+     * @param[in] framesPerBus The budget, must be > 0.
+     */
+    inline void setPollBudget(uint16_t framesPerBus)
+    {
+        pollBudget = framesPerBus > 0 ? framesPerBus : 1;
+    }
+
+    inline uint16_t getPollBudget() const { return pollBudget; }
+
+    /**
+     * @return Receive counters for `bus`. If `framesPending` stays `true` the budget is too
+     *      small or `pollCanData` is not called often enough to keep up with the bus.
+     */
+    inline const RxStats& getRxStats(CanBus bus) const { return rxStats[static_cast<int>(bus)]; }
+
+    /// Clears the receive counters of both buses.
+    mockable void resetRxStats()
+    {
+        for (RxStats& stats : rxStats)
+        {
+            stats = RxStats();
+        }
+    }
+
     /**
      * Removes the passed in `CanRxListener` from the `CanRxHandler`. If the
      * listener isn't in the handler, an error will be added to the `ErrorController`
@@ -145,39 +217,53 @@ class CanRxHandler
     Drivers* drivers;
 
     /**
-     * Stores pointers to the `CanRxListeners` for CAN 1, referenced when
-     * a new message is received.
+     * Attached listeners. Table entries are an index into this array plus one, so `0` means no
+     * listener. Removed listeners leave a `nullptr` that is reused by the next one attached.
+     */
+    CanRxListener* listeners[MAX_LISTENERS];
+
+    /// Listeners of each bus, indexed by standard CAN identifier.
+    uint8_t standardIdTable[NUM_CAN_BUSES][NUM_STANDARD_CAN_IDS];
+
+    /// Listeners of each bus, indexed by REV device number.
+    uint8_t revDeviceTable[NUM_CAN_BUSES][NUM_REV_DEVICE_IDS];
+
+    uint16_t pollBudget = DEFAULT_POLL_BUDGET;
+
+    RxStats rxStats[NUM_CAN_BUSES];
+
+    /**
+     * Processes pending messages on `bus` until there are none left or the poll budget is used
+     * up, and updates the bus's receive counters.
      */
-    CanRxListener* messageHandlerStoreDjiCan1[CAN_BINS];
-    CanRxListener* messageHandlerStoreRevCan1[CAN_BINS];
+    void pollBus(CanBus bus);
 
     /**
-     * Stores pointers to the `CanRxListeners` for CAN 2, referenced when
-     * a new message is received.
+     * @return The table entry for `listener`'s identifier, or `nullptr` if the identifier is out
+     *      of range.
      */
-    CanRxListener* messageHandlerStoreDjiCan2[CAN_BINS];
-    CanRxListener* messageHandlerStoreRevCan2[CAN_BINS];
+    uint8_t* getTableEntry(const CanRxListener& listener);
 
 #if defined(PLATFORM_HOSTED) && defined(ENV_UNIT_TESTS)
 public:
 #endif
 
-    void attachReceiveHandler(
-        CanRxListener* const canRxListener,
-        CanRxListener** messageHandlerStore);
-
+    /**
+     * Calls `processMessage` of the listener for `rxMessage`, if any.
+     *
+     * @param[in] arrivalTime The time `rxMessage` was received, in microseconds, made available
+     *      to the listener via `CanRxListener::getMessageArrivalTime`.
+     */
     void processReceivedCanData(
+        CanBus bus,
         const modm::can::Message& rxMessage,
-        CanRxListener* const* messageHandlerStore);
-
-    void removeReceiveHandler(
-        const CanRxListener& canRxListener,
-        CanRxListener** messageHandlerStore);
+        uint32_t arrivalTime = 0);
 
-    inline CanRxListener** getHandlerStore(CanBus bus)
-    {
-        return bus == CanBus::CAN_BUS1 ? messageHandlerStoreDjiCan1 : messageHandlerStoreDjiCan2;
-    }
+    /**
+     * @return The listener that receives messages with the given identifier on `bus`, or
+     *      `nullptr` if there is none.
+     */
+    CanRxListener* getListener(CanBus bus, uint32_t identifier, CanRxIdType idType) const;
 };  // class CanRxHandler
 
 }  // namespace tap::can
@@ -27,9 +27,10 @@ namespace tap
 {
 namespace can
 {
-CanRxListener::CanRxListener(Drivers *drivers, uint32_t id, CanBus cB)
+CanRxListener::CanRxListener(Drivers *drivers, uint32_t id, CanBus cB, CanRxIdType idType)
     : canIdentifier(id),
       canBus(cB),
+      canIdType(idType),
       drivers(drivers)
 {
 }
@@ -36,6 +36,21 @@ class Drivers;
 namespace can
 {
 class CanRxHandler;
+
+/**
+ * How a `CanRxListener`'s identifier is matched against received messages.
+ */
+enum class CanRxIdType : uint8_t
+{
+    /// The identifier is a standard 11-bit CAN identifier, [`0x000`, `0x7FF`].
+    STANDARD = 0,
+    /**
+     * The identifier is a REV device number, [`0`, `63`]. Every message with an extended 29-bit
+     * arbitration identifier from a REV motor controller with that device number is received.
+     */
+    REV_DEVICE,
+};
+
 /**
  * A class that when extended allows you to interface with the `can_rx_handler`.
  *
@@ -95,8 +110,13 @@ class CanRxListener
      * @param[in] id the message identifier to be associated with this
      *      rx listener.
      * @param[in] cB the CanBus that you would like to watch.
+     * @param[in] idType how `id` is matched against received messages.
      */
-    CanRxListener(Drivers* drivers, uint32_t id, CanBus cB);
+    CanRxListener(
+        Drivers* drivers,
+        uint32_t id,
+        CanBus cB,
+        CanRxIdType idType = CanRxIdType::STANDARD);
 
     /**
      * Here we remove the listener from receive interface.
@@ -121,6 +141,14 @@ class CanRxListener
      */
     virtual void processMessage(const modm::can::Message& message) = 0;
 
+    /**
+     * @return The time, in microseconds (see `tap::arch::clock::getTimeMicroseconds`), at which
+     *      the message currently being passed to `processMessage` arrived. On the target this is
+     *      taken in the CAN receive interrupt, so it does not include the time the message spent
+     *      waiting for `CanRxHandler::pollCanData`. Only meaningful from within `processMessage`.
+     */
+    inline uint32_t getMessageArrivalTime() const { return messageArrivalTime; }
+
     /**
      * A variable necessary for the receive handler to determine
      * which message corresponds to which CanRxListener child class.
@@ -133,15 +161,16 @@ class CanRxListener
      */
     const CanBus canBus;
 
+    /**
+     * Whether `canIdentifier` is a standard CAN identifier or a REV device number.
+     */
+    const CanRxIdType canIdType;
+
     Drivers* drivers;
 
-#ifndef ENV_UNIT_TESTS
 private:
-#endif
-    /**
-     * The next CanRxListener in the linked list for lookups.
-     */
-    CanRxListener* next = nullptr;
+    /// Set by the CanRxHandler before each call to `processMessage`.
+    uint32_t messageArrivalTime = 0;
 };  // class CanRxListener
 
 }  // namespace can
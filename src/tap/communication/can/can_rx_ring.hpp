@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2026 Advanced Robotics at the University of Washington <robomstr@uw.edu>
+ *
+ * This file is part of Taproot.
+ *
+ * Taproot is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Taproot is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Taproot.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef TAPROOT_CAN_RX_RING_HPP_
+#define TAPROOT_CAN_RX_RING_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "modm/architecture/interface/can_message.hpp"
+
+namespace tap::can
+{
+/**
+ * A received CAN frame and the time it arrived.
+ */
+struct TimestampedCanMessage
+{
+    modm::can::Message message;
+    /**
+     * Time the frame was taken out of the peripheral, in microseconds (see
+     * `tap::arch::clock::getTimeMicroseconds`).
+     */
+    uint32_t arrivalTime;
+};
+
+/**
+ * A lock-free single producer, single consumer ring buffer of received CAN frames.
+ *
+ * The producer is the CAN receive interrupt, which timestamps each frame as it empties the
+ * peripheral's FIFO, and the consumer is `Can::getMessage` in thread mode. Each side only writes
+ * its own index, so neither has to disable interrupts. When the ring is full, new frames are
+ * dropped and counted instead of overwriting frames the consumer has not read.
+ */
+class CanRxRing
+{
+public:
+    /// Number of frames stored, a power of two. At 1 Mbps this is ~7 ms of back to back frames.
+    static constexpr std::size_t CAPACITY = 64;
+    static_assert((CAPACITY & (CAPACITY - 1)) == 0, "CAPACITY must be a power of two");
+
+    /**
+     * Producer only. Appends a frame.
+     *
+     * @return `false` if the ring was full and the frame was dropped.
+     */
+    inline bool push(const modm::can::Message &message, uint32_t arrivalTime)
+    {
+        uint32_t head = writeIndex.load(std::memory_order_relaxed);
+        if (head - readIndex.load(std::memory_order_acquire) == CAPACITY)
+        {
+            recordOverflow();
+            return false;
+        }
+
+        frames[head & (CAPACITY - 1)] = {message, arrivalTime};
+        writeIndex.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Consumer only. Removes the oldest frame.
+     *
+     * @return `false` if the ring was empty.
+     */
+    inline bool pop(TimestampedCanMessage *frame)
+    {
+        uint32_t tail = readIndex.load(std::memory_order_relaxed);
+        if (tail == writeIndex.load(std::memory_order_acquire))
+        {
+            return false;
+        }
+
+        *frame = frames[tail & (CAPACITY - 1)];
+        readIndex.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// @return `true` if no frames are waiting. May be called from either side.
+    inline bool empty() const
+    {
+        return readIndex.load(std::memory_order_acquire) ==
+               writeIndex.load(std::memory_order_acquire);
+    }
+
+    /// @return The number of frames waiting. May be called from either side.
+    inline std::size_t size() const
+    {
+        return writeIndex.load(std::memory_order_acquire) -
+               readIndex.load(std::memory_order_acquire);
+    }
+
+    /// @return The number of frames dropped because the ring was full.
+    inline uint32_t getOverflowCount() const { return overflows.load(std::memory_order_relaxed); }
+
+    /**
+     * Producer only. Counts a frame lost before reaching the ring, e.g. to a hardware FIFO
+     * overrun.
+     */
+    inline void recordOverflow()
+    {
+        overflows.store(overflows.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+
+private:
+    TimestampedCanMessage frames[CAPACITY];
+    /// Total number of frames pushed. Only written by the producer.
+    std::atomic<uint32_t> writeIndex{0};
+    /// Total number of frames popped. Only written by the consumer.
+    std::atomic<uint32_t> readIndex{0};
+    /// Only written by the producer.
+    std::atomic<uint32_t> overflows{0};
+};  // class CanRxRing
+}  // namespace tap::can
+
+#endif  // TAPROOT_CAN_RX_RING_HPP_
@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2026 Advanced Robotics at the University of Washington <robomstr@uw.edu>
+ *
+ * This file is part of Taproot.
+ *
+ * Taproot is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Taproot is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Taproot.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "can_terminal_handler.hpp"
+
+#include <cstring>
+
+#include "tap/algorithms/strtok.hpp"
+#include "tap/drivers.hpp"
+
+namespace tap
+{
+namespace can
+{
+constexpr char CanTerminalHandler::HEADER[];
+constexpr char CanTerminalHandler::USAGE[];
+
+CanTerminalHandler::CanTerminalHandler(Drivers* drivers) : drivers(drivers) {}
+
+void CanTerminalHandler::init() { drivers->terminalSerial.addHeader(HEADER, this); }
+
+void CanTerminalHandler::terminalSerialStreamCallback(modm::IOStream& outputStream)
+{
+    printLoad(outputStream);
+}
+
+bool CanTerminalHandler::terminalSerialCallback(
+    char* inputLine,
+    modm::IOStream& outputStream,
+    bool streamingEnabled)
+{
+    char* arg = strtokR(inputLine, communication::serial::TerminalSerial::DELIMITERS, &inputLine);
+
+    if (arg != nullptr && strcmp(arg, "load") == 0)
+    {
+        printLoad(outputStream);
+        return true;
+    }
+    else if (arg != nullptr && strcmp(arg, "ids") == 0)
+    {
+        printIds(outputStream);
+        return true;
+    }
+    else if (arg != nullptr && strcmp(arg, "queue") == 0)
+    {
+        printTxQueue(outputStream);
+        return true;
+    }
+    else if (arg != nullptr && !streamingEnabled && strcmp(arg, "reset") == 0)
+    {
+        drivers->can.getBusLoadMonitor().reset();
+        drivers->canTxQueue.resetTxQueueStats();
+        drivers->canRxHandler.resetRxStats();
+        outputStream << "CAN counters reset" << modm::endl;
+        return true;
+    }
+    else if (arg != nullptr && !streamingEnabled && strcmp(arg, "capture") == 0)
+    {
+        return handleCaptureCommand(inputLine, outputStream);
+    }
+    else
+    {
+        outputStream << USAGE;
+        return (arg != nullptr) && !streamingEnabled && (strcmp(arg, "-H") == 0);
+    }
+}
+
+void CanTerminalHandler::printLoad(modm::IOStream& outputStream)
+{
+    CanBusLoadMonitor& monitor = drivers->can.getBusLoadMonitor();
+
+    outputStream << "bus\tutil%\tpeak%\tbits\ttx\trx\ttxfail\ttec\trec\trxlost" << modm::endl;
+    for (CanBus bus : {CanBus::CAN_BUS1, CanBus::CAN_BUS2})
+    {
+        CanBusLoadMonitor::BusStats stats = monitor.getBusStats(bus);
+        outputStream << getBusName(bus) << "\t";
+        outputStream.printf(
+            "%.1f\t%.1f\t",
+            static_cast<double>(stats.utilization * 100),
+            static_cast<double>(stats.peakUtilization * 100));
+        outputStream << stats.windowBits << "\t" << stats.txFrames << "\t" << stats.rxFrames
+                     << "\t" << stats.txFailures << "\t"
+                     << static_cast<uint32_t>(drivers->can.getTransmitErrorCount(bus)) << "\t"
+                     << static_cast<uint32_t>(drivers->can.getReceiveErrorCount(bus)) << "\t"
+                     << drivers->can.getRxOverflowCount(bus) << modm::endl;
+    }
+}
+
+void CanTerminalHandler::printIds(modm::IOStream& outputStream)
+{
+    CanBusLoadMonitor& monitor = drivers->can.getBusLoadMonitor();
+
+    outputStream << "bus\tid\tdir\tbits\tfps\tframes" << modm::endl;
+    for (uint8_t i = 0; i < monitor.getNumTrackedIds(); i++)
+    {
+        CanBusLoadMonitor::IdStats stats = monitor.getIdStats(i);
+        outputStream << getBusName(stats.bus) << "\t";
+        outputStream.printf(
+            stats.extended ? "0x%08lx" : "0x%03lx",
+            static_cast<unsigned long>(stats.identifier));
+        outputStream << "\t" << (stats.transmit ? "tx" : "rx") << "\t" << stats.bitsPerFrame
+                     << "\t" << stats.framesPerWindow << "\t" << stats.frames << modm::endl;
+    }
+    outputStream << "untracked " << monitor.getUntrackedFrames() << modm::endl;
+}
+
+void CanTerminalHandler::printTxQueue(modm::IOStream& outputStream)
+{
+    CanTxQueue& queue = drivers->canTxQueue;
+
+    outputStream << "bus\tqueued\tmax\tsent\treplaced\texpired\tdropped\tfail" << modm::endl;
+    for (CanBus bus : {CanBus::CAN_BUS1, CanBus::CAN_BUS2})
+    {
+        const CanTxQueue::TxQueueStats& stats = queue.getTxQueueStats(bus);
+        outputStream << getBusName(bus) << "\t" << static_cast<uint32_t>(queue.getNumQueued(bus))
+                     << "\t" << static_cast<uint32_t>(stats.maxQueued) << "\t" << stats.sent
+                     << "\t" << stats.replaced << "\t" << stats.expired << "\t" << stats.dropped
+                     << "\t" << stats.sendFailures << modm::endl;
+    }
+}
+
+bool CanTerminalHandler::handleCaptureCommand(char* inputLine, modm::IOStream& outputStream)
+{
+    CanCapture* capture = drivers->can.getCapture();
+    if (capture == nullptr)
+    {
+        outputStream << "no capture set, see Can::setCapture" << modm::endl;
+        return false;
+    }
+
+    char* arg = strtokR(inputLine, communication::serial::TerminalSerial::DELIMITERS, &inputLine);
+
+    if (arg == nullptr)
+    {
+        printCaptureStatus(*capture, outputStream);
+    }
+    else if (strcmp(arg, "start") == 0)
+    {
+        capture->start();
+        printCaptureStatus(*capture, outputStream);
+    }
+    else if (strcmp(arg, "stop") == 0)
+    {
+        capture->stop();
+        printCaptureStatus(*capture, outputStream);
+    }
+    else if (strcmp(arg, "clear") == 0)
+    {
+        capture->clear();
+        printCaptureStatus(*capture, outputStream);
+    }
+    else if (strcmp(arg, "dump") == 0)
+    {
+        char line[CanCapture::MAX_LOG_LINE_LENGTH];
+        for (std::size_t i = 0; i < capture->size(); i++)
+        {
+            CanCapture::formatRecord(capture->getRecord(i), line, sizeof(line));
+            outputStream << line;
+        }
+    }
+    else
+    {
+        outputStream << USAGE;
+        return false;
+    }
+
+    return true;
+}
+
+void CanTerminalHandler::printCaptureStatus(const CanCapture& capture, modm::IOStream& outputStream)
+{
+    outputStream << "capture " << (capture.isRunning() ? "running" : "stopped") << ", "
+                 << static_cast<uint32_t>(capture.size()) << "/"
+                 << static_cast<uint32_t>(capture.getCapacity()) << " frames, "
+                 << capture.getDroppedCount() << " overwritten" << modm::endl;
+}
+
+const char* CanTerminalHandler::getBusName(CanBus bus)
+{
+    return bus == CanBus::CAN_BUS1 ? "can1" : "can2";
+}
+}  // namespace can
+
+}  // namespace tap
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2026 Advanced Robotics at the University of Washington <robomstr@uw.edu>
+ *
+ * This file is part of Taproot.
+ *
+ * Taproot is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Taproot is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Taproot.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef TAPROOT_CAN_TERMINAL_HANDLER_HPP_
+#define TAPROOT_CAN_TERMINAL_HANDLER_HPP_
+
+#include "tap/communication/serial/terminal_serial.hpp"
+#include "tap/util_macros.hpp"
+
+#include "can_bus.hpp"
+#include "can_capture.hpp"
+
+namespace tap
+{
+class Drivers;
+namespace can
+{
+/**
+ * Terminal handler that prints the bus load and per identifier traffic recorded by the
+ * CanBusLoadMonitor of the drivers' Can object, the error counters of both CAN peripherals and
+ * the counters of the drivers' CanTxQueue, and controls the capture set with `Can::setCapture`.
+ *
+ * Utilization is the fraction of the last `CanBusLoadMonitor::WINDOW_MS` the bus spent carrying
+ * frames sent or received by this board. Frames exchanged between other nodes are not seen by
+ * the monitor, so on a shared bus this is a lower bound.
+ */
+class CanTerminalHandler : public communication::serial::TerminalSerialCallbackInterface
+{
+public:
+    static constexpr char HEADER[] = "can";
+
+    CanTerminalHandler(Drivers* drivers);
+    DISALLOW_COPY_AND_ASSIGN(CanTerminalHandler);
+    mockable ~CanTerminalHandler() = default;
+
+    mockable void init();
+
+    bool terminalSerialCallback(
+        char* inputLine,
+        modm::IOStream& outputStream,
+        bool streamingEnabled) override;
+
+    void terminalSerialStreamCallback(modm::IOStream& outputStream) override;
+
+private:
+    Drivers* drivers;
+
+    static constexpr char USAGE[] =
+        "Usage: can <target>\n"
+        "  Where \"<target>\" is one of:\n"
+        "    - \"-H\": displays possible commands.\n"
+        "    - \"load\": prints utilization, frame, error and lost frame counts of each bus.\n"
+        "    - \"ids\": prints bits per frame and frame rate of each identifier.\n"
+        "    - \"queue\": prints transmit queue counters of each bus.\n"
+        "    - \"reset\": clears all counters.\n"
+        "    - \"capture [start|stop|clear|dump]\": prints capture status, starts or stops\n"
+        "      recording frames, clears recorded frames or prints them as a candump log.\n";
+
+    void printLoad(modm::IOStream& outputStream);
+
+    void printIds(modm::IOStream& outputStream);
+
+    void printTxQueue(modm::IOStream& outputStream);
+
+    bool handleCaptureCommand(char* inputLine, modm::IOStream& outputStream);
+
+    void printCaptureStatus(const CanCapture& capture, modm::IOStream& outputStream);
+
+    static const char* getBusName(CanBus bus);
+};
+}  // namespace can
+
+}  // namespace tap
+
+#endif  // TAPROOT_CAN_TERMINAL_HANDLER_HPP_
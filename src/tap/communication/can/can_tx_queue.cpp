@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2026 Advanced Robotics at the University of Washington <robomstr@uw.edu>
+ *
+ * This file is part of Taproot.
+ *
+ * Taproot is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Taproot is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Taproot.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "can_tx_queue.hpp"
+
+#include <algorithm>
+
+#include "tap/architecture/clock.hpp"
+#include "tap/drivers.hpp"
+#include "tap/errors/create_errors.hpp"
+
+namespace tap::can
+{
+CanTxQueue::CanTxQueue(Drivers *drivers) : drivers(drivers) {}
+
+bool CanTxQueue::queueMessage(
+    CanBus bus,
+    const modm::can::Message &message,
+    CanTxPriority priority,
+    uint32_t maxAgeUs)
+{
+    BusQueue &queue = queues[static_cast<int>(bus)];
+    uint32_t now = arch::clock::getTimeMicroseconds();
+
+    Entry *entry = nullptr;
+    for (uint8_t i = 0; i < queue.size; i++)
+    {
+        const modm::can::Message &queued = queue.entries[i].message;
+        if (queued.getIdentifier() == message.getIdentifier() &&
+            queued.isExtended() == message.isExtended())
+        {
+            entry = &queue.entries[i];
+            queue.stats.replaced++;
+            break;
+        }
+    }
+
+    if (entry == nullptr && queue.size == CAPACITY)
+    {
+        // Evict the newest of the lowest priority frames, if they rank below the new one
+        int worst = 0;
+        for (uint8_t i = 1; i < queue.size; i++)
+        {
+            const Entry &candidate = queue.entries[i];
+            if (candidate.priority > queue.entries[worst].priority ||
+                (candidate.priority == queue.entries[worst].priority &&
+                 static_cast<int32_t>(candidate.sequence - queue.entries[worst].sequence) > 0))
+            {
+                worst = i;
+            }
+        }
+
+        queue.stats.dropped++;
+        if (queue.entries[worst].priority <= priority)
+        {
+            return false;
+        }
+        removeEntry(queue, worst);
+    }
+
+    if (entry == nullptr)
+    {
+        entry = &queue.entries[queue.size++];
+        entry->sequence = nextSequence++;
+        queue.stats.maxQueued = std::max(queue.stats.maxQueued, queue.size);
+    }
+
+    entry->message = message;
+    entry->priority = priority;
+    entry->hasDeadline = maxAgeUs != NO_DEADLINE;
+    entry->deadline = now + maxAgeUs;
+
+    drain(bus);
+    return true;
+}
+
+void CanTxQueue::drain()
+{
+    drain(CanBus::CAN_BUS1);
+    drain(CanBus::CAN_BUS2);
+}
+
+void CanTxQueue::drain(CanBus bus)
+{
+    BusQueue &queue = queues[static_cast<int>(bus)];
+    if (queue.size == 0)
+    {
+        return;
+    }
+
+    removeExpiredEntries(queue, arch::clock::getTimeMicroseconds());
+
+    int next;
+    while ((next = findNextEntry(queue)) >= 0 && drivers->can.isReadyToSend(bus))
+    {
+        if (!drivers->can.sendMessage(bus, queue.entries[next].message))
+        {
+            queue.stats.sendFailures++;
+            RAISE_ERROR(drivers, "can tx queue failed to send message");
+            break;
+        }
+        queue.stats.sent++;
+        removeEntry(queue, next);
+    }
+}
+
+void CanTxQueue::resetTxQueueStats()
+{
+    for (BusQueue &queue : queues)
+    {
+        queue.stats = TxQueueStats();
+    }
+}
+
+void CanTxQueue::removeEntry(BusQueue &queue, uint8_t index)
+{
+    queue.size--;
+    if (index != queue.size)
+    {
+        queue.entries[index] = queue.entries[queue.size];
+    }
+}
+
+int CanTxQueue::findNextEntry(const BusQueue &queue)
+{
+    int next = -1;
+    for (uint8_t i = 0; i < queue.size; i++)
+    {
+        const Entry &candidate = queue.entries[i];
+        if (next < 0 || candidate.priority < queue.entries[next].priority ||
+            (candidate.priority == queue.entries[next].priority &&
+             static_cast<int32_t>(candidate.sequence - queue.entries[next].sequence) < 0))
+        {
+            next = i;
+        }
+    }
+    return next;
+}
+
+void CanTxQueue::removeExpiredEntries(BusQueue &queue, uint32_t now)
+{
+    for (uint8_t i = 0; i < queue.size;)
+    {
+        const Entry &entry = queue.entries[i];
+        if (entry.hasDeadline && static_cast<int32_t>(now - entry.deadline) > 0)
+        {
+            queue.stats.expired++;
+            removeEntry(queue, i);
+            RAISE_ERROR(drivers, "can tx message expired before it was sent");
+        }
+        else
+        {
+            i++;
+        }
+    }
+}
+}  // namespace tap::can
@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) 2026 Advanced Robotics at the University of Washington <robomstr@uw.edu>
+ *
+ * This file is part of Taproot.
+ *
+ * Taproot is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Taproot is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Taproot.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef TAPROOT_CAN_TX_QUEUE_HPP_
+#define TAPROOT_CAN_TX_QUEUE_HPP_
+
+#include <cstdint>
+
+#include "tap/util_macros.hpp"
+
+#include "modm/architecture/interface/can_message.hpp"
+
+#include "can_bus.hpp"
+
+namespace tap
+{
+class Drivers;
+}
+
+namespace tap::can
+{
+/**
+ * Order in which queued frames are handed to the CAN peripheral. Frames of the same priority are
+ * sent in the order they were first queued.
+ */
+enum class CanTxPriority : uint8_t
+{
+    /// Motor setpoints and anything else that must go out every control tick.
+    HIGH = 0,
+    NORMAL,
+    /// Frames that may wait, such as heartbeats with a generous timeout.
+    LOW,
+};
+
+/**
+ * A per-bus transmit queue that sits in front of `Can::sendMessage`, so frames that do not fit
+ * in the peripheral's mailboxes right away wait for a free mailbox instead of being dropped.
+ *
+ * - A frame queued with the same bus, identifier and identifier type as a frame that is still
+ *   waiting replaces that frame's payload, priority and deadline but keeps its place in line.
+ *   Periodic senders such as motor setpoints therefore never have more than one frame waiting
+ *   and the newest setpoint is always the one sent.
+ * - A frame may be given a max age. If it has not been sent by then it is discarded rather than
+ *   sent late and an error is raised.
+ * - When a bus's queue is full, a new frame evicts the newest frame with a strictly lower
+ *   priority, otherwise it is rejected.
+ *
+ * The queue is drained whenever a frame is queued and on every `CanRxHandler::pollCanData` call,
+ * which sends as many waiting frames as the peripheral accepts. modm owns the CAN transmit
+ * interrupts, so draining from the high frequency receive poll is the closest this can get to the
+ * transmit complete path. If `Can::sendMessage` refuses a frame, an error is raised and the frame
+ * stays queued.
+ *
+ * @note Not interrupt safe. Queue and drain frames from the main loop only.
+ */
+class CanTxQueue
+{
+public:
+    /// Number of CAN buses with a queue.
+    static constexpr int NUM_CAN_BUSES = 2;
+
+    /// Max number of frames waiting per bus.
+    static constexpr uint8_t CAPACITY = 24;
+
+    /// Pass as `maxAgeUs` for frames that should wait for as long as it takes.
+    static constexpr uint32_t NO_DEADLINE = 0;
+
+    /**
+     * Counters for a single bus, see `getTxQueueStats`.
+     */
+    struct TxQueueStats
+    {
+        /// Frames successfully handed to the CAN peripheral.
+        uint32_t sent = 0;
+        /// Frames whose payload was replaced by a newer frame before being sent.
+        uint32_t replaced = 0;
+        /// Frames discarded because their deadline passed before they could be sent.
+        uint32_t expired = 0;
+        /// Frames rejected or evicted because the queue was full.
+        uint32_t dropped = 0;
+        /// Times `Can::sendMessage` refused a frame after `Can::isReadyToSend` returned true.
+        uint32_t sendFailures = 0;
+        /// Most frames ever waiting at once.
+        uint8_t maxQueued = 0;
+    };
+
+    CanTxQueue(Drivers *drivers);
+    DISALLOW_COPY_AND_ASSIGN(CanTxQueue)
+    mockable ~CanTxQueue() = default;
+
+    /**
+     * Queues `message` to be sent on `bus` and sends as many waiting frames as the bus accepts.
+     *
+     * @param[in] priority Frames with a higher priority are sent first.
+     * @param[in] maxAgeUs Microseconds from now after which the frame is discarded if it has not
+     *      been sent, or `NO_DEADLINE`.
+     * @return `false` if the queue was full and the frame was rejected.
+     */
+    mockable bool queueMessage(
+        CanBus bus,
+        const modm::can::Message &message,
+        CanTxPriority priority = CanTxPriority::NORMAL,
+        uint32_t maxAgeUs = NO_DEADLINE);
+
+    /**
+     * Sends waiting frames on both buses, highest priority first, until the queues are empty or
+     * the peripheral cannot take another frame. Frames past their deadline are discarded.
+     */
+    mockable void drain();
+
+    /// Drains the queue of a single bus, see `drain()`.
+    void drain(CanBus bus);
+
+    /// @return The number of frames waiting to be sent on `bus`.
+    uint8_t getNumQueued(CanBus bus) const { return queues[static_cast<int>(bus)].size; }
+
+    inline const TxQueueStats &getTxQueueStats(CanBus bus) const
+    {
+        return queues[static_cast<int>(bus)].stats;
+    }
+
+    /// Clears the counters of both buses. Waiting frames are kept.
+    void resetTxQueueStats();
+
+private:
+    struct Entry
+    {
+        modm::can::Message message;
+        /// Time, in microseconds, after which the frame is discarded. Unused without a deadline.
+        uint32_t deadline;
+        /// Order the frame was first queued in, used to break ties between equal priorities.
+        uint32_t sequence;
+        CanTxPriority priority;
+        bool hasDeadline;
+    };
+
+    struct BusQueue
+    {
+        /// Waiting frames, unordered. Only the first `size` are valid.
+        Entry entries[CAPACITY];
+        uint8_t size = 0;
+        TxQueueStats stats;
+    };
+
+    Drivers *drivers;
+
+    BusQueue queues[NUM_CAN_BUSES];
+
+    uint32_t nextSequence = 0;
+
+    /// Removes the entry at `index`, moving the last entry into its place.
+    static void removeEntry(BusQueue &queue, uint8_t index);
+
+    /// @return The index of the frame to send next, or -1 if none are waiting.
+    static int findNextEntry(const BusQueue &queue);
+
+    /// Discards every frame past its deadline.
+    void removeExpiredEntries(BusQueue &queue, uint32_t now);
+};  // class CanTxQueue
+}  // namespace tap::can
+
+#endif  // TAPROOT_CAN_TX_QUEUE_HPP_
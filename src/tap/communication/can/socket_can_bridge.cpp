@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2026 Advanced Robotics at the University of Washington <robomstr@uw.edu>
+ *
+ * This file is part of Taproot.
+ *
+ * Taproot is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Taproot is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Taproot.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifdef PLATFORM_HOSTED
+
+#include "socket_can_bridge.hpp"
+
+#ifdef __linux__
+#include <fcntl.h>
+#include <linux/can.h>
+#include <linux/can/raw.h>
+#include <net/if.h>
+#include <stdio.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstring>
+#endif  // __linux__
+
+namespace tap::can
+{
+SocketCanBridge::SocketCanBridge(VirtualCanBus *bus) : bus(bus) { bus->attachNode(this); }
+
+SocketCanBridge::~SocketCanBridge()
+{
+    close();
+    bus->detachNode(this);
+}
+
+bool SocketCanBridge::open(const char *interfaceName)
+{
+    close();
+
+#ifdef __linux__
+    int descriptor = socket(PF_CAN, SOCK_RAW, CAN_RAW);
+    if (descriptor < 0)
+    {
+        perror("SocketCanBridge failed to open socket");
+        return false;
+    }
+
+    ifreq interfaceRequest{};
+    std::strncpy(interfaceRequest.ifr_name, interfaceName, IFNAMSIZ - 1);
+    if (ioctl(descriptor, SIOCGIFINDEX, &interfaceRequest) < 0)
+    {
+        perror("SocketCanBridge failed to find interface");
+        ::close(descriptor);
+        return false;
+    }
+
+    sockaddr_can address{};
+    address.can_family = AF_CAN;
+    address.can_ifindex = interfaceRequest.ifr_ifindex;
+    if (bind(descriptor, reinterpret_cast<sockaddr *>(&address), sizeof(address)) < 0 ||
+        fcntl(descriptor, F_SETFL, O_NONBLOCK) < 0)
+    {
+        perror("SocketCanBridge failed to bind socket");
+        ::close(descriptor);
+        return false;
+    }
+
+    socketDescriptor = descriptor;
+    return true;
+#else
+    UNUSED(interfaceName);
+    return false;
+#endif  // __linux__
+}
+
+void SocketCanBridge::close()
+{
+#ifdef __linux__
+    if (socketDescriptor >= 0)
+    {
+        ::close(socketDescriptor);
+    }
+#endif  // __linux__
+    socketDescriptor = -1;
+}
+
+void SocketCanBridge::onFrameReceived(const modm::can::Message &message, uint64_t time)
+{
+    UNUSED(time);
+
+    if (!isOpen())
+    {
+        return;
+    }
+
+#ifdef __linux__
+    can_frame frame{};
+    frame.can_id = message.getIdentifier();
+    if (message.isExtended())
+    {
+        frame.can_id |= CAN_EFF_FLAG;
+    }
+    if (message.isRemoteTransmitRequest())
+    {
+        frame.can_id |= CAN_RTR_FLAG;
+    }
+    frame.can_dlc = message.getLength();
+    std::memcpy(frame.data, message.data, sizeof(frame.data));
+
+    if (write(socketDescriptor, &frame, sizeof(frame)) != sizeof(frame))
+    {
+        writeFailures++;
+    }
+#else
+    UNUSED(message);
+#endif  // __linux__
+}
+
+uint64_t SocketCanBridge::update(uint64_t time)
+{
+#ifdef __linux__
+    can_frame frame;
+    while (isOpen() && read(socketDescriptor, &frame, sizeof(frame)) == sizeof(frame))
+    {
+        if (frame.can_id & CAN_ERR_FLAG)
+        {
+            continue;
+        }
+
+        bool extended = frame.can_id & CAN_EFF_FLAG;
+        modm::can::Message message(
+            frame.can_id & (extended ? CAN_EFF_MASK : CAN_SFF_MASK),
+            std::min<uint8_t>(frame.can_dlc, 8),
+            0,
+            extended);
+        message.setRemoteTransmitRequest(frame.can_id & CAN_RTR_FLAG);
+        std::memcpy(message.data, frame.data, sizeof(frame.data));
+        bus->transmit(this, message);
+    }
+#endif  // __linux__
+
+    return time + POLL_PERIOD_US;
+}
+}  // namespace tap::can
+
+#endif  // PLATFORM_HOSTED
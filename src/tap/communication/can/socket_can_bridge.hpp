@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2026 Advanced Robotics at the University of Washington <robomstr@uw.edu>
+ *
+ * This file is part of Taproot.
+ *
+ * Taproot is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Taproot is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Taproot.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef TAPROOT_SOCKET_CAN_BRIDGE_HPP_
+#define TAPROOT_SOCKET_CAN_BRIDGE_HPP_
+
+#ifdef PLATFORM_HOSTED
+
+#include <cstdint>
+
+#include "tap/util_macros.hpp"
+
+#include "virtual_can_bus.hpp"
+
+namespace tap::can
+{
+/**
+ * Connects a `VirtualCanBus` to a Linux SocketCAN interface, usually a `vcan` interface, so the
+ * hosted robot code can talk to processes outside of the simulation: `candump` and `cansend`,
+ * simulators of other devices, or a USB CAN adapter wired to real hardware.
+ *
+ * Frames sent on the virtual bus by other nodes are written to the interface and frames read from
+ * the interface are sent on the virtual bus as if this node had sent them. The interface is
+ * polled every `POLL_PERIOD_US` of bus time.
+ *
+ * ```
+ * sudo ip link add dev vcan0 type vcan && sudo ip link set up vcan0
+ * ```
+ *
+ * ```
+ * tap::can::SocketCanBridge bridge(&tap::can::Can::getVirtualBus(tap::can::CanBus::CAN_BUS1));
+ * bridge.open("vcan0");
+ * ```
+ *
+ * @note Only available on Linux, `open` fails elsewhere.
+ */
+class SocketCanBridge : public VirtualCanNode
+{
+public:
+    static constexpr uint32_t POLL_PERIOD_US = 100;
+
+    /// Attaches the bridge to `bus`. Frames are only bridged once `open` succeeds.
+    explicit SocketCanBridge(VirtualCanBus *bus);
+    DISALLOW_COPY_AND_ASSIGN(SocketCanBridge)
+    ~SocketCanBridge();
+
+    /**
+     * Opens the SocketCAN interface `interfaceName`, closing any interface already open.
+     *
+     * @return `false` if the interface could not be opened, see `errno`.
+     */
+    bool open(const char *interfaceName);
+
+    void close();
+
+    inline bool isOpen() const { return socketDescriptor >= 0; }
+
+    /// @return The number of frames that could not be written to the interface.
+    inline uint32_t getWriteFailures() const { return writeFailures; }
+
+    void onFrameReceived(const modm::can::Message &message, uint64_t time) override;
+
+    uint64_t update(uint64_t time) override;
+
+private:
+    VirtualCanBus *bus;
+
+    int socketDescriptor = -1;
+
+    uint32_t writeFailures = 0;
+};  // class SocketCanBridge
+}  // namespace tap::can
+
+#endif  // PLATFORM_HOSTED
+
+#endif  // TAPROOT_SOCKET_CAN_BRIDGE_HPP_
@@ -0,0 +1,230 @@
+/*
+ * Copyright (c) 2026 Advanced Robotics at the University of Washington <robomstr@uw.edu>
+ *
+ * This file is part of Taproot.
+ *
+ * Taproot is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Taproot is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Taproot.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifdef PLATFORM_HOSTED
+
+#include "virtual_can_bus.hpp"
+
+#include <algorithm>
+
+#include "can_bus_load_monitor.hpp"
+
+namespace tap::can
+{
+VirtualCanBus::VirtualCanBus(uint32_t bitrate) : bitrate(bitrate) {}
+
+void VirtualCanBus::attachNode(VirtualCanNode *node)
+{
+    nodes.push_back({node, currentTime});
+}
+
+void VirtualCanBus::detachNode(VirtualCanNode *node)
+{
+    nodes.erase(
+        std::remove_if(
+            nodes.begin(),
+            nodes.end(),
+            [node](const NodeEntry &entry) { return entry.node == node; }),
+        nodes.end());
+    waitingFrames.erase(
+        std::remove_if(
+            waitingFrames.begin(),
+            waitingFrames.end(),
+            [node](const WaitingFrame &frame) { return frame.sender == node; }),
+        waitingFrames.end());
+
+    if (frameInProgress && currentFrame.sender == node)
+    {
+        // The frame is already on the wire, it is still received by everyone else
+        currentFrame.sender = nullptr;
+    }
+}
+
+void VirtualCanBus::transmit(VirtualCanNode *sender, const modm::can::Message &message)
+{
+    waitingFrames.push_back({sender, message, currentTime, nextSequence++});
+}
+
+void VirtualCanBus::advanceTo(uint64_t time)
+{
+    if (!started)
+    {
+        start(time);
+    }
+
+    if (time < currentTime)
+    {
+        return;
+    }
+
+    while (true)
+    {
+        uint64_t nextUpdateTime = VirtualCanNode::NO_UPDATE;
+        for (const NodeEntry &entry : nodes)
+        {
+            nextUpdateTime = std::min(nextUpdateTime, entry.nextUpdateTime);
+        }
+        uint64_t nextFrameEventTime = getNextFrameEventTime();
+
+        uint64_t nextEventTime = std::min(nextUpdateTime, nextFrameEventTime);
+        if (nextEventTime == VirtualCanNode::NO_UPDATE || nextEventTime > time)
+        {
+            break;
+        }
+        currentTime = std::max(currentTime, nextEventTime);
+
+        // Nodes are updated first so that frames they queue now take part in arbitration now
+        if (nextUpdateTime <= nextFrameEventTime)
+        {
+            for (std::size_t i = 0; i < nodes.size(); i++)
+            {
+                if (nodes[i].nextUpdateTime <= currentTime)
+                {
+                    uint64_t requested = nodes[i].node->update(currentTime);
+                    nodes[i].nextUpdateTime = requested == VirtualCanNode::NO_UPDATE
+                                                  ? requested
+                                                  : std::max(requested, currentTime + 1);
+                }
+            }
+        }
+        else if (frameInProgress)
+        {
+            finishFrame();
+        }
+        else
+        {
+            startFrame(currentTime);
+        }
+    }
+
+    currentTime = time;
+}
+
+void VirtualCanBus::start(uint64_t time)
+{
+    started = true;
+    currentTime = std::max(currentTime, time);
+    busIdleTime = std::max(busIdleTime, currentTime);
+
+    for (NodeEntry &entry : nodes)
+    {
+        if (entry.nextUpdateTime != VirtualCanNode::NO_UPDATE)
+        {
+            entry.nextUpdateTime = std::max(entry.nextUpdateTime, currentTime);
+        }
+    }
+    for (WaitingFrame &frame : waitingFrames)
+    {
+        frame.queuedTime = std::max(frame.queuedTime, currentTime);
+    }
+}
+
+uint32_t VirtualCanBus::getArbitrationKey(const modm::can::Message &message)
+{
+    uint32_t identifier = message.getIdentifier();
+    uint32_t remote = message.isRemoteTransmitRequest() ? 1 : 0;
+
+    // Key bits from most to least significant follow the arbitration field: 11 bit base
+    // identifier, RTR (standard) or SRR (extended, always recessive), IDE, then for extended
+    // frames the 18 bit identifier extension and RTR. A recessive bit loses, so it is a 1.
+    if (message.isExtended())
+    {
+        uint32_t base = (identifier >> 18) & 0x7ff;
+        uint32_t extension = identifier & 0x3'ffff;
+        return (base << 21) | (1 << 20) | (1 << 19) | (extension << 1) | remote;
+    }
+    return ((identifier & 0x7ff) << 21) | (remote << 20);
+}
+
+uint32_t VirtualCanBus::getFrameTime(const modm::can::Message &message) const
+{
+    uint64_t bits = CanBusLoadMonitor::getFrameBits(message);
+    return static_cast<uint32_t>((bits * 1'000'000 + bitrate - 1) / bitrate);
+}
+
+uint64_t VirtualCanBus::getNextFrameEventTime() const
+{
+    if (frameInProgress)
+    {
+        return currentFrameEndTime;
+    }
+    if (waitingFrames.empty())
+    {
+        return VirtualCanNode::NO_UPDATE;
+    }
+
+    uint64_t earliestQueuedTime = waitingFrames[0].queuedTime;
+    for (const WaitingFrame &frame : waitingFrames)
+    {
+        earliestQueuedTime = std::min(earliestQueuedTime, frame.queuedTime);
+    }
+    return std::max(busIdleTime, earliestQueuedTime);
+}
+
+void VirtualCanBus::startFrame(uint64_t time)
+{
+    auto winner = waitingFrames.end();
+    uint32_t winnerKey = 0;
+    for (auto frame = waitingFrames.begin(); frame != waitingFrames.end(); frame++)
+    {
+        if (frame->queuedTime > time)
+        {
+            continue;
+        }
+
+        uint32_t key = getArbitrationKey(frame->message);
+        if (winner == waitingFrames.end() || key < winnerKey ||
+            (key == winnerKey && frame->sequence < winner->sequence))
+        {
+            winner = frame;
+            winnerKey = key;
+        }
+    }
+
+    currentFrame = *winner;
+    waitingFrames.erase(winner);
+    frameInProgress = true;
+
+    uint32_t frameTime = getFrameTime(currentFrame.message);
+    uint32_t interframeTime = (INTERFRAME_SPACE_BITS * 1'000'000 + bitrate - 1) / bitrate;
+    currentFrameEndTime = time + frameTime - std::min(frameTime, interframeTime);
+    busIdleTime = time + frameTime;
+}
+
+void VirtualCanBus::finishFrame()
+{
+    frameInProgress = false;
+    framesSent++;
+
+    // Nodes may transmit from their callbacks, which does not touch `currentFrame`
+    for (std::size_t i = 0; i < nodes.size(); i++)
+    {
+        if (nodes[i].node == currentFrame.sender)
+        {
+            nodes[i].node->onFrameTransmitted(currentFrame.message, currentFrameEndTime);
+        }
+        else
+        {
+            nodes[i].node->onFrameReceived(currentFrame.message, currentFrameEndTime);
+        }
+    }
+}
+}  // namespace tap::can
+
+#endif  // PLATFORM_HOSTED
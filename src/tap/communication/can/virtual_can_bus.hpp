@@ -0,0 +1,212 @@
+/*
+ * Copyright (c) 2026 Advanced Robotics at the University of Washington <robomstr@uw.edu>
+ *
+ * This file is part of Taproot.
+ *
+ * Taproot is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Taproot is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Taproot.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef TAPROOT_VIRTUAL_CAN_BUS_HPP_
+#define TAPROOT_VIRTUAL_CAN_BUS_HPP_
+
+#ifdef PLATFORM_HOSTED
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "tap/util_macros.hpp"
+
+#include "modm/architecture/interface/can_message.hpp"
+
+namespace tap::can
+{
+class VirtualCanBus;
+
+/**
+ * Something attached to a `VirtualCanBus`: the robot's own CAN controller (see
+ * `VirtualCanController`), a simulated device or a bridge to another bus.
+ *
+ * Nodes transmit frames with `VirtualCanBus::transmit` and are told about every frame other nodes
+ * transmit.
+ */
+class VirtualCanNode
+{
+public:
+    /// Returned by `update` when the node does not need to be updated again.
+    static constexpr uint64_t NO_UPDATE = UINT64_MAX;
+
+    virtual ~VirtualCanNode() = default;
+
+    /**
+     * Called for every frame another node transmits, once its end of frame has been sent.
+     *
+     * @param[in] time Bus time the frame finished, in microseconds.
+     */
+    virtual void onFrameReceived(const modm::can::Message &message, uint64_t time) = 0;
+
+    /**
+     * Called once one of this node's frames has been sent.
+     */
+    virtual void onFrameTransmitted(const modm::can::Message &message, uint64_t time)
+    {
+        UNUSED(message);
+        UNUSED(time);
+    }
+
+    /**
+     * Called when the node is attached and then at the times it asks for, so that it can
+     * transmit frames on a schedule (for example periodic feedback).
+     *
+     * @param[in] time Current bus time, in microseconds.
+     * @return The bus time at which to call `update` next, after `time`, or `NO_UPDATE`.
+     */
+    virtual uint64_t update(uint64_t time)
+    {
+        UNUSED(time);
+        return NO_UPDATE;
+    }
+};
+
+/**
+ * An in-process CAN bus for hosted builds, with the timing and arbitration of a real bus.
+ *
+ * - A frame occupies the bus for `CanBusLoadMonitor::getFrameBits` bit times, so frames are
+ *   delivered as late as they would be on a real bus at the configured bitrate and a busy bus
+ *   makes frames wait.
+ * - When the bus becomes idle, the waiting frame that would win bitwise arbitration is sent
+ *   next: the lowest identifier, a standard frame before an extended frame with the same base
+ *   identifier and a data frame before a remote frame. Frames that lose wait for the next idle
+ *   bus, and only frames queued before a frame starts take part in its arbitration.
+ *
+ * Time only moves forward when `advanceTo` is called; `Can` does so with
+ * `tap::arch::clock::getTimeMicroseconds64()` whenever it is used, so simulations run at the
+ * speed of the simulation clock. The bus starts at the time first passed to `advanceTo`: nodes
+ * attached and frames queued before then act as if they were attached and queued at that time,
+ * so a clock that starts at a large value does not replay every update since time 0.
+ *
+ * @note Not thread safe.
+ */
+class VirtualCanBus
+{
+public:
+    static constexpr uint32_t DEFAULT_BITRATE = 1'000'000;
+
+    /// Bits at the end of every frame during which the bus is idle but cannot start a new frame.
+    static constexpr uint16_t INTERFRAME_SPACE_BITS = 3;
+
+    explicit VirtualCanBus(uint32_t bitrate = DEFAULT_BITRATE);
+    DISALLOW_COPY_AND_ASSIGN(VirtualCanBus)
+
+    /**
+     * Attaches `node` to the bus. Its `update` is called at the current bus time.
+     */
+    void attachNode(VirtualCanNode *node);
+
+    /**
+     * Detaches `node` from the bus and discards any frames it has waiting.
+     */
+    void detachNode(VirtualCanNode *node);
+
+    /**
+     * Queues `message` to be sent by `sender` once it wins arbitration.
+     */
+    void transmit(VirtualCanNode *sender, const modm::can::Message &message);
+
+    /**
+     * Runs the bus until `time`, sending frames and updating nodes in time order. Does nothing if
+     * `time` is before the current bus time. The first call starts the bus at `time`.
+     */
+    void advanceTo(uint64_t time);
+
+    /// @return The time the bus has been run to, in microseconds.
+    inline uint64_t getTime() const { return currentTime; }
+
+    inline uint32_t getBitrate() const { return bitrate; }
+
+    /// @return The number of frames waiting for the bus, not counting one being sent.
+    inline std::size_t getNumWaiting() const { return waitingFrames.size(); }
+
+    /// @return The number of frames sent since construction.
+    inline uint32_t getFramesSent() const { return framesSent; }
+
+    /**
+     * @return A value that orders frames the way bitwise arbitration does: of two frames, the one
+     *      with the lower key wins.
+     */
+    static uint32_t getArbitrationKey(const modm::can::Message &message);
+
+    /// @return Microseconds `message` takes to send, including the interframe space.
+    uint32_t getFrameTime(const modm::can::Message &message) const;
+
+private:
+    struct WaitingFrame
+    {
+        VirtualCanNode *sender;
+        modm::can::Message message;
+        uint64_t queuedTime;
+        /// Breaks arbitration ties, which would be errors on a real bus, in queued order.
+        uint32_t sequence;
+    };
+
+    struct NodeEntry
+    {
+        VirtualCanNode *node;
+        uint64_t nextUpdateTime;
+    };
+
+    const uint32_t bitrate;
+
+    std::vector<NodeEntry> nodes;
+
+    std::vector<WaitingFrame> waitingFrames;
+
+    /// The frame being sent, valid if `frameInProgress`.
+    WaitingFrame currentFrame;
+    bool frameInProgress = false;
+    /// Time the end of frame of `currentFrame` is sent.
+    uint64_t currentFrameEndTime = 0;
+
+    /// Earliest time a new frame may start.
+    uint64_t busIdleTime = 0;
+
+    uint64_t currentTime = 0;
+
+    /// Whether `advanceTo` has been called, see `start`.
+    bool started = false;
+
+    uint32_t nextSequence = 0;
+
+    uint32_t framesSent = 0;
+
+    /**
+     * Moves the bus time forward to `time` without running anything in between. Nodes due
+     * before then are updated at `time` and waiting frames are treated as queued at `time`.
+     */
+    void start(uint64_t time);
+
+    /// @return Time of the next frame start or end, or `NO_UPDATE` if the bus will stay idle.
+    uint64_t getNextFrameEventTime() const;
+
+    /// Moves the waiting frame that wins arbitration at `time` onto the bus.
+    void startFrame(uint64_t time);
+
+    /// Delivers `currentFrame` to every node.
+    void finishFrame();
+};  // class VirtualCanBus
+}  // namespace tap::can
+
+#endif  // PLATFORM_HOSTED
+
+#endif  // TAPROOT_VIRTUAL_CAN_BUS_HPP_
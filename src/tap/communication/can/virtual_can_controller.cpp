@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2026 Advanced Robotics at the University of Washington <robomstr@uw.edu>
+ *
+ * This file is part of Taproot.
+ *
+ * Taproot is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Taproot is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Taproot.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifdef PLATFORM_HOSTED
+
+#include "virtual_can_controller.hpp"
+
+namespace tap::can
+{
+VirtualCanController::VirtualCanController(VirtualCanBus *bus) : bus(bus)
+{
+    bus->attachNode(this);
+}
+
+VirtualCanController::~VirtualCanController() { bus->detachNode(this); }
+
+bool VirtualCanController::sendMessage(const modm::can::Message &message)
+{
+    if (!isReadyToSend())
+    {
+        return false;
+    }
+
+    pendingTransmits++;
+    bus->transmit(this, message);
+    return true;
+}
+
+bool VirtualCanController::getMessage(modm::can::Message *message, uint32_t *arrivalTime)
+{
+    TimestampedCanMessage frame;
+    if (!rxRing.pop(&frame))
+    {
+        return false;
+    }
+
+    *message = frame.message;
+    if (arrivalTime != nullptr)
+    {
+        *arrivalTime = frame.arrivalTime;
+    }
+    return true;
+}
+
+void VirtualCanController::onFrameReceived(const modm::can::Message &message, uint64_t time)
+{
+    // Truncated to match `tap::arch::clock::getTimeMicroseconds()`
+    rxRing.push(message, static_cast<uint32_t>(time));
+}
+
+void VirtualCanController::onFrameTransmitted(const modm::can::Message &message, uint64_t time)
+{
+    UNUSED(message);
+    UNUSED(time);
+    pendingTransmits--;
+}
+}  // namespace tap::can
+
+#endif  // PLATFORM_HOSTED
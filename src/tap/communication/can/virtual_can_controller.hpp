@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2026 Advanced Robotics at the University of Washington <robomstr@uw.edu>
+ *
+ * This file is part of Taproot.
+ *
+ * Taproot is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Taproot is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Taproot.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef TAPROOT_VIRTUAL_CAN_CONTROLLER_HPP_
+#define TAPROOT_VIRTUAL_CAN_CONTROLLER_HPP_
+
+#ifdef PLATFORM_HOSTED
+
+#include <cstdint>
+
+#include "tap/util_macros.hpp"
+
+#include "modm/architecture/interface/can_message.hpp"
+
+#include "can_rx_ring.hpp"
+#include "virtual_can_bus.hpp"
+
+namespace tap::can
+{
+/**
+ * The robot's own CAN peripheral as a node on a `VirtualCanBus`, used by `Can` in hosted builds.
+ *
+ * Behaves like the bxCAN peripheral on target: frames are sent from one of
+ * `NUM_TX_MAILBOXES` transmit mailboxes, so `isReadyToSend` is false while all of them wait
+ * for the bus, and every frame received is timestamped and kept in a `CanRxRing` until read.
+ */
+class VirtualCanController : public VirtualCanNode
+{
+public:
+    /// Number of frames that may wait for the bus at once, as on the bxCAN peripheral.
+    static constexpr uint8_t NUM_TX_MAILBOXES = 3;
+
+    explicit VirtualCanController(VirtualCanBus *bus);
+    DISALLOW_COPY_AND_ASSIGN(VirtualCanController)
+    ~VirtualCanController();
+
+    /// @return `true` if a transmit mailbox is free.
+    inline bool isReadyToSend() const { return pendingTransmits < NUM_TX_MAILBOXES; }
+
+    /**
+     * Puts `message` in a free transmit mailbox.
+     *
+     * @return `false` if every mailbox is in use.
+     */
+    bool sendMessage(const modm::can::Message &message);
+
+    /// @return `true` if a received frame is waiting to be read.
+    inline bool isMessageAvailable() const { return !rxRing.empty(); }
+
+    /**
+     * Reads the oldest received frame.
+     *
+     * @param[out] arrivalTime If not `nullptr`, set to the bus time the frame finished.
+     * @return `false` if no frame was waiting.
+     */
+    bool getMessage(modm::can::Message *message, uint32_t *arrivalTime);
+
+    /// @return The number of received frames dropped because they were not read in time.
+    inline uint32_t getRxOverflowCount() const { return rxRing.getOverflowCount(); }
+
+    void onFrameReceived(const modm::can::Message &message, uint64_t time) override;
+
+    void onFrameTransmitted(const modm::can::Message &message, uint64_t time) override;
+
+private:
+    VirtualCanBus *bus;
+
+    CanRxRing rxRing;
+
+    /// Frames handed to the bus that have not been sent yet.
+    uint8_t pendingTransmits = 0;
+};  // class VirtualCanController
+}  // namespace tap::can
+
+#endif  // PLATFORM_HOSTED
+
+#endif  // TAPROOT_VIRTUAL_CAN_CONTROLLER_HPP_
@@ -48,6 +48,10 @@ class EncoderInterface
      * Gets the current velocity reported by the encoder. Returned in a value of radians / second
      */
     virtual float getVelocity() const = 0;
+    /**
+     * Gets the current acceleration of the encoder. Returned in a value of radians / second^2
+     */
+    virtual float getAcceleration() const = 0;
     /**
      * Aligns this encoder to another encoder so that their positions are equal.
      * If the two encoders are mechanically linked, they would then continue to report the same
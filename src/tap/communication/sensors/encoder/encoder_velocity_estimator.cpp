@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2026 Advanced Robotics at the University of Washington <robomstr@uw.edu>
+ *
+ * This file is part of Taproot.
+ *
+ * Taproot is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Taproot is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Taproot.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "encoder_velocity_estimator.hpp"
+
+namespace tap::encoder
+{
+EncoderVelocityEstimator::EncoderVelocityEstimator(const EncoderVelocityEstimatorConfig &config)
+    : config(config)
+{
+}
+
+void EncoderVelocityEstimator::update(float positionDelta, float reportedVelocity, uint32_t time)
+{
+    uint32_t periodUs = time - lastUpdateTime;
+    if (initialized && periodUs == 0)
+    {
+        return;
+    }
+
+    lastUpdateTime = time;
+    if (!initialized || periodUs > config.maxUpdatePeriodUs)
+    {
+        initialized = true;
+        positionOffset = 0;
+        velocity = reportedVelocity;
+        acceleration = 0;
+        blendedVelocity = reportedVelocity;
+        return;
+    }
+
+    float dt = periodUs / 1'000'000.0f;
+
+    // Predict the position relative to the last measurement, then correct by the residual
+    float predictedOffset = positionOffset + velocity * dt + 0.5f * acceleration * dt * dt;
+    float residual = positionDelta - predictedOffset;
+
+    positionOffset = -(1 - config.positionGain) * residual;
+    velocity += acceleration * dt + config.velocityGain / dt * residual;
+    acceleration += 2 * config.accelerationGain / (dt * dt) * residual;
+
+    // Blended only into the output, feeding a reported velocity that disagrees with the
+    // positions back into the filter would bias the acceleration
+    blendedVelocity = velocity + config.reportedVelocityWeight * (reportedVelocity - velocity);
+}
+
+void EncoderVelocityEstimator::reset()
+{
+    initialized = false;
+    positionOffset = 0;
+    velocity = 0;
+    acceleration = 0;
+    blendedVelocity = 0;
+}
+}  // namespace tap::encoder
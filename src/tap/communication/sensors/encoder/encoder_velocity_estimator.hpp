@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2026 Advanced Robotics at the University of Washington <robomstr@uw.edu>
+ *
+ * This file is part of Taproot.
+ *
+ * Taproot is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Taproot is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Taproot.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef TAPROOT_ENCODER_VELOCITY_ESTIMATOR_HPP_
+#define TAPROOT_ENCODER_VELOCITY_ESTIMATOR_HPP_
+
+#include <cstdint>
+
+namespace tap::encoder
+{
+/**
+ * Gains of an EncoderVelocityEstimator. The defaults suit a 1 kHz update rate and a few thousand
+ * encoder ticks per revolution, such as DJI motor feedback.
+ */
+struct EncoderVelocityEstimatorConfig
+{
+    /// Fraction of a position residual that corrects the position estimate, in (0, 1].
+    float positionGain = 0.3f;
+    /// A position residual corrects the velocity estimate by `velocityGain * residual / dt`.
+    float velocityGain = 0.05f;
+    /// A position residual corrects the acceleration estimate by
+    /// `2 * accelerationGain * residual / dt^2`.
+    float accelerationGain = 0.004f;
+    /// Weight of the reported velocity in `getVelocity()`, in [0, 1]. 0 ignores the reported
+    /// velocity.
+    float reportedVelocityWeight = 0.05f;
+    /// Updates further apart than this restart the estimator, in microseconds.
+    uint32_t maxUpdatePeriodUs = 20'000;
+};
+
+/**
+ * Estimates the velocity and acceleration of a shaft from the position deltas of a quantized
+ * encoder and the time each position was measured. The velocity is blended with one reported by
+ * the sensor itself.
+ *
+ * This is an alpha-beta-gamma tracking filter: each update predicts the new position from the
+ * current velocity and acceleration and corrects all three by a fraction of the difference to the
+ * measured position. Because the prediction follows a constant acceleration, the estimate does
+ * not lag behind a steadily changing velocity the way a low pass filter of the same noise does.
+ *
+ * The filter only works with position deltas, so it keeps full precision however far the shaft
+ * has turned.
+ */
+class EncoderVelocityEstimator
+{
+public:
+    explicit EncoderVelocityEstimator(const EncoderVelocityEstimatorConfig &config = {});
+
+    void setConfig(const EncoderVelocityEstimatorConfig &config) { this->config = config; }
+
+    /**
+     * Adds a position measurement.
+     *
+     * @param[in] positionDelta Change in measured position since the previous update, in
+     *      radians.
+     * @param[in] reportedVelocity Velocity reported by the sensor at the time of the
+     *      measurement, in radians / second. Pass 0 and set `reportedVelocityWeight` to 0 if the
+     *      sensor reports none.
+     * @param[in] time Time the position was measured, in microseconds. Updates at the same time
+     *      as the previous one are ignored.
+     */
+    void update(float positionDelta, float reportedVelocity, uint32_t time);
+
+    /// Forgets all updates, the next update restarts the estimator at the reported velocity.
+    void reset();
+
+    /// @return `true` once the estimator has received an update.
+    inline bool isInitialized() const { return initialized; }
+
+    /// @return The estimated velocity blended with the reported velocity, in radians / second.
+    inline float getVelocity() const { return blendedVelocity; }
+
+    /// @return The estimated acceleration, in radians / second^2.
+    inline float getAcceleration() const { return acceleration; }
+
+private:
+    EncoderVelocityEstimatorConfig config;
+
+    bool initialized = false;
+    uint32_t lastUpdateTime = 0;
+
+    /// Estimated position relative to the last measured position, in radians.
+    float positionOffset = 0;
+    float velocity = 0;
+    float acceleration = 0;
+    float blendedVelocity = 0;
+};  // class EncoderVelocityEstimator
+}  // namespace tap::encoder
+
+#endif  // TAPROOT_ENCODER_VELOCITY_ESTIMATOR_HPP_
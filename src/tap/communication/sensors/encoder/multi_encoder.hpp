@@ -116,6 +116,24 @@ class MultiEncoder : public EncoderInterface
         return onlineEncoders == 0 ? 0 : velocity / onlineEncoders;
     };
 
+    float getAcceleration() const override
+    {
+        const_cast<MultiEncoder<COUNT>*>(this)->syncEncoders();
+        int onlineEncoders = 0;
+        float acceleration = 0;
+
+        for (uint32_t i = 0; i < COUNT; i++)
+        {
+            if (this->validEncoder(i))
+            {
+                acceleration += this->encoders[i]->getAcceleration();
+                onlineEncoders += 1;
+            }
+        }
+
+        return onlineEncoders == 0 ? 0 : acceleration / onlineEncoders;
+    }
+
     void resetEncoderValue() override
     {
         this->syncEncoders();
@@ -39,7 +39,8 @@ WrappedEncoder::WrappedEncoder(
       encoderHomePosition(tap::algorithms::WrappedFloat(encoderHomePosition, 0, encoderResolution)),
       pastPosition(tap::algorithms::Angle(0)),
       lastUpdateTime(0),
-      deltaTime(0)
+      deltaTime(0),
+      acceleration(0)
 {
 }
 
@@ -72,6 +73,8 @@ float WrappedEncoder::getVelocity() const
     return (position - pastPosition).getUnwrappedValue() / deltaTime * 1'000'000;
 }
 
+float WrappedEncoder::getAcceleration() const { return acceleration; }
+
 void WrappedEncoder::alignWith(EncoderInterface* other)
 {
     tap::algorithms::WrappedFloat positionDifference = other->getPosition() - position;
@@ -104,6 +107,8 @@ void WrappedEncoder::updateEncoderValue(uint32_t encoderActual)
         encoder += encoder.minDifference(newEncWrapped);
     }
 
+    float pastVelocity = WrappedEncoder::getVelocity();
+
     uint32_t time = tap::arch::clock::getTimeMicroseconds();
     if (time < lastUpdateTime)
     {
@@ -118,6 +123,10 @@ void WrappedEncoder::updateEncoderValue(uint32_t encoderActual)
     pastPosition = position;
     position.setUnwrappedValue(
         encoder.getUnwrappedValue() * static_cast<float>(M_TWOPI) / encoderResolution * gearRatio);
+
+    acceleration = deltaTime == 0
+                       ? 0
+                       : (WrappedEncoder::getVelocity() - pastVelocity) / deltaTime * 1'000'000;
 }
 }  // namespace encoder
 
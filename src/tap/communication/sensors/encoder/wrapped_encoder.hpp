@@ -56,6 +56,12 @@ class WrappedEncoder : public EncoderInterface
 
     float getVelocity() const override;
 
+    /**
+     * Differentiates the velocity between the last two updates, which amplifies the encoder's
+     * quantization. See EncoderVelocityEstimator for a smoother estimate.
+     */
+    float getAcceleration() const override;
+
     void alignWith(EncoderInterface* other) override;
 
     void resetEncoderValue() override;
@@ -108,6 +114,11 @@ class WrappedEncoder : public EncoderInterface
     uint32_t lastUpdateTime;
 
     uint32_t deltaTime;
+
+    /**
+     * The acceleration between the last two updates.
+     */
+    float acceleration;
 };
 
 }  // namespace tap::encoder
@@ -36,7 +36,7 @@ void Command::addSubsystemRequirement(Subsystem* requirement)
     {
         return;
     }
-    commandRequirementsBitwise |= (1UL << requirement->getGlobalIdentifier());
+    commandRequirementsBitwise.set(requirement->getGlobalIdentifier());
 }
 
 bool Command::isReady() { return true; }
@@ -74,6 +74,19 @@ class Command
      */
     mockable void addSubsystemRequirement(Subsystem* requirement);
 
+    /**
+     * Sets the phase of `CommandScheduler::run()` in which this command is executed. Takes effect
+     * the next time the command is added to a scheduler.
+     *
+     * @see SchedulerPhase
+     */
+    inline void setSchedulerPhase(SchedulerPhase phase) { schedulerPhase = phase; }
+
+    /**
+     * @return the phase of `CommandScheduler::run()` in which this command is executed.
+     */
+    inline SchedulerPhase getSchedulerPhase() const { return schedulerPhase; }
+
     /**
      * @return the name of the command, to be implemented by derived classes.
      */
@@ -131,8 +144,10 @@ class Command
      */
     const int globalIdentifier;
 
+    SchedulerPhase schedulerPhase = SchedulerPhase::COMPUTE;
+
 protected:
-    command_scheduler_bitmap_t commandRequirementsBitwise = 0;
+    subsystem_scheduler_bitmap_t commandRequirementsBitwise = 0;
 };  // class Command
 
 }  // namespace control
@@ -19,6 +19,9 @@
 
 #include "command_scheduler.hpp"
 
+#include <climits>
+#include <numeric>
+
 #include "tap/architecture/clock.hpp"
 #include "tap/drivers.hpp"
 #include "tap/errors/create_errors.hpp"
@@ -40,6 +43,12 @@ Command *CommandScheduler::globalCommandRegistrar[CommandScheduler::MAX_COMMAND_
 int CommandScheduler::maxSubsystemIndex = 0;
 int CommandScheduler::maxCommandIndex = 0;
 SafeDisconnectFunction CommandScheduler::defaultSafeDisconnectFunction;
+#ifdef TAPROOT_SCHEDULER_EXECUTION_TIMING
+ExecutionTimeStats
+    CommandScheduler::globalCommandExecutionTimeStats[CommandScheduler::MAX_COMMAND_COUNT];
+ExecutionTimeStats
+    CommandScheduler::globalSubsystemRefreshTimeStats[CommandScheduler::MAX_SUBSYSTEM_COUNT];
+#endif
 
 int CommandScheduler::constructCommand(Command *command)
 {
@@ -58,6 +67,9 @@ int CommandScheduler::constructCommand(Command *command)
             // Update max index if need be
             maxCommandIndex = std::max(maxCommandIndex, i + 1);
             globalCommandRegistrar[i] = command;
+#ifdef TAPROOT_SCHEDULER_EXECUTION_TIMING
+            globalCommandExecutionTimeStats[i].reset();
+#endif
             return i;
         }
     }
@@ -86,6 +98,9 @@ int CommandScheduler::constructSubsystem(Subsystem *subsystem)
             // Update max index if need be
             maxSubsystemIndex = std::max(maxSubsystemIndex, i + 1);
             globalSubsystemRegistrar[i] = subsystem;
+#ifdef TAPROOT_SCHEDULER_EXECUTION_TIMING
+            globalSubsystemRefreshTimeStats[i].reset();
+#endif
             return i;
         }
     }
@@ -163,11 +178,24 @@ CommandScheduler::~CommandScheduler()
 
 void CommandScheduler::run()
 {
-#ifndef PLATFORM_HOSTED
+#if !defined(PLATFORM_HOSTED) || defined(TAPROOT_SCHEDULER_EXECUTION_TIMING)
     uint32_t runStart = arch::clock::getTimeMicroseconds();
 #endif
 
-    if (safeDisconnected())
+    running = true;
+
+    bool disconnected = safeDisconnected();
+    if (disconnected != lastDisconnected)
+    {
+        recordTraceEvent(
+            disconnected ? SchedulerTraceEventType::SAFE_DISCONNECT_ENTERED
+                         : SchedulerTraceEventType::SAFE_DISCONNECT_EXITED,
+            0);
+        lastDisconnected = disconnected;
+    }
+    recordTraceEvent(SchedulerTraceEventType::RUN, 0);
+
+    if (disconnected)
     {
         // End all commands running. They were interrupted by the remote disconnecting.
         for (auto it = cmdMapBegin(); it != cmdMapEnd(); it++)
@@ -175,127 +203,325 @@ void CommandScheduler::run()
             removeCommand(*it, true);
         }
     }
+
+    // Run each phase in order so that data produced in one phase is consumed by later phases
+    // in the same tick
+    for (int phase = 0; phase < SCHEDULER_PHASE_COUNT; phase++)
+    {
+        if (!disconnected)
+        {
+            executeCommands(phase);
+        }
+
+        // Only refresh subsystems if this is the master scheduler
+        if (isMasterScheduler)
+        {
+            refreshSubsystems(phase, disconnected);
+        }
+    }
+
+    running = false;
+
+#if !defined(PLATFORM_HOSTED) || defined(TAPROOT_SCHEDULER_EXECUTION_TIMING)
+    uint32_t runTime = arch::clock::getTimeMicroseconds() - runStart;
+#endif
+
+#ifdef TAPROOT_SCHEDULER_EXECUTION_TIMING
+    runTimeStats.update(runTime, static_cast<uint32_t>(MAX_ALLOWABLE_SCHEDULER_RUNTIME));
+#endif
+
+#ifndef PLATFORM_HOSTED
+    // make sure we are not going over tolerable runtime, otherwise something is really
+    // wrong with the code
+    if (runTime > MAX_ALLOWABLE_SCHEDULER_RUNTIME)
+    {
+        // shouldn't take more than MAX_ALLOWABLE_SCHEDULER_RUNTIME microseconds
+        // to complete all this stuff, if it does something
+        // is seriously wrong (i.e. you are adding subsystems unchecked or the scheduler
+        // itself is broken). Inspect getCommandExecutionTimeStats and
+        // getSubsystemRefreshTimeStats (or "scheduler timing" via the terminal) in a profiling
+        // build to find the culprit.
+        RAISE_ERROR(drivers, "scheduler took longer than MAX_ALLOWABLE_SCHEDULER_RUNTIME");
+    }
+#endif
+}
+
+void CommandScheduler::executeCommands(int phase)
+{
+    const command_scheduler_bitmap_t &phaseCommands = phaseCommandBitmaps[phase];
+
+    // Execute commands in this phase, remove any that are finished. The bitmap is scanned live
+    // so commands removed mid-iteration are skipped.
+    for (int i = phaseCommands.findNextSetBit(0, maxCommandIndex); i != INVALID_ITER_INDEX;
+         i = phaseCommands.findNextSetBit(i + 1, maxCommandIndex))
+    {
+        Command *command = globalCommandRegistrar[i];
+#ifdef TAPROOT_SCHEDULER_EXECUTION_TIMING
+        uint32_t executeStart = arch::clock::getTimeMicroseconds();
+#endif
+        command->execute();
+        bool finished = command->isFinished();
+#ifdef TAPROOT_SCHEDULER_EXECUTION_TIMING
+        globalCommandExecutionTimeStats[i].update(
+            arch::clock::getTimeMicroseconds() - executeStart,
+            executionTimeOverrunThreshold);
+#endif
+        if (finished)
+        {
+            removeCommand(command, false);
+        }
+    }
+}
+
+void CommandScheduler::refreshSubsystems(int phase, bool disconnected)
+{
+#ifdef PLATFORM_HOSTED
+    if (parallelRefreshPool != nullptr)
+    {
+        refreshSubsystemsInParallel(phase, disconnected);
+        return;
+    }
+#endif
+
+    const subsystem_scheduler_bitmap_t &phaseSubsystems = phaseSubsystemBitmaps[phase];
+
+    // Refresh subsystems in this phase
+    for (int i = phaseSubsystems.findNextSetBit(0, maxSubsystemIndex); i != INVALID_ITER_INDEX;
+         i = phaseSubsystems.findNextSetBit(i + 1, maxSubsystemIndex))
+    {
+        Subsystem *subsystem = globalSubsystemRegistrar[i];
+
+        updateHardwareTestStatus(i, disconnected);
+
+        // Call appropriate refresh function for each of the subsystems. Safe disconnect
+        // refreshes always happen, regular refreshes only on the subsystem's refresh ticks.
+        if (disconnected || advanceRefreshCountdown(subsystem))
+        {
+            refreshSubsystem(i, disconnected);
+        }
+
+        addDefaultCommandIfPending(i, disconnected);
+    }
+}
+
+void CommandScheduler::updateHardwareTestStatus(int subsystemIndex, bool disconnected)
+{
+    // Subsystems that have a command running never need their test or default command
+    // looked at, so that work is only done for subsystems in the pending bitmap
+    Command *testCommand;
+    if (!disconnected && pendingDefaultCommandBitmap.test(subsystemIndex) &&
+        (testCommand = globalSubsystemRegistrar[subsystemIndex]->getTestCommand()) != nullptr)
+    {
+        if (testCommand->isFinished())
+        {
+            this->subsystemsPassingHardwareTests.set(subsystemIndex);
+        }
+    }
+}
+
+void CommandScheduler::refreshSubsystem(int subsystemIndex, bool disconnected)
+{
+    Subsystem *subsystem = globalSubsystemRegistrar[subsystemIndex];
+#ifdef TAPROOT_SCHEDULER_EXECUTION_TIMING
+    uint32_t refreshStart = arch::clock::getTimeMicroseconds();
+#endif
+    if (disconnected)
+    {
+        subsystem->refreshSafeDisconnect();
+    }
     else
     {
-        // Execute commands in the addedCommandBitmap, remove any that are finished
-        for (auto it = cmdMapBegin(); it != cmdMapEnd(); it++)
+        subsystem->refresh();
+    }
+#ifdef TAPROOT_SCHEDULER_EXECUTION_TIMING
+    globalSubsystemRefreshTimeStats[subsystemIndex].update(
+        arch::clock::getTimeMicroseconds() - refreshStart,
+        executionTimeOverrunThreshold);
+#endif
+}
+
+void CommandScheduler::addDefaultCommandIfPending(int subsystemIndex, bool disconnected)
+{
+    Command *defaultCmd;
+    // If the remote is connected given the scheduler is in safe disconnect mode and
+    // the current subsystem does not have an associated command and the current
+    // subsystem has a default command, add it
+    if (!disconnected && pendingDefaultCommandBitmap.test(subsystemIndex) &&
+        ((defaultCmd = globalSubsystemRegistrar[subsystemIndex]->getDefaultCommand()) != nullptr))
+    {
+        if (tryAddCommand(defaultCmd))
         {
-            (*it)->execute();
-            if ((*it)->isFinished())
-            {
-                removeCommand(*it, false);
-            }
+            recordTraceEvent(
+                SchedulerTraceEventType::DEFAULT_COMMAND_ADDED,
+                defaultCmd->getGlobalIdentifier());
         }
     }
+}
 
-    // Only refresh subsystems if this is the master scheduler
-    if (isMasterScheduler)
+#ifdef PLATFORM_HOSTED
+void CommandScheduler::setParallelRefreshThreadCount(int numThreads)
+{
+    if (numThreads <= 1)
     {
-        // Refresh subsystems in the registeredSubsystemBitmap
-        for (auto it = subMapBegin(); it != subMapEnd(); it++)
+        parallelRefreshPool.reset();
+    }
+    else
+    {
+        parallelRefreshPool = std::make_unique<arch::WorkStealingThreadPool>(numThreads);
+    }
+}
+
+void CommandScheduler::refreshSubsystemsInParallel(int phase, bool disconnected)
+{
+    const subsystem_scheduler_bitmap_t &phaseSubsystems = phaseSubsystemBitmaps[phase];
+
+    // Subsystems that refresh this tick are split into waves. A subsystem goes in the wave
+    // after the latest earlier subsystem it shares data with, so every pair of dependent
+    // subsystems is refreshed in the same order as the serial path and subsystems within a
+    // wave are independent. A subsystem waiting on its default command is a barrier: the
+    // hardware test check and default command may read or change state of any subsystem
+    // refreshed before it and may change which later subsystems are pending, so all earlier
+    // waves are run first and the subsystem is handled exactly as in the serial path.
+    parallelRefreshIndices.clear();
+    parallelRefreshWaves.clear();
+    for (int i = phaseSubsystems.findNextSetBit(0, maxSubsystemIndex); i != INVALID_ITER_INDEX;
+         i = phaseSubsystems.findNextSetBit(i + 1, maxSubsystemIndex))
+    {
+        Subsystem *subsystem = globalSubsystemRegistrar[i];
+
+        if (!disconnected && pendingDefaultCommandBitmap.test(i))
         {
-            Command *testCommand;
-            if (!safeDisconnected() &&
-                !(subsystemsAssociatedWithCommandBitmap &
-                  (LSB_ONE_HOT_SUBSYSTEM_BITMAP << (*it)->getGlobalIdentifier())) &&
-                (testCommand = (*it)->getTestCommand()) != nullptr)
-            {
-                if (testCommand->isFinished())
-                {
-                    this->subsystemsPassingHardwareTests |=
-                        (LSB_ONE_HOT_SUBSYSTEM_BITMAP << (*it)->getGlobalIdentifier());
-                }
-            }
+            runParallelRefreshWaves(disconnected);
 
-            // Call appropriate refresh function for each of the subsystems
-            if (safeDisconnected())
+            updateHardwareTestStatus(i, disconnected);
+            if (advanceRefreshCountdown(subsystem))
             {
-                (*it)->refreshSafeDisconnect();
+                refreshSubsystem(i, disconnected);
             }
-            else
+            addDefaultCommandIfPending(i, disconnected);
+        }
+        else if (disconnected || advanceRefreshCountdown(subsystem))
+        {
+            const uint32_t dependencies = subsystem->getRefreshDataDependencies();
+            int wave = 0;
+            for (size_t j = 0; j < parallelRefreshIndices.size(); j++)
             {
-                (*it)->refresh();
+                if ((globalSubsystemRegistrar[parallelRefreshIndices[j]]
+                         ->getRefreshDataDependencies() &
+                     dependencies) != 0)
+                {
+                    wave = std::max(wave, parallelRefreshWaves[j] + 1);
+                }
             }
+            parallelRefreshIndices.push_back(i);
+            parallelRefreshWaves.push_back(wave);
+        }
+    }
+
+    runParallelRefreshWaves(disconnected);
+}
+
+void CommandScheduler::runParallelRefreshWaves(bool disconnected)
+{
+    int numWaves = 0;
+    for (int wave : parallelRefreshWaves)
+    {
+        numWaves = std::max(numWaves, wave + 1);
+    }
 
-            Command *defaultCmd;
-            // If the remote is connected given the scheduler is in safe disconnect mode and
-            // the current subsystem does not have an associated command and the current
-            // subsystem has a default command, add it
-            if (!safeDisconnected() &&
-                !(subsystemsAssociatedWithCommandBitmap &
-                  (LSB_ONE_HOT_SUBSYSTEM_BITMAP << (*it)->getGlobalIdentifier())) &&
-                ((defaultCmd = (*it)->getDefaultCommand()) != nullptr))
+    for (int wave = 0; wave < numWaves; wave++)
+    {
+        parallelRefreshBatch.clear();
+        for (size_t j = 0; j < parallelRefreshIndices.size(); j++)
+        {
+            if (parallelRefreshWaves[j] == wave)
             {
-                addCommand(defaultCmd);
+                parallelRefreshBatch.push_back(parallelRefreshIndices[j]);
             }
         }
+
+        parallelRefreshPool->run(static_cast<int>(parallelRefreshBatch.size()), [&](int j) {
+            refreshSubsystem(parallelRefreshBatch[j], disconnected);
+        });
     }
 
-#ifndef PLATFORM_HOSTED
-    // make sure we are not going over tolerable runtime, otherwise something is really
-    // wrong with the code
-    if (arch::clock::getTimeMicroseconds() - runStart > MAX_ALLOWABLE_SCHEDULER_RUNTIME)
+    parallelRefreshIndices.clear();
+    parallelRefreshWaves.clear();
+}
+#endif
+
+void CommandScheduler::addCommand(Command *commandToAdd)
+{
+    if (tryAddCommand(commandToAdd))
     {
-        // shouldn't take more than MAX_ALLOWABLE_SCHEDULER_RUNTIME microseconds
-        // to complete all this stuff, if it does something
-        // is seriously wrong (i.e. you are adding subsystems unchecked or the scheduler
-        // itself is broken).
-        RAISE_ERROR(drivers, "scheduler took longer than MAX_ALLOWABLE_SCHEDULER_RUNTIME");
+        recordTraceEvent(
+            SchedulerTraceEventType::COMMAND_ADDED,
+            commandToAdd->getGlobalIdentifier());
     }
-#endif
 }
 
-void CommandScheduler::addCommand(Command *commandToAdd)
+bool CommandScheduler::tryAddCommand(Command *commandToAdd)
 {
     if (safeDisconnected())
     {
-        return;
+        return false;
     }
     else if (commandToAdd == nullptr)
     {
         RAISE_ERROR(drivers, "attempting to add nullptr command");
-        return;
+        return false;
     }
     else if (!commandToAdd->isReady())
     {
         // Do not add command if it is not ready to be scheduled.
-        return;
+        return false;
     }
 
     subsystem_scheduler_bitmap_t requirementsBitwise = commandToAdd->getRequirementsBitwise();
 
     // Check to see if all the requirements are in the subsytemToCommandMap
     if ((requirementsBitwise & registeredSubsystemBitmap) != requirementsBitwise ||
-        requirementsBitwise == static_cast<subsystem_scheduler_bitmap_t>(0))
+        requirementsBitwise.none())
     {
         // the command you are trying to add has a subsystem that is not in the
         // scheduler, so you cannot add it (will lead to undefined control behavior)
         RAISE_ERROR(drivers, "Attempting to add a command without subsystem in the scheduler");
-        return;
+        return false;
     }
 
     // End all commands running that used the subsystem requirements. They were interrupted.
-    for (auto it = cmdMapBegin(); it != cmdMapEnd(); it++)
+    // Only the owners of the required subsystems can conflict, so walk the requirements
+    // rather than every running command.
+    for (int i = requirementsBitwise.findNextSetBit(0, MAX_SUBSYSTEM_COUNT);
+         i != INVALID_ITER_INDEX;
+         i = requirementsBitwise.findNextSetBit(i + 1, MAX_SUBSYSTEM_COUNT))
     {
-        // Does this command's requierments intersect the new command?
-        if (((*it)->getRequirementsBitwise() & requirementsBitwise) !=
-            static_cast<subsystem_scheduler_bitmap_t>(0))
+        if (subsystemOwningCommand[i] != nullptr)
         {
-            removeCommand(*it, true);
+            // Clears the owner of every subsystem the interrupted command required
+            removeCommand(subsystemOwningCommand[i], true);
         }
     }
 
-    // Add the subsystem requirements to the subsystems associated with command bitmap
-    subsystemsAssociatedWithCommandBitmap |= requirementsBitwise;
+    // The required subsystems now have a command, so no longer need a default command
+    pendingDefaultCommandBitmap &= ~requirementsBitwise;
+    for (int i = requirementsBitwise.findNextSetBit(0, MAX_SUBSYSTEM_COUNT);
+         i != INVALID_ITER_INDEX;
+         i = requirementsBitwise.findNextSetBit(i + 1, MAX_SUBSYSTEM_COUNT))
+    {
+        subsystemOwningCommand[i] = commandToAdd;
+    }
     commandToAdd->initialize();
     // Add the command to the command bitmap
-    addedCommandBitmap |= LSB_ONE_HOT_COMMAND_BITMAP << commandToAdd->getGlobalIdentifier();
+    addedCommandBitmap.set(commandToAdd->getGlobalIdentifier());
+    phaseCommandBitmaps[static_cast<int>(commandToAdd->getSchedulerPhase())].set(
+        commandToAdd->getGlobalIdentifier());
+    return true;
 }
 
 bool CommandScheduler::isCommandScheduled(const Command *command) const
 {
-    return command != nullptr &&
-           (addedCommandBitmap & (LSB_ONE_HOT_COMMAND_BITMAP << command->getGlobalIdentifier()));
+    return command != nullptr && addedCommandBitmap.test(command->getGlobalIdentifier());
 }
 
 void CommandScheduler::removeCommand(Command *command, bool interrupted)
@@ -311,12 +537,30 @@ void CommandScheduler::removeCommand(Command *command, bool interrupted)
     }
 
     command->end(interrupted);
-
-    // Remove all subsystem requirements from the subsystem associated with command bitmap
-    subsystemsAssociatedWithCommandBitmap &= ~command->getRequirementsBitwise();
+    recordTraceEvent(
+        interrupted ? SchedulerTraceEventType::COMMAND_INTERRUPTED
+                    : SchedulerTraceEventType::COMMAND_FINISHED,
+        command->getGlobalIdentifier());
+
+    // All subsystems the command required are now without a command
+    subsystem_scheduler_bitmap_t requirementsBitwise = command->getRequirementsBitwise();
+    pendingDefaultCommandBitmap |= requirementsBitwise & registeredSubsystemBitmap;
+    for (int i = requirementsBitwise.findNextSetBit(0, MAX_SUBSYSTEM_COUNT);
+         i != INVALID_ITER_INDEX;
+         i = requirementsBitwise.findNextSetBit(i + 1, MAX_SUBSYSTEM_COUNT))
+    {
+        if (subsystemOwningCommand[i] == command)
+        {
+            subsystemOwningCommand[i] = nullptr;
+        }
+    }
 
     // Remove the command from the command bitmap
-    addedCommandBitmap &= ~(LSB_ONE_HOT_COMMAND_BITMAP << command->getGlobalIdentifier());
+    addedCommandBitmap.reset(command->getGlobalIdentifier());
+    for (auto &phaseCommands : phaseCommandBitmaps)
+    {
+        phaseCommands.reset(command->getGlobalIdentifier());
+    }
 }
 
 void CommandScheduler::setSafeDisconnectFunction(SafeDisconnectFunction *func)
@@ -326,6 +570,18 @@ void CommandScheduler::setSafeDisconnectFunction(SafeDisconnectFunction *func)
 
 bool CommandScheduler::safeDisconnected() { return this->safeDisconnectFunction->operator()(); }
 
+void CommandScheduler::recordTraceEvent(SchedulerTraceEventType type, int globalIdentifier)
+{
+    if (trace != nullptr)
+    {
+        trace->record(
+            arch::clock::getTimeMicroseconds(),
+            type,
+            globalIdentifier,
+            running ? 0 : SchedulerTraceEvent::FLAG_EXTERNAL);
+    }
+}
+
 void CommandScheduler::registerSubsystem(Subsystem *subsystem)
 {
     if (subsystem == nullptr)
@@ -338,17 +594,72 @@ void CommandScheduler::registerSubsystem(Subsystem *subsystem)
     }
     else
     {
+        subsystemRefreshCountdown[subsystem->getGlobalIdentifier()] =
+            chooseRefreshPhase(subsystem);
         // Add the subsystem to the registered subsystem bitmap
-        registeredSubsystemBitmap |=
-            (LSB_ONE_HOT_SUBSYSTEM_BITMAP << subsystem->getGlobalIdentifier());
+        registeredSubsystemBitmap.set(subsystem->getGlobalIdentifier());
+        pendingDefaultCommandBitmap.set(subsystem->getGlobalIdentifier());
+        phaseSubsystemBitmaps[static_cast<int>(subsystem->getSchedulerPhase())].set(
+            subsystem->getGlobalIdentifier());
     }
 }
 
+uint8_t CommandScheduler::chooseRefreshPhase(const Subsystem *subsystem)
+{
+    const int divisor = subsystem->getRefreshDivisor();
+    if (divisor <= 1)
+    {
+        return 0;
+    }
+
+    // Two decimated subsystems with countdowns c1, c2 and divisors d1, d2 refresh on the same
+    // tick at some point iff c1 and c2 are congruent modulo gcd(d1, d2). Pick the phase that
+    // lines up with the fewest already registered decimated subsystems.
+    int bestPhase = 0;
+    int bestCollisions = INT_MAX;
+    for (int phase = 0; phase < divisor; phase++)
+    {
+        int collisions = 0;
+        for (auto it = subMapBegin(); it != subMapEnd(); it++)
+        {
+            const int otherDivisor = (*it)->getRefreshDivisor();
+            if (otherDivisor > 1)
+            {
+                const int period = std::gcd(divisor, otherDivisor);
+                if (phase % period ==
+                    subsystemRefreshCountdown[(*it)->getGlobalIdentifier()] % period)
+                {
+                    collisions++;
+                }
+            }
+        }
+
+        if (collisions < bestCollisions)
+        {
+            bestPhase = phase;
+            bestCollisions = collisions;
+        }
+    }
+
+    return bestPhase;
+}
+
+bool CommandScheduler::advanceRefreshCountdown(const Subsystem *subsystem)
+{
+    uint8_t &countdown = subsystemRefreshCountdown[subsystem->getGlobalIdentifier()];
+    if (countdown == 0)
+    {
+        countdown = subsystem->getRefreshDivisor() - 1;
+        return true;
+    }
+    countdown--;
+    return false;
+}
+
 bool CommandScheduler::isSubsystemRegistered(const Subsystem *subsystem) const
 {
     return subsystem != nullptr &&
-           ((LSB_ONE_HOT_SUBSYSTEM_BITMAP << subsystem->getGlobalIdentifier()) &
-            registeredSubsystemBitmap);
+           registeredSubsystemBitmap.test(subsystem->getGlobalIdentifier());
 }
 
 void CommandScheduler::runAllHardwareTests()
@@ -364,8 +675,7 @@ void CommandScheduler::runHardwareTest(const Subsystem *subsystem)
     Command *testCommand = subsystem->getTestCommand();
     if (testCommand != nullptr)
     {
-        this->subsystemsPassingHardwareTests &=
-            ~(LSB_ONE_HOT_SUBSYSTEM_BITMAP << subsystem->getGlobalIdentifier());
+        this->subsystemsPassingHardwareTests.reset(subsystem->getGlobalIdentifier());
         this->addCommand(testCommand);
     }
 }
@@ -414,35 +724,40 @@ bool CommandScheduler::isRunningTest(const Subsystem *subsystem)
 
 bool CommandScheduler::hasPassedTest(const Subsystem *subsystem)
 {
-    return (this->subsystemsPassingHardwareTests &
-            (LSB_ONE_HOT_SUBSYSTEM_BITMAP << subsystem->getGlobalIdentifier())) != 0;
+    return this->subsystemsPassingHardwareTests.test(subsystem->getGlobalIdentifier());
 }
 
-int CommandScheduler::subsystemListSize() const
+#ifdef TAPROOT_SCHEDULER_EXECUTION_TIMING
+ExecutionTimeStats CommandScheduler::getCommandExecutionTimeStats(const Command *command) const
 {
-    int size = 0;
-    for (int i = 0; i < maxSubsystemIndex; i++)
-    {
-        if (registeredSubsystemBitmap & (LSB_ONE_HOT_SUBSYSTEM_BITMAP << i))
-        {
-            size++;
-        }
-    }
-    return size;
+    return command == nullptr ? ExecutionTimeStats()
+                              : globalCommandExecutionTimeStats[command->getGlobalIdentifier()];
 }
 
-int CommandScheduler::commandListSize() const
+ExecutionTimeStats CommandScheduler::getSubsystemRefreshTimeStats(const Subsystem *subsystem) const
 {
-    int size = 0;
-    for (int i = 0; i < maxCommandIndex; i++)
+    return subsystem == nullptr
+               ? ExecutionTimeStats()
+               : globalSubsystemRefreshTimeStats[subsystem->getGlobalIdentifier()];
+}
+
+void CommandScheduler::resetExecutionTimeStats()
+{
+    for (int i = 0; i < MAX_COMMAND_COUNT; i++)
     {
-        if (addedCommandBitmap & (LSB_ONE_HOT_COMMAND_BITMAP << i))
-        {
-            size++;
-        }
+        globalCommandExecutionTimeStats[i].reset();
+    }
+    for (int i = 0; i < MAX_SUBSYSTEM_COUNT; i++)
+    {
+        globalSubsystemRefreshTimeStats[i].reset();
     }
-    return size;
+    runTimeStats.reset();
 }
+#endif
+
+int CommandScheduler::subsystemListSize() const { return registeredSubsystemBitmap.count(); }
+
+int CommandScheduler::commandListSize() const { return addedCommandBitmap.count(); }
 
 CommandScheduler::CommandIterator CommandScheduler::cmdMapBegin()
 {
@@ -466,23 +781,8 @@ CommandScheduler::SubsystemIterator CommandScheduler::subMapEnd()
 
 CommandScheduler::CommandIterator::CommandIterator(CommandScheduler *scheduler, int i)
     : scheduler(scheduler),
-      currIndex(i)
+      currIndex(scheduler->addedCommandBitmap.findNextSetBit(i, maxCommandIndex))
 {
-    // Set to invalid iterator if the index passed in is invalid
-    if (i < 0 || i >= maxCommandIndex)
-    {
-        currIndex = INVALID_ITER_INDEX;
-    }
-    else
-    {
-        // If the curr index is pointing somewhere in the valid range of commands but the command
-        // associated with the index is not in the current added commands bitmap, increment the
-        // iterator to find the next valid index
-        if (!(scheduler->addedCommandBitmap & (LSB_ONE_HOT_COMMAND_BITMAP << currIndex)))
-        {
-            (*this)++;
-        }
-    }
 }
 
 CommandScheduler::CommandIterator::pointer CommandScheduler::CommandIterator::operator*()
@@ -497,19 +797,8 @@ CommandScheduler::CommandIterator &CommandScheduler::CommandIterator::operator++
         return *this;
     }
 
-    currIndex++;
-    while (currIndex < maxCommandIndex)
-    {
-        // Is the current index in the bitmap of added commands?
-        if (scheduler->addedCommandBitmap & (LSB_ONE_HOT_COMMAND_BITMAP << currIndex))
-        {
-            // We found the correct index
-            return *this;
-        }
-        currIndex++;
-    }
-    // We didn't find the correct index, set currindex to invalid index
-    currIndex = INVALID_ITER_INDEX;
+    // Scan the live bitmap so commands added or removed mid-iteration are handled as before
+    currIndex = scheduler->addedCommandBitmap.findNextSetBit(currIndex + 1, maxCommandIndex);
     return *this;
 }
 
@@ -536,23 +825,8 @@ bool operator!=(
 
 CommandScheduler::SubsystemIterator::SubsystemIterator(CommandScheduler *scheduler, int i)
     : scheduler(scheduler),
-      currIndex(i)
+      currIndex(scheduler->registeredSubsystemBitmap.findNextSetBit(i, maxSubsystemIndex))
 {
-    // Set to invalid iterator if the index passed in is invalid
-    if (currIndex < 0 || currIndex >= maxSubsystemIndex)
-    {
-        currIndex = INVALID_ITER_INDEX;
-    }
-    else
-    {
-        // If the curr index is pointing somewhere in the valid range of subsystems but the
-        // subsystem associated with the index is not in the current registered subsystem bitmap,
-        // increment the iterator to find the next valid index
-        if (!(scheduler->registeredSubsystemBitmap & (LSB_ONE_HOT_SUBSYSTEM_BITMAP << currIndex)))
-        {
-            (*this)++;
-        }
-    }
 }
 
 CommandScheduler::SubsystemIterator::pointer CommandScheduler::SubsystemIterator::operator*()
@@ -567,19 +841,8 @@ CommandScheduler::SubsystemIterator &CommandScheduler::SubsystemIterator::operat
         return *this;
     }
 
-    currIndex++;
-    while (currIndex < maxSubsystemIndex)
-    {
-        // Is the current index in the bitmap of added commands?
-        if (scheduler->registeredSubsystemBitmap & (LSB_ONE_HOT_SUBSYSTEM_BITMAP << currIndex))
-        {
-            // We found the correct index
-            return *this;
-        }
-        currIndex++;
-    }
-    // We didn't find the correct index, set currindex to invalid index
-    currIndex = INVALID_ITER_INDEX;
+    currIndex =
+        scheduler->registeredSubsystemBitmap.findNextSetBit(currIndex + 1, maxSubsystemIndex);
     return *this;
 }
 
@@ -22,9 +22,29 @@
 
 #include <iterator>
 
+#ifdef PLATFORM_HOSTED
+#include <memory>
+#include <vector>
+#endif
+
 #include "tap/util_macros.hpp"
 
+#ifdef PLATFORM_HOSTED
+#include "tap/architecture/work_stealing_thread_pool.hpp"
+#endif
+
 #include "command_scheduler_types.hpp"
+#include "execution_time_stats.hpp"
+#include "scheduler_trace.hpp"
+
+/**
+ * When defined, the CommandScheduler measures the time each `Command::execute/isFinished` and
+ * `Subsystem::refresh/refreshSafeDisconnect` call takes. Enabled in profiling builds and unit
+ * tests, compiled out otherwise.
+ */
+#if defined(RUN_WITH_PROFILING) || defined(ENV_UNIT_TESTS)
+#define TAPROOT_SCHEDULER_EXECUTION_TIMING
+#endif
 
 namespace tap
 {
@@ -137,12 +157,35 @@ class CommandScheduler
      * the scheduler. The Command's `end()` function is called, passing in
      * `isInterrupted = false`.
      *
+     * Commands and Subsystems are run by `SchedulerPhase`: for each phase in order, the
+     * Commands in that phase are executed and then the Subsystems in that phase are refreshed.
+     * Within a phase, order is by global identifier.
+     *
      * @note checks the run time of the scheduler. An error is added to the
      *      error handler if the time is greater than `MAX_ALLOWABLE_SCHEDULER_RUNTIME`
-     *      (in microseconds).
+     *      (in microseconds). When `TAPROOT_SCHEDULER_EXECUTION_TIMING` is defined, the time
+     *      taken by each Command and Subsystem is also recorded, see
+     *      `getCommandExecutionTimeStats` and `getSubsystemRefreshTimeStats`.
      */
     mockable void run();
 
+#ifdef PLATFORM_HOSTED
+    /**
+     * Hosted only. Enables refreshing subsystems on a pool of `numThreads` threads (including
+     * the thread calling `run()`), which speeds up simulations with many expensive subsystems.
+     * Pass a value <= 1 to go back to refreshing on the calling thread. Off by default.
+     *
+     * Within a phase, subsystems whose `Subsystem::getRefreshDataDependencies()` masks do not
+     * intersect are refreshed concurrently, and subsystems whose masks do are refreshed in the
+     * same order as without the pool, so results are identical as long as the declared masks
+     * are complete. Commands are still executed on the calling thread. A subsystem whose default
+     * command is waiting to be added is a barrier: subsystems before it finish refreshing first,
+     * then its hardware test check, refresh and default command add run in the same order as
+     * without the pool.
+     */
+    void setParallelRefreshThreadCount(int numThreads);
+#endif
+
     /**
      * Attempts to add a Command to the scheduler. There are a number of ways this
      * function can fail. If failure does occur, an error will be added to the
@@ -203,6 +246,18 @@ class CommandScheduler
      */
     mockable void setSafeDisconnectFunction(SafeDisconnectFunction* func);
 
+    /**
+     * Sets the trace that scheduling decisions (commands added, finished and interrupted,
+     * default commands added, `run()` calls and safe disconnect changes) are recorded into.
+     * Recording costs a clock read and an 8 byte write per event.
+     *
+     * @param[in] trace The trace to record into, or `nullptr` (the default) to stop recording.
+     */
+    void setTrace(SchedulerTrace* trace) { this->trace = trace; }
+
+    /// @return The trace events are being recorded into, or `nullptr` if there is none.
+    SchedulerTrace* getTrace() const { return trace; }
+
     /**
      * @param[in] subsystem the subsystem to check
      * @return `true` if the Subsystem is already scheduled, `false` otherwise.
@@ -329,6 +384,36 @@ class CommandScheduler
     }
     mockable command_scheduler_bitmap_t getAddedCommandBitmap() const { return addedCommandBitmap; }
 
+#ifdef TAPROOT_SCHEDULER_EXECUTION_TIMING
+    /**
+     * @return The time spent in the given Command's `execute()` and `isFinished()` calls, combined
+     * per `run()`. Commands are tracked by global identifier, so the stats include time spent in
+     * any CommandScheduler that ran the Command.
+     */
+    mockable ExecutionTimeStats getCommandExecutionTimeStats(const Command* command) const;
+
+    /**
+     * @return The time spent in the given Subsystem's `refresh()` or `refreshSafeDisconnect()`
+     * calls.
+     */
+    mockable ExecutionTimeStats getSubsystemRefreshTimeStats(const Subsystem* subsystem) const;
+
+    /// @return The time spent in this scheduler's `run()` function.
+    mockable ExecutionTimeStats getRunTimeStats() const { return runTimeStats; }
+
+    /// Clears all Command, Subsystem, and run time statistics.
+    mockable void resetExecutionTimeStats();
+
+    /**
+     * @param[in] threshold Time, in microseconds, above which a single Command or Subsystem call
+     * is counted as an overrun.
+     */
+    mockable void setExecutionTimeOverrunThreshold(uint32_t threshold)
+    {
+        executionTimeOverrunThreshold = threshold;
+    }
+#endif
+
     static int constructCommand(Command* command);
     static int constructSubsystem(Subsystem* subsystem);
     static void destructCommand(Command* command);
@@ -337,11 +422,15 @@ class CommandScheduler
 private:
     /// Maximum time before we start erroring, in microseconds.
     static constexpr float MAX_ALLOWABLE_SCHEDULER_RUNTIME = 100;
-    static constexpr int MAX_SUBSYSTEM_COUNT = sizeof(subsystem_scheduler_bitmap_t) * 8;
-    static constexpr int MAX_COMMAND_COUNT = sizeof(command_scheduler_bitmap_t) * 8;
-    static constexpr subsystem_scheduler_bitmap_t LSB_ONE_HOT_SUBSYSTEM_BITMAP = 1;
-    static constexpr command_scheduler_bitmap_t LSB_ONE_HOT_COMMAND_BITMAP = 1;
+    static constexpr int MAX_SUBSYSTEM_COUNT = subsystem_scheduler_bitmap_t::SIZE;
+    static constexpr int MAX_COMMAND_COUNT = command_scheduler_bitmap_t::SIZE;
     static constexpr int INVALID_ITER_INDEX = -1;
+    static_assert(
+        INVALID_ITER_INDEX == subsystem_scheduler_bitmap_t::NO_SET_BIT &&
+            INVALID_ITER_INDEX == command_scheduler_bitmap_t::NO_SET_BIT,
+        "iterators use the bitmap's NO_SET_BIT as the end index");
+    /// Default time, in microseconds, above which a single call is counted as an overrun.
+    static constexpr uint32_t DEFAULT_EXECUTION_TIME_OVERRUN_THRESHOLD = 25;
 
     /**
      * The smallest index such that all indices in the globalSubsystemRegistrar >= to them are
@@ -370,6 +459,24 @@ class CommandScheduler
      */
     static Command* globalCommandRegistrar[MAX_COMMAND_COUNT];
 
+#ifdef TAPROOT_SCHEDULER_EXECUTION_TIMING
+    /**
+     * Execution time statistics for each command in the globalCommandRegistrar, indexed by global
+     * identifier.
+     */
+    static ExecutionTimeStats globalCommandExecutionTimeStats[MAX_COMMAND_COUNT];
+
+    /**
+     * Refresh time statistics for each subsystem in the globalSubsystemRegistrar, indexed by
+     * global identifier.
+     */
+    static ExecutionTimeStats globalSubsystemRefreshTimeStats[MAX_SUBSYSTEM_COUNT];
+
+    ExecutionTimeStats runTimeStats;
+
+    uint32_t executionTimeOverrunThreshold = DEFAULT_EXECUTION_TIME_OVERRUN_THRESHOLD;
+#endif
+
     /**
      * A global flag indicating whether or not a "master" scheduler has been constructed.
      */
@@ -381,6 +488,76 @@ class CommandScheduler
      */
     bool safeDisconnected();
 
+    /**
+     * Adds the command, see `addCommand`, without recording it in the trace.
+     *
+     * @return `true` if the command was added.
+     */
+    bool tryAddCommand(Command* commandToAdd);
+
+    /**
+     * Records an event into the trace, if there is one. Events are flagged as external when
+     * recorded outside of `run()`.
+     */
+    void recordTraceEvent(SchedulerTraceEventType type, int globalIdentifier);
+
+    /**
+     * Executes all added commands in the given phase, removing those that are finished.
+     */
+    void executeCommands(int phase);
+
+    /**
+     * Refreshes all registered subsystems in the given phase (or calls their
+     * `refreshSafeDisconnect()` if `disconnected`), tracks hardware tests and adds default
+     * commands for subsystems in the pendingDefaultCommandBitmap.
+     */
+    void refreshSubsystems(int phase, bool disconnected);
+
+    /**
+     * Marks the subsystem as passing its hardware test if it has no command running and its
+     * test command is finished.
+     */
+    void updateHardwareTestStatus(int subsystemIndex, bool disconnected);
+
+    /**
+     * Calls `refresh()` (or `refreshSafeDisconnect()` if `disconnected`) on the subsystem.
+     */
+    void refreshSubsystem(int subsystemIndex, bool disconnected);
+
+    /**
+     * Adds the subsystem's default command if it has one and has no command running.
+     */
+    void addDefaultCommandIfPending(int subsystemIndex, bool disconnected);
+
+#ifdef PLATFORM_HOSTED
+    /**
+     * `refreshSubsystems` for when parallel refresh is enabled.
+     */
+    void refreshSubsystemsInParallel(int phase, bool disconnected);
+
+    /**
+     * Refreshes the subsystems collected by `refreshSubsystemsInParallel` wave by wave, then
+     * clears them.
+     */
+    void runParallelRefreshWaves(bool disconnected);
+#endif
+
+    /**
+     * Picks the number of ticks until the first refresh of a newly registered subsystem so that
+     * it collides with as few already registered decimated subsystems as possible.
+     *
+     * @param[in] subsystem The subsystem being registered.
+     * @return The initial refresh countdown, in `[0, subsystem->getRefreshDivisor())`.
+     */
+    uint8_t chooseRefreshPhase(const Subsystem* subsystem);
+
+    /**
+     * Advances the refresh countdown of the given subsystem by one tick.
+     *
+     * @return `true` if the subsystem's `refresh()` should be called this tick.
+     */
+    bool advanceRefreshCountdown(const Subsystem* subsystem);
+
     Drivers* drivers;
 
     /**
@@ -403,10 +580,29 @@ class CommandScheduler
 
     /**
      * Each bit in the bitmap corresponds to an index into the subsystem registrar. If a
-     * bit is set, it means that the subsystem in the registrar has a command associated
-     * in this scheduler.
+     * bit is set, it means that the subsystem is registered but does not have a command
+     * associated with it in this scheduler, so its default command should be added (and its
+     * test command checked) when it is next refreshed. Bits are set when a subsystem is
+     * registered or loses its command and cleared when a command requiring it is added.
      */
-    subsystem_scheduler_bitmap_t subsystemsAssociatedWithCommandBitmap = 0;
+    subsystem_scheduler_bitmap_t pendingDefaultCommandBitmap = 0;
+
+    /**
+     * For each subsystem, indexed by global identifier, the command added to this scheduler that
+     * requires it, or `nullptr` if there is none. Used by `addCommand` to find the commands it
+     * must interrupt without scanning every running command.
+     */
+    Command* subsystemOwningCommand[MAX_SUBSYSTEM_COUNT] = {};
+
+#ifdef PLATFORM_HOSTED
+    /// Refreshes subsystems when parallel refresh is enabled, `nullptr` otherwise.
+    std::unique_ptr<arch::WorkStealingThreadPool> parallelRefreshPool;
+
+    /// Scratch space for refreshSubsystemsInParallel, kept to avoid allocating every tick.
+    std::vector<int> parallelRefreshIndices;
+    std::vector<int> parallelRefreshWaves;
+    std::vector<int> parallelRefreshBatch;
+#endif
 
     /**
      * Each bit in the bitmap corresponds to an index into the subsystem registrar. If a
@@ -421,7 +617,35 @@ class CommandScheduler
      */
     command_scheduler_bitmap_t addedCommandBitmap = 0;
 
+    /**
+     * Registered subsystems split by `SchedulerPhase`. Each is a subset of
+     * registeredSubsystemBitmap.
+     */
+    subsystem_scheduler_bitmap_t phaseSubsystemBitmaps[SCHEDULER_PHASE_COUNT] = {};
+
+    /**
+     * Added commands split by the `SchedulerPhase` they had when added. Each is a subset of
+     * addedCommandBitmap.
+     */
+    command_scheduler_bitmap_t phaseCommandBitmaps[SCHEDULER_PHASE_COUNT] = {};
+
+    /**
+     * For each registered subsystem, the number of ticks left until its next `refresh()`. Always
+     * 0 for subsystems with a refresh divisor of 1.
+     */
+    uint8_t subsystemRefreshCountdown[MAX_SUBSYSTEM_COUNT] = {};
+
     bool isMasterScheduler = false;
+
+    SchedulerTrace* trace = nullptr;
+
+    /// `true` while inside `run()`.
+    bool running = false;
+
+    /// Whether the scheduler was in the safe disconnect state during the last `run()`.
+    bool lastDisconnected = false;
+
+    friend class SchedulerTraceReplayer;
 };  // class CommandScheduler
 
 }  // namespace control
@@ -56,11 +56,11 @@ class ConcurrentTemplateCommand : public Command
                 "Null pointer command passed into concurrent command.");
             auto requirements = command->getRequirementsBitwise();
             modm_assert(
-                (this->commandRequirementsBitwise & requirements) == 0,
+                (this->commandRequirementsBitwise & requirements).none(),
                 "ConcurrentCommand::ConcurrentCommand",
                 "Multiple commands to concurrent command have overlapping requirements.");
             this->commandRequirementsBitwise |= requirements;
-            this->allCommands |= (1ull << command->getGlobalIdentifier());
+            this->allCommands.set(command->getGlobalIdentifier());
         }
     }
 
@@ -90,13 +90,13 @@ class ConcurrentTemplateCommand : public Command
     {
         for (Command* command : commands)
         {
-            if (!(this->finishedCommands & (1ull << command->getGlobalIdentifier())))
+            if (!this->finishedCommands.test(command->getGlobalIdentifier()))
             {
                 command->execute();
                 if (command->isFinished())
                 {
                     command->end(false);
-                    this->finishedCommands |= 1ull << command->getGlobalIdentifier();
+                    this->finishedCommands.set(command->getGlobalIdentifier());
                 }
             }
         }
@@ -106,7 +106,7 @@ class ConcurrentTemplateCommand : public Command
     {
         for (Command* command : commands)
         {
-            if (!(this->finishedCommands & (1ull << command->getGlobalIdentifier())))
+            if (!this->finishedCommands.test(command->getGlobalIdentifier()))
             {
                 if (RACE)
                 {
@@ -124,7 +124,7 @@ class ConcurrentTemplateCommand : public Command
     {
         if (RACE)
         {
-            return this->finishedCommands != 0;
+            return this->finishedCommands.any();
         }
         return this->finishedCommands == this->allCommands;
     }
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2026 Advanced Robotics at the University of Washington <robomstr@uw.edu>
+ *
+ * This file is part of Taproot.
+ *
+ * Taproot is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Taproot is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Taproot.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef TAPROOT_EXECUTION_TIME_STATS_HPP_
+#define TAPROOT_EXECUTION_TIME_STATS_HPP_
+
+#include <cstdint>
+
+namespace tap::control
+{
+/**
+ * Execution time information about a single Command or Subsystem, collected by the
+ * CommandScheduler each time it calls into the Command or Subsystem. All times are in
+ * microseconds.
+ */
+struct ExecutionTimeStats
+{
+    /// Min time ever recorded.
+    uint32_t min = UINT32_MAX;
+    /// Max time ever recorded.
+    uint32_t max = 0;
+    /// Sum of all recorded times, used to compute the mean.
+    uint64_t total = 0;
+    /// Number of times recorded.
+    uint32_t count = 0;
+    /// Number of recorded times that were strictly greater than the overrun threshold.
+    uint32_t overrunCount = 0;
+
+    /**
+     * Adds a new sample.
+     *
+     * @param[in] dt The time, in microseconds, the call took.
+     * @param[in] overrunThreshold The time, in microseconds, above which the sample is considered
+     * an overrun.
+     */
+    inline void update(uint32_t dt, uint32_t overrunThreshold)
+    {
+        min = dt < min ? dt : min;
+        max = dt > max ? dt : max;
+        total += dt;
+        count++;
+        if (dt > overrunThreshold)
+        {
+            overrunCount++;
+        }
+    }
+
+    /// @return The mean of all recorded times, or 0 if nothing has been recorded.
+    inline float mean() const
+    {
+        return count == 0 ? 0.0f : static_cast<float>(total) / static_cast<float>(count);
+    }
+
+    /// Clears all recorded information.
+    inline void reset() { *this = ExecutionTimeStats(); }
+};
+}  // namespace tap::control
+
+#endif  // TAPROOT_EXECUTION_TIME_STATS_HPP_
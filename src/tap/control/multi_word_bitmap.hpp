@@ -0,0 +1,240 @@
+/*
+ * Copyright (c) 2026 Advanced Robotics at the University of Washington <robomstr@uw.edu>
+ *
+ * This file is part of Taproot.
+ *
+ * Taproot is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Taproot is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Taproot.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef TAPROOT_MULTI_WORD_BITMAP_HPP_
+#define TAPROOT_MULTI_WORD_BITMAP_HPP_
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+namespace tap::control
+{
+/**
+ * A fixed-width bitmap made up of `WORDS` 64-bit words, used by the CommandScheduler to track
+ * sets of subsystems and commands by global identifier.
+ *
+ * Supports the same `&`, `|`, `^`, `~`, and `<<` operations as a plain integer, and may be
+ * implicitly constructed from a `uint64_t`, which sets the lowest word. All loops are over a
+ * compile-time number of words, so with `WORDS == 1` this compiles down to the same code as a
+ * `uint64_t`.
+ *
+ * Bits are indexed from 0 (LSB of word 0) to `SIZE - 1` (MSB of word `WORDS - 1`).
+ */
+template <std::size_t WORDS>
+class MultiWordBitmap
+{
+public:
+    static_assert(WORDS > 0, "MultiWordBitmap must have at least one word");
+
+    using word_t = uint64_t;
+
+    static constexpr int BITS_PER_WORD = sizeof(word_t) * 8;
+    /// The number of bits in the bitmap.
+    static constexpr int SIZE = WORDS * BITS_PER_WORD;
+    /// Returned by `findNextSetBit` when there is no set bit in the requested range.
+    static constexpr int NO_SET_BIT = -1;
+
+    constexpr MultiWordBitmap() : words{} {}
+
+    /**
+     * Constructs a bitmap whose lowest word is `lowWord` and all other words are 0. Implicit so
+     * that integer masks (i.e. `1 << id`) may be used where a bitmap is expected.
+     */
+    constexpr MultiWordBitmap(word_t lowWord) : words{lowWord} {}
+
+    /// @return A bitmap with only the bit at `index` set.
+    static constexpr MultiWordBitmap oneHot(int index)
+    {
+        MultiWordBitmap bitmap;
+        bitmap.set(index);
+        return bitmap;
+    }
+
+    /// @return `true` if the bit at `index` is set.
+    constexpr bool test(int index) const
+    {
+        return (words[index / BITS_PER_WORD] >> (index % BITS_PER_WORD)) & 1;
+    }
+
+    /// Sets the bit at `index`.
+    constexpr void set(int index)
+    {
+        words[index / BITS_PER_WORD] |= static_cast<word_t>(1) << (index % BITS_PER_WORD);
+    }
+
+    /// Clears the bit at `index`.
+    constexpr void reset(int index)
+    {
+        words[index / BITS_PER_WORD] &= ~(static_cast<word_t>(1) << (index % BITS_PER_WORD));
+    }
+
+    /// @return `true` if any bit is set.
+    constexpr bool any() const
+    {
+        word_t combined = 0;
+        for (std::size_t i = 0; i < WORDS; i++)
+        {
+            combined |= words[i];
+        }
+        return combined != 0;
+    }
+
+    /// @return `true` if no bit is set.
+    constexpr bool none() const { return !any(); }
+
+    /// @return The number of set bits.
+    constexpr int count() const
+    {
+        int total = 0;
+        for (std::size_t i = 0; i < WORDS; i++)
+        {
+            total += std::popcount(words[i]);
+        }
+        return total;
+    }
+
+    /**
+     * Finds the lowest set bit in `[start, end)` using a count-trailing-zeros scan, skipping
+     * whole words that are empty.
+     *
+     * @param[in] start The first index to check.
+     * @param[in] end One past the last index to check. Must be <= `SIZE`.
+     * @return The index of the set bit, or `NO_SET_BIT` if there is none.
+     */
+    constexpr int findNextSetBit(int start, int end) const
+    {
+        if (start < 0 || start >= end)
+        {
+            return NO_SET_BIT;
+        }
+
+        int wordIndex = start / BITS_PER_WORD;
+        // Clear all bits below start in the first word checked
+        word_t word = words[wordIndex] & (~static_cast<word_t>(0) << (start % BITS_PER_WORD));
+
+        while (word == 0)
+        {
+            wordIndex++;
+            if (wordIndex >= static_cast<int>(WORDS) || wordIndex * BITS_PER_WORD >= end)
+            {
+                return NO_SET_BIT;
+            }
+            word = words[wordIndex];
+        }
+
+        int index = wordIndex * BITS_PER_WORD + std::countr_zero(word);
+        return index < end ? index : NO_SET_BIT;
+    }
+
+    /// @return The word at `index`, where word 0 holds bits `[0, 64)`.
+    constexpr word_t getWord(std::size_t index) const { return words[index]; }
+
+    constexpr explicit operator bool() const { return any(); }
+
+    constexpr MultiWordBitmap operator~() const
+    {
+        MultiWordBitmap result;
+        for (std::size_t i = 0; i < WORDS; i++)
+        {
+            result.words[i] = ~words[i];
+        }
+        return result;
+    }
+
+    constexpr MultiWordBitmap &operator&=(const MultiWordBitmap &other)
+    {
+        for (std::size_t i = 0; i < WORDS; i++)
+        {
+            words[i] &= other.words[i];
+        }
+        return *this;
+    }
+
+    constexpr MultiWordBitmap &operator|=(const MultiWordBitmap &other)
+    {
+        for (std::size_t i = 0; i < WORDS; i++)
+        {
+            words[i] |= other.words[i];
+        }
+        return *this;
+    }
+
+    constexpr MultiWordBitmap &operator^=(const MultiWordBitmap &other)
+    {
+        for (std::size_t i = 0; i < WORDS; i++)
+        {
+            words[i] ^= other.words[i];
+        }
+        return *this;
+    }
+
+    /// Shifts all bits towards the MSB by `shift`, where `0 <= shift < SIZE`.
+    constexpr MultiWordBitmap operator<<(int shift) const
+    {
+        MultiWordBitmap result;
+        const int wordShift = shift / BITS_PER_WORD;
+        const int bitShift = shift % BITS_PER_WORD;
+        for (int i = static_cast<int>(WORDS) - 1; i >= wordShift; i--)
+        {
+            result.words[i] = words[i - wordShift] << bitShift;
+            if (bitShift != 0 && i - wordShift - 1 >= 0)
+            {
+                result.words[i] |= words[i - wordShift - 1] >> (BITS_PER_WORD - bitShift);
+            }
+        }
+        return result;
+    }
+
+    friend constexpr MultiWordBitmap operator&(MultiWordBitmap a, const MultiWordBitmap &b)
+    {
+        return a &= b;
+    }
+
+    friend constexpr MultiWordBitmap operator|(MultiWordBitmap a, const MultiWordBitmap &b)
+    {
+        return a |= b;
+    }
+
+    friend constexpr MultiWordBitmap operator^(MultiWordBitmap a, const MultiWordBitmap &b)
+    {
+        return a ^= b;
+    }
+
+    friend constexpr bool operator==(const MultiWordBitmap &a, const MultiWordBitmap &b)
+    {
+        word_t diff = 0;
+        for (std::size_t i = 0; i < WORDS; i++)
+        {
+            diff |= a.words[i] ^ b.words[i];
+        }
+        return diff == 0;
+    }
+
+    friend constexpr bool operator!=(const MultiWordBitmap &a, const MultiWordBitmap &b)
+    {
+        return !(a == b);
+    }
+
+private:
+    word_t words[WORDS];
+};
+}  // namespace tap::control
+
+#endif  // TAPROOT_MULTI_WORD_BITMAP_HPP_
@@ -55,6 +55,19 @@ bool SchedulerTerminalHandler::terminalSerialCallback(
         printInfo(outputStream);
         return true;
     }
+#ifdef TAPROOT_SCHEDULER_EXECUTION_TIMING
+    else if (arg != nullptr && strcmp(arg, "timing") == 0)
+    {
+        printTiming(outputStream);
+        return true;
+    }
+    else if (arg != nullptr && !streamingEnabled && strcmp(arg, "resettiming") == 0)
+    {
+        drivers->commandScheduler.resetExecutionTimeStats();
+        outputStream << "Execution time statistics reset" << modm::endl;
+        return true;
+    }
+#endif
     else
     {
         outputStream << USAGE;
@@ -76,6 +89,54 @@ void SchedulerTerminalHandler::printInfo(modm::IOStream& outputStream)
         drivers->commandScheduler.cmdMapEnd(),
         [&](Command* cmd) { outputStream << " " << cmd->getName() << modm::endl; });
 }
+
+#ifdef TAPROOT_SCHEDULER_EXECUTION_TIMING
+void SchedulerTerminalHandler::printTiming(modm::IOStream& outputStream)
+{
+    outputStream << "name\tcount\tmin\tmax\tmean\toverruns" << modm::endl;
+    printTimingRow(outputStream, "run", drivers->commandScheduler.getRunTimeStats());
+
+    outputStream << "Subsystems:" << modm::endl;
+    std::for_each(
+        drivers->commandScheduler.subMapBegin(),
+        drivers->commandScheduler.subMapEnd(),
+        [&](Subsystem* sub) {
+            printTimingRow(
+                outputStream,
+                sub->getName(),
+                drivers->commandScheduler.getSubsystemRefreshTimeStats(sub));
+        });
+
+    outputStream << "Commands:" << modm::endl;
+    std::for_each(
+        drivers->commandScheduler.cmdMapBegin(),
+        drivers->commandScheduler.cmdMapEnd(),
+        [&](Command* cmd) {
+            printTimingRow(
+                outputStream,
+                cmd->getName(),
+                drivers->commandScheduler.getCommandExecutionTimeStats(cmd));
+        });
+}
+
+void SchedulerTerminalHandler::printTimingRow(
+    modm::IOStream& outputStream,
+    const char* name,
+    const ExecutionTimeStats& stats)
+{
+    outputStream << " " << name << "\t" << stats.count << "\t";
+    if (stats.count == 0)
+    {
+        outputStream << "-\t-\t-\t";
+    }
+    else
+    {
+        outputStream << stats.min << "\t" << stats.max << "\t";
+        outputStream.printf("%.1f\t", static_cast<double>(stats.mean()));
+    }
+    outputStream << stats.overrunCount << modm::endl;
+}
+#endif
 }  // namespace control
 
 }  // namespace tap
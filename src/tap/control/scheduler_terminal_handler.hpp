@@ -23,6 +23,8 @@
 #include "tap/communication/serial/terminal_serial.hpp"
 #include "tap/util_macros.hpp"
 
+#include "command_scheduler.hpp"
+
 namespace tap
 {
 class Drivers;
@@ -53,9 +55,24 @@ class SchedulerTerminalHandler : public communication::serial::TerminalSerialCal
         "Usage: scheduler <target>\n"
         "  Where \"<target>\" is one of:\n"
         "    - \"-H\": displays possible commands.\n"
-        "    - \"allsubcmd\" prints all running subsystems and.\n";
+        "    - \"allsubcmd\" prints all running subsystems and.\n"
+#ifdef TAPROOT_SCHEDULER_EXECUTION_TIMING
+        "    - \"timing\" prints execution time statistics (in microseconds) for all\n"
+        "      subsystems and commands.\n"
+        "    - \"resettiming\" clears all execution time statistics.\n"
+#endif
+        ;
 
     void printInfo(modm::IOStream& outputStream);
+
+#ifdef TAPROOT_SCHEDULER_EXECUTION_TIMING
+    void printTiming(modm::IOStream& outputStream);
+
+    static void printTimingRow(
+        modm::IOStream& outputStream,
+        const char* name,
+        const ExecutionTimeStats& stats);
+#endif
 };
 
 }  // namespace control
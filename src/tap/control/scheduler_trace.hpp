@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2026 Advanced Robotics at the University of Washington <robomstr@uw.edu>
+ *
+ * This file is part of Taproot.
+ *
+ * Taproot is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Taproot is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Taproot.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef TAPROOT_SCHEDULER_TRACE_HPP_
+#define TAPROOT_SCHEDULER_TRACE_HPP_
+
+#include <cstddef>
+#include <cstdint>
+
+#include "tap/util_macros.hpp"
+
+namespace tap::control
+{
+/**
+ * The kinds of scheduling decisions recorded in a SchedulerTrace.
+ */
+enum class SchedulerTraceEventType : uint8_t
+{
+    /// `CommandScheduler::run()` started. The global identifier is unused.
+    RUN = 0,
+    /// A command was added via `addCommand()`.
+    COMMAND_ADDED,
+    /// A subsystem's default command was added by `run()`.
+    DEFAULT_COMMAND_ADDED,
+    /// A command ended without being interrupted, either because it finished or because
+    /// `removeCommand(command, false)` was called.
+    COMMAND_FINISHED,
+    /// A command ended because it was interrupted.
+    COMMAND_INTERRUPTED,
+    /// The scheduler entered the safe disconnect state. The global identifier is unused.
+    SAFE_DISCONNECT_ENTERED,
+    /// The scheduler left the safe disconnect state. The global identifier is unused.
+    SAFE_DISCONNECT_EXITED,
+};
+
+/**
+ * A single recorded scheduling decision. Packed into 8 bytes so traces stay small and can be
+ * written to and read from binary files directly.
+ */
+struct SchedulerTraceEvent
+{
+    /// Set in `flags` if the event was caused by a call from outside `CommandScheduler::run()`.
+    static constexpr uint8_t FLAG_EXTERNAL = 1 << 0;
+
+    /// Time the event was recorded, in microseconds.
+    uint32_t timestamp;
+    /// Global identifier of the command the event is about.
+    uint16_t globalIdentifier;
+    SchedulerTraceEventType type;
+    uint8_t flags;
+
+    inline bool isExternal() const { return (flags & FLAG_EXTERNAL) != 0; }
+};
+static_assert(sizeof(SchedulerTraceEvent) == 8, "SchedulerTraceEvent must stay 8 bytes");
+
+/**
+ * A fixed-size ring buffer of SchedulerTraceEvents that a CommandScheduler records into, see
+ * `CommandScheduler::setTrace`. Once full, the oldest events are overwritten. Recording never
+ * allocates.
+ *
+ * The storage is provided by the caller, use StaticSchedulerTrace to have it allocated inline.
+ */
+class SchedulerTrace
+{
+public:
+    /**
+     * @param[in] storage Buffer events are recorded into, must outlive the trace.
+     * @param[in] capacity Number of events `storage` can hold, must be > 0.
+     */
+    SchedulerTrace(SchedulerTraceEvent *storage, std::size_t capacity)
+        : storage(storage),
+          capacity(capacity)
+    {
+    }
+    DISALLOW_COPY_AND_ASSIGN(SchedulerTrace);
+
+    /**
+     * Appends an event, overwriting the oldest one if the trace is full.
+     */
+    inline void record(
+        uint32_t timestamp,
+        SchedulerTraceEventType type,
+        int globalIdentifier,
+        uint8_t flags)
+    {
+        storage[next] = {timestamp, static_cast<uint16_t>(globalIdentifier), type, flags};
+        next = next + 1 == capacity ? 0 : next + 1;
+        totalRecorded++;
+    }
+
+    /// @return The number of events currently stored.
+    inline std::size_t size() const
+    {
+        return totalRecorded < capacity ? static_cast<std::size_t>(totalRecorded) : capacity;
+    }
+
+    inline std::size_t getCapacity() const { return capacity; }
+
+    /// @return The number of events ever recorded, including ones that have been overwritten.
+    inline uint32_t getTotalRecorded() const { return totalRecorded; }
+
+    /// @return The number of events that were overwritten before being read.
+    inline uint32_t getDroppedCount() const { return totalRecorded - size(); }
+
+    /**
+     * @param[in] index Index of the event, where 0 is the oldest stored event. Must be less than
+     * `size()`.
+     */
+    inline const SchedulerTraceEvent &getEvent(std::size_t index) const
+    {
+        std::size_t oldest = totalRecorded < capacity ? 0 : next;
+        std::size_t i = oldest + index;
+        return storage[i >= capacity ? i - capacity : i];
+    }
+
+    /// Removes all stored events.
+    inline void clear()
+    {
+        next = 0;
+        totalRecorded = 0;
+    }
+
+private:
+    SchedulerTraceEvent *storage;
+    std::size_t capacity;
+    /// Index `record()` writes to next.
+    std::size_t next = 0;
+    uint32_t totalRecorded = 0;
+};  // class SchedulerTrace
+
+/**
+ * A SchedulerTrace that holds its own storage for `CAPACITY` events.
+ */
+template <std::size_t CAPACITY>
+class StaticSchedulerTrace : public SchedulerTrace
+{
+public:
+    static_assert(CAPACITY > 0, "trace capacity must be positive");
+
+    StaticSchedulerTrace() : SchedulerTrace(events, CAPACITY) {}
+
+private:
+    SchedulerTraceEvent events[CAPACITY];
+};  // class StaticSchedulerTrace
+}  // namespace tap::control
+
+#endif  // TAPROOT_SCHEDULER_TRACE_HPP_
@@ -0,0 +1,202 @@
+/*
+ * Copyright (c) 2026 Advanced Robotics at the University of Washington <robomstr@uw.edu>
+ *
+ * This file is part of Taproot.
+ *
+ * Taproot is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Taproot is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Taproot.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifdef PLATFORM_HOSTED
+
+#include "scheduler_trace_replayer.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+namespace tap::control
+{
+static constexpr char TRACE_FILE_MAGIC[8] = {'T', 'A', 'P', 'T', 'R', 'A', 'C', 'E'};
+
+SchedulerTraceReplayer::SchedulerTraceReplayer(CommandScheduler *scheduler) : scheduler(scheduler)
+{
+}
+
+std::vector<SchedulerTraceEvent> SchedulerTraceReplayer::replay(
+    const std::vector<SchedulerTraceEvent> &trace)
+{
+    ReplaySafeDisconnectFunction replayDisconnect;
+
+    // A trace that starts by leaving the safe disconnect state was recorded while disconnected
+    for (const SchedulerTraceEvent &event : trace)
+    {
+        if (event.type == SchedulerTraceEventType::SAFE_DISCONNECT_ENTERED ||
+            event.type == SchedulerTraceEventType::SAFE_DISCONNECT_EXITED)
+        {
+            replayDisconnect.disconnected =
+                event.type == SchedulerTraceEventType::SAFE_DISCONNECT_EXITED;
+            break;
+        }
+    }
+
+    // Any divergence adds at most a few events per replayed one, leave room so it is visible
+    std::vector<SchedulerTraceEvent> storage(std::max<std::size_t>(2 * trace.size(), 64));
+    SchedulerTrace replayTrace(storage.data(), storage.size());
+
+    SafeDisconnectFunction *originalDisconnect = scheduler->safeDisconnectFunction;
+    SchedulerTrace *originalTrace = scheduler->trace;
+    bool originalLastDisconnected = scheduler->lastDisconnected;
+
+    scheduler->setSafeDisconnectFunction(&replayDisconnect);
+    scheduler->setTrace(&replayTrace);
+    scheduler->lastDisconnected = replayDisconnect.disconnected;
+
+    for (const SchedulerTraceEvent &event : trace)
+    {
+        Command *command = event.globalIdentifier < CommandScheduler::MAX_COMMAND_COUNT
+                               ? CommandScheduler::globalCommandRegistrar[event.globalIdentifier]
+                               : nullptr;
+
+        switch (event.type)
+        {
+            case SchedulerTraceEventType::RUN:
+                scheduler->run();
+                break;
+            case SchedulerTraceEventType::SAFE_DISCONNECT_ENTERED:
+                replayDisconnect.disconnected = true;
+                break;
+            case SchedulerTraceEventType::SAFE_DISCONNECT_EXITED:
+                replayDisconnect.disconnected = false;
+                break;
+            case SchedulerTraceEventType::COMMAND_ADDED:
+                if (event.isExternal() && command != nullptr)
+                {
+                    scheduler->addCommand(command);
+                }
+                break;
+            case SchedulerTraceEventType::COMMAND_FINISHED:
+            case SchedulerTraceEventType::COMMAND_INTERRUPTED:
+                if (event.isExternal() && command != nullptr)
+                {
+                    scheduler->removeCommand(
+                        command,
+                        event.type == SchedulerTraceEventType::COMMAND_INTERRUPTED);
+                }
+                break;
+            default:
+                // Decisions made by run() itself, reproduced by replaying the run
+                break;
+        }
+    }
+
+    scheduler->setSafeDisconnectFunction(originalDisconnect);
+    scheduler->setTrace(originalTrace);
+    scheduler->lastDisconnected = originalLastDisconnected;
+
+    return toVector(replayTrace);
+}
+
+int SchedulerTraceReplayer::findFirstDifference(
+    const std::vector<SchedulerTraceEvent> &expected,
+    const std::vector<SchedulerTraceEvent> &actual)
+{
+    std::size_t commonSize = std::min(expected.size(), actual.size());
+
+    for (std::size_t i = 0; i < commonSize; i++)
+    {
+        if (expected[i].type != actual[i].type ||
+            expected[i].globalIdentifier != actual[i].globalIdentifier ||
+            expected[i].flags != actual[i].flags)
+        {
+            return static_cast<int>(i);
+        }
+    }
+
+    return expected.size() == actual.size() ? -1 : static_cast<int>(commonSize);
+}
+
+std::vector<SchedulerTraceEvent> SchedulerTraceReplayer::toVector(const SchedulerTrace &trace)
+{
+    std::vector<SchedulerTraceEvent> events;
+    events.reserve(trace.size());
+
+    for (std::size_t i = 0; i < trace.size(); i++)
+    {
+        events.push_back(trace.getEvent(i));
+    }
+
+    return events;
+}
+
+bool SchedulerTraceReplayer::writeTraceFile(
+    const std::string &path,
+    const std::vector<SchedulerTraceEvent> &events)
+{
+    std::ofstream file(path, std::ios::binary);
+    if (!file)
+    {
+        return false;
+    }
+
+    uint32_t version = TRACE_FILE_VERSION;
+    uint32_t count = static_cast<uint32_t>(events.size());
+
+    file.write(TRACE_FILE_MAGIC, sizeof(TRACE_FILE_MAGIC));
+    file.write(reinterpret_cast<const char *>(&version), sizeof(version));
+    file.write(reinterpret_cast<const char *>(&count), sizeof(count));
+    file.write(
+        reinterpret_cast<const char *>(events.data()),
+        events.size() * sizeof(SchedulerTraceEvent));
+
+    return static_cast<bool>(file);
+}
+
+bool SchedulerTraceReplayer::readTraceFile(
+    const std::string &path,
+    std::vector<SchedulerTraceEvent> &events)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file)
+    {
+        return false;
+    }
+
+    char magic[sizeof(TRACE_FILE_MAGIC)];
+    uint32_t version = 0;
+    uint32_t count = 0;
+
+    file.read(magic, sizeof(magic));
+    file.read(reinterpret_cast<char *>(&version), sizeof(version));
+    file.read(reinterpret_cast<char *>(&count), sizeof(count));
+
+    if (!file || memcmp(magic, TRACE_FILE_MAGIC, sizeof(magic)) != 0 ||
+        version != TRACE_FILE_VERSION)
+    {
+        return false;
+    }
+
+    std::vector<SchedulerTraceEvent> read(count);
+    file.read(reinterpret_cast<char *>(read.data()), count * sizeof(SchedulerTraceEvent));
+
+    if (!file)
+    {
+        return false;
+    }
+
+    events = std::move(read);
+    return true;
+}
+}  // namespace tap::control
+
+#endif  // PLATFORM_HOSTED
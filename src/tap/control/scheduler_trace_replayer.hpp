@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2026 Advanced Robotics at the University of Washington <robomstr@uw.edu>
+ *
+ * This file is part of Taproot.
+ *
+ * Taproot is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Taproot is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Taproot.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef TAPROOT_SCHEDULER_TRACE_REPLAYER_HPP_
+#define TAPROOT_SCHEDULER_TRACE_REPLAYER_HPP_
+
+#ifdef PLATFORM_HOSTED
+
+#include <string>
+#include <vector>
+
+#include "command_scheduler.hpp"
+#include "scheduler_trace.hpp"
+
+namespace tap::control
+{
+/**
+ * Hosted tool that replays a recorded SchedulerTrace against a CommandScheduler, to reproduce a
+ * sequence of scheduling decisions seen on a robot or to check that a new version of the
+ * scheduler makes the same decisions as an old one.
+ *
+ * Only the inputs in the trace are replayed: `addCommand()` and `removeCommand()` calls made from
+ * outside of `run()`, the safe disconnect state and the `run()` calls themselves. Everything
+ * `run()` decides on its own (finished, interrupted and default commands) is recorded again
+ * during the replay and may be compared to the original with `findFirstDifference`.
+ *
+ * The replay scheduler must have the same subsystems registered and the same commands
+ * constructed in the same order as when the trace was recorded, so that global identifiers match,
+ * and should be in the same state as when recording started.
+ */
+class SchedulerTraceReplayer
+{
+public:
+    explicit SchedulerTraceReplayer(CommandScheduler *scheduler);
+
+    /**
+     * Replays `trace` against the scheduler. The scheduler's safe disconnect function and trace
+     * are replaced for the duration of the replay and restored afterwards.
+     *
+     * @return The events recorded by the scheduler during the replay.
+     */
+    std::vector<SchedulerTraceEvent> replay(const std::vector<SchedulerTraceEvent> &trace);
+
+    /**
+     * Compares two traces, ignoring timestamps.
+     *
+     * @return The index of the first event that differs, the length of the shorter trace if one
+     * is a prefix of the other, or -1 if the traces are the same.
+     */
+    static int findFirstDifference(
+        const std::vector<SchedulerTraceEvent> &expected,
+        const std::vector<SchedulerTraceEvent> &actual);
+
+    /// @return The events stored in `trace`, oldest first.
+    static std::vector<SchedulerTraceEvent> toVector(const SchedulerTrace &trace);
+
+    /**
+     * Writes events to a binary trace file: the 8 byte magic `TAPTRACE`, a 4 byte version, a 4
+     * byte event count, then the events as laid out in memory (little endian).
+     *
+     * @return `true` if the file was written.
+     */
+    static bool writeTraceFile(
+        const std::string &path,
+        const std::vector<SchedulerTraceEvent> &events);
+
+    /**
+     * Reads a file written by `writeTraceFile`.
+     *
+     * @return `true` if the file was read, `false` if it could not be opened or is malformed.
+     */
+    static bool readTraceFile(const std::string &path, std::vector<SchedulerTraceEvent> &events);
+
+private:
+    /**
+     * Reports the safe disconnect state recorded in the trace being replayed.
+     */
+    class ReplaySafeDisconnectFunction : public SafeDisconnectFunction
+    {
+    public:
+        bool operator()() override { return disconnected; }
+        bool disconnected = false;
+    };
+
+    static constexpr uint32_t TRACE_FILE_VERSION = 1;
+
+    CommandScheduler *scheduler;
+};  // class SchedulerTraceReplayer
+}  // namespace tap::control
+
+#endif  // PLATFORM_HOSTED
+
+#endif  // TAPROOT_SCHEDULER_TRACE_REPLAYER_HPP_
@@ -31,6 +31,9 @@ Subsystem::Subsystem(Drivers* drivers)
     : drivers(drivers),
       defaultCommand(nullptr),
       testCommand(nullptr),
+      refreshDivisor(1),
+      schedulerPhase(SchedulerPhase::COMPUTE),
+      refreshDataDependencies(ALL_REFRESH_DATA_DEPENDENCIES),
       globalIdentifier(CommandScheduler::constructSubsystem(this))
 {
 }
@@ -59,6 +62,8 @@ void Subsystem::setTestCommand(Command* command)
     }
 }
 
+void Subsystem::setRefreshDivisor(uint8_t divisor) { refreshDivisor = divisor == 0 ? 1 : divisor; }
+
 const char* Subsystem::getName() const { return "Subsystem"; }
 
 #if defined(PLATFORM_HOSTED) && defined(ENV_UNIT_TESTS)
@@ -66,6 +71,9 @@ Subsystem::Subsystem()
     : drivers(nullptr),
       defaultCommand(nullptr),
       testCommand(nullptr),
+      refreshDivisor(1),
+      schedulerPhase(SchedulerPhase::COMPUTE),
+      refreshDataDependencies(ALL_REFRESH_DATA_DEPENDENCIES),
       globalIdentifier(CommandScheduler::constructSubsystem(this))
 {
 }
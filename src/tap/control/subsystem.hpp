@@ -24,6 +24,8 @@
 
 #include "tap/util_macros.hpp"
 
+#include "command_scheduler_types.hpp"
+
 namespace tap
 {
 class Drivers;
@@ -126,6 +128,64 @@ class Subsystem
      */
     mockable inline Command* getTestCommand() const { return testCommand; }
 
+    /**
+     * Sets how often the master CommandScheduler calls `refresh()`. With a divisor of `N`,
+     * `refresh()` is called once every `N` calls to `CommandScheduler::run()`. Subsystems that
+     * share a divisor are staggered across ticks so their refreshes do not all land on the same
+     * `run()`. Default commands, hardware test tracking and `refreshSafeDisconnect()` are still
+     * handled every tick.
+     *
+     * Should be set before the subsystem is registered so the scheduler can pick a staggered
+     * refresh phase for it.
+     *
+     * @param[in] divisor The refresh divisor, 1 (the default) refreshes every tick. A divisor of
+     * 0 is treated as 1.
+     */
+    void setRefreshDivisor(uint8_t divisor);
+
+    /**
+     * @return The number of CommandScheduler ticks between calls to `refresh()`.
+     */
+    inline uint8_t getRefreshDivisor() const { return refreshDivisor; }
+
+    /**
+     * Sets the phase of `CommandScheduler::run()` in which this subsystem is refreshed. A
+     * subsystem that reads sensors should use `SchedulerPhase::SENSE` so Commands see this tick's
+     * data, and one that writes to actuators should use `SchedulerPhase::ACTUATE` so it sends
+     * this tick's Command outputs. Must be set before the subsystem is registered.
+     *
+     * @see SchedulerPhase
+     */
+    inline void setSchedulerPhase(SchedulerPhase phase) { schedulerPhase = phase; }
+
+    /**
+     * @return the phase of `CommandScheduler::run()` in which this subsystem is refreshed.
+     */
+    inline SchedulerPhase getSchedulerPhase() const { return schedulerPhase; }
+
+    /**
+     * Declares which shared data this subsystem's `refresh()` reads or writes, as a bitmask
+     * where each bit is a user-chosen piece of shared state (a bus, a shared sensor, a simulated
+     * world object, etc.). Only used by the hosted parallel refresh mode, see
+     * `CommandScheduler::setParallelRefreshThreadCount`, where two subsystems in the same phase
+     * may be refreshed concurrently if their masks do not intersect.
+     *
+     * Defaults to `ALL_REFRESH_DATA_DEPENDENCIES`, i.e. the subsystem is only refreshed
+     * concurrently with subsystems that declare a mask of 0. A mask of 0 means `refresh()` only
+     * touches state owned by this subsystem.
+     */
+    inline void setRefreshDataDependencies(uint32_t dependencies)
+    {
+        refreshDataDependencies = dependencies;
+    }
+
+    /**
+     * @return The shared data `refresh()` depends on, see `setRefreshDataDependencies`.
+     */
+    inline uint32_t getRefreshDataDependencies() const { return refreshDataDependencies; }
+
+    static constexpr uint32_t ALL_REFRESH_DATA_DEPENDENCIES = UINT32_MAX;
+
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Woverloaded-virtual"
     virtual const char* getName() const;
@@ -141,6 +201,12 @@ class Subsystem
 
     Command* testCommand;
 
+    uint8_t refreshDivisor;
+
+    SchedulerPhase schedulerPhase;
+
+    uint32_t refreshDataDependencies;
+
     /**
      * An identifier unique to a subsystem that will be assigned to it automatically upon
      * construction and unassigned during destruction.
@@ -20,6 +20,7 @@
 #include "dji_motor_encoder.hpp"
 
 #include "tap/algorithms/math_user_utils.hpp"
+#include "tap/architecture/clock.hpp"
 
 namespace tap
 {
@@ -33,6 +34,11 @@ DjiMotorEncoder::DjiMotorEncoder(bool isInverted, float gearRatio, uint32_t enco
 }
 
 void DjiMotorEncoder::processMessage(const modm::can::Message& message)
+{
+    processMessage(message, tap::arch::clock::getTimeMicroseconds());
+}
+
+void DjiMotorEncoder::processMessage(const modm::can::Message& message, uint32_t arrivalTime)
 {
     encoderDisconnectTimeout.restart(MOTOR_DISCONNECT_TIME);
     shaftRPM = static_cast<int16_t>(message.data[2] << 8 | message.data[3]);  // rpm
@@ -41,6 +47,24 @@ void DjiMotorEncoder::processMessage(const modm::can::Message& message)
     uint16_t encoderActual =
         static_cast<uint16_t>(message.data[0] << 8 | message.data[1]);  // encoder value
 
+    // Unwrap the delta in ticks exactly, the shaft turns less than half a revolution per message
+    int32_t deltaTicks = encoderActual - lastEncoderActual;
+    if (deltaTicks >= ENC_RESOLUTION / 2)
+    {
+        deltaTicks -= ENC_RESOLUTION;
+    }
+    else if (deltaTicks < -ENC_RESOLUTION / 2)
+    {
+        deltaTicks += ENC_RESOLUTION;
+    }
+    deltaTicks = inverted ? -deltaTicks : deltaTicks;
+    lastEncoderActual = encoderActual;
+
+    velocityEstimator.update(
+        deltaTicks * static_cast<float>(M_TWOPI) / ENC_RESOLUTION * gearRatio,
+        shaftRPM * static_cast<float>(M_TWOPI) / 60.f * gearRatio,
+        arrivalTime);
+
     updateEncoderValue(encoderActual);
 }
 
@@ -56,9 +80,15 @@ bool DjiMotorEncoder::isOnline() const
 
 float DjiMotorEncoder::getVelocity() const
 {
+    if (velocitySource == VelocitySource::ESTIMATED)
+    {
+        return velocityEstimator.getVelocity();
+    }
     return this->getShaftRPM() * static_cast<float>(M_TWOPI) / 60.f * this->gearRatio;
 }
 
+float DjiMotorEncoder::getAcceleration() const { return velocityEstimator.getAcceleration(); }
+
 int16_t DjiMotorEncoder::getShaftRPM() const { return shaftRPM; }
 }  // namespace motor
 
@@ -21,6 +21,7 @@
 #define TAPROOT_DJI_MOTOR_ENCODER_HPP_
 
 #include "tap/architecture/timeout.hpp"
+#include "tap/communication/sensors/encoder/encoder_velocity_estimator.hpp"
 #include "tap/communication/sensors/encoder/wrapped_encoder.hpp"
 #include "tap/util_macros.hpp"
 
@@ -46,6 +47,11 @@ namespace tap::motor
  *
  * Combining them with some form of absolute encoder on the output shaft would give you knowledge of
  * the orientation of the output shaft.
+ *
+ * By default `getVelocity()` is the RPM reported by the motor, which is an integer and noisy at low
+ * speed. `setVelocitySource(VelocitySource::ESTIMATED)` switches it to an EncoderVelocityEstimator
+ * fed with the encoder position and receive time of every message, blended with the reported
+ * RPM. `getAcceleration()` always comes from the estimator.
  */
 class DjiMotorEncoder : public tap::encoder::WrappedEncoder
 {
@@ -62,6 +68,17 @@ class DjiMotorEncoder : public tap::encoder::WrappedEncoder
     static constexpr float GEAR_RATIO_M2006 = 1.0f / 36.0f;
     static constexpr float GEAR_RATIO_GM6020 = 1.0f / 1.0f;
 
+    /**
+     * Where `getVelocity()` comes from.
+     */
+    enum class VelocitySource : uint8_t
+    {
+        /// The RPM reported by the motor controller.
+        REPORTED_RPM,
+        /// The velocity estimator, see `getVelocityEstimator()`.
+        ESTIMATED,
+    };
+
     /**
      * @param isInverted if `false` the positive rotation direction of the shaft is
      *      counter-clockwise when looking at the shaft from.
@@ -78,11 +95,31 @@ class DjiMotorEncoder : public tap::encoder::WrappedEncoder
 
     float getVelocity() const override;
 
+    float getAcceleration() const override;
+
     /**
      * The current RPM reported by the motor controller.
      */
     mockable int16_t getShaftRPM() const;
 
+    mockable void setVelocitySource(VelocitySource source) { velocitySource = source; }
+
+    mockable VelocitySource getVelocitySource() const { return velocitySource; }
+
+    /**
+     * Replaces the gains of the velocity estimator, which default to ones suited to the motor's 1
+     * kHz feedback.
+     */
+    void setVelocityEstimatorConfig(const tap::encoder::EncoderVelocityEstimatorConfig& config)
+    {
+        velocityEstimator.setConfig(config);
+    }
+
+    const tap::encoder::EncoderVelocityEstimator& getVelocityEstimator() const
+    {
+        return velocityEstimator;
+    }
+
     DISALLOW_COPY_AND_ASSIGN(DjiMotorEncoder)
 
     /**
@@ -94,6 +131,16 @@ class DjiMotorEncoder : public tap::encoder::WrappedEncoder
      */
     mockable void processMessage(const modm::can::Message& message);
 
+    /**
+     * Same as `processMessage(message)`, with the time the message arrived for the velocity
+     * estimator.
+     *
+     * @param[in] message the message to be processed.
+     * @param[in] arrivalTime the time the message arrived, in microseconds, see
+     *      `CanRxListener::getMessageArrivalTime`.
+     */
+    mockable void processMessage(const modm::can::Message& message, uint32_t arrivalTime);
+
 private:
     // wait time before the motor is considered disconnected, in milliseconds
     static const uint32_t MOTOR_DISCONNECT_TIME = 100;
@@ -101,6 +148,13 @@ class DjiMotorEncoder : public tap::encoder::WrappedEncoder
     tap::arch::MilliTimeout encoderDisconnectTimeout;
 
     int16_t shaftRPM;
+
+    VelocitySource velocitySource = VelocitySource::REPORTED_RPM;
+
+    tap::encoder::EncoderVelocityEstimator velocityEstimator;
+
+    /// The raw encoder value of the previous message, to find position deltas for the estimator.
+    uint16_t lastEncoderActual = 0;
 };
 
 }  // namespace tap::motor
@@ -40,6 +40,7 @@ void DjiMotorTxHandler::addMotorToManager(DjiMotor** canMotorStore, DjiMotor* co
     bool motorOutOfBounds = idIndex >= DJI_MOTORS_PER_CAN;
     modm_assert(!motorOverloaded && !motorOutOfBounds, "DjiMotorTxHandler", "overloading");
     canMotorStore[idIndex] = motor;
+    updateMessagePlan();
 }
 
 void DjiMotorTxHandler::addMotorToManager(DjiMotor* motor)
@@ -59,138 +60,81 @@ void DjiMotorTxHandler::addMotorToManager(DjiMotor* motor)
 
 void DjiMotorTxHandler::encodeAndSendCanData()
 {
-    // set up new can messages to be sent via CAN bus 1 and 2
-    modm::can::Message can1MessageLow(
-        CAN_DJI_LOW_IDENTIFIER,
-        CAN_DJI_MESSAGE_SEND_LENGTH,
-        0,
-        false);
-    modm::can::Message can1MessageHigh(
-        CAN_DJI_HIGH_IDENTIFIER,
-        CAN_DJI_MESSAGE_SEND_LENGTH,
-        0,
-        false);
-    modm::can::Message can1Message6020Current(
-        CAN_DJI_6020_CURRENT_IDENTIFIER,
-        CAN_DJI_MESSAGE_SEND_LENGTH,
-        0,
-        false);
-    modm::can::Message can2MessageLow(
-        CAN_DJI_LOW_IDENTIFIER,
-        CAN_DJI_MESSAGE_SEND_LENGTH,
-        0,
-        false);
-    modm::can::Message can2MessageHigh(
-        CAN_DJI_HIGH_IDENTIFIER,
-        CAN_DJI_MESSAGE_SEND_LENGTH,
-        0,
-        false);
-    modm::can::Message can2Message6020Current(
-        CAN_DJI_6020_CURRENT_IDENTIFIER,
-        CAN_DJI_MESSAGE_SEND_LENGTH,
-        0,
-        false);
-
-    bool can1ValidMotorMessageLow = false;
-    bool can1ValidMotorMessageHigh = false;
-    bool can1ValidMotorMessage6020Current = false;
-    bool can2ValidMotorMessageLow = false;
-    bool can2ValidMotorMessageHigh = false;
-    bool can2ValidMotorMessage6020Current = false;
-
-    serializeMotorStoreSendData(
-        can1MotorStore,
-        &can1MessageLow,
-        &can1MessageHigh,
-        &can1Message6020Current,
-        &can1ValidMotorMessageLow,
-        &can1ValidMotorMessageHigh,
-        &can1ValidMotorMessage6020Current);
-
-    serializeMotorStoreSendData(
-        can2MotorStore,
-        &can2MessageLow,
-        &can2MessageHigh,
-        &can2Message6020Current,
-        &can2ValidMotorMessageLow,
-        &can2ValidMotorMessageHigh,
-        &can2ValidMotorMessage6020Current);
-
-    bool messageSuccess = true;
-
-    if (drivers->can.isReadyToSend(can::CanBus::CAN_BUS1))
+    for (int i = 0; i < numPlannedMotors; i++)
     {
-        if (can1ValidMotorMessageLow)
-        {
-            messageSuccess &= drivers->can.sendMessage(can::CanBus::CAN_BUS1, can1MessageLow);
-        }
-        if (can1ValidMotorMessageHigh)
-        {
-            messageSuccess &= drivers->can.sendMessage(can::CanBus::CAN_BUS1, can1MessageHigh);
-        }
-        if (can1ValidMotorMessage6020Current)
-        {
-            messageSuccess &=
-                drivers->can.sendMessage(can::CanBus::CAN_BUS1, can1Message6020Current);
-        }
+        plannedMotors[i].motor->serializeCanSendData(&plannedMotors[i].message->message);
     }
-    if (drivers->can.isReadyToSend(can::CanBus::CAN_BUS2))
+
+    bool messageSuccess = true;
+    for (int i = 0; i < numPlannedMessages; i++)
     {
-        if (can2ValidMotorMessageLow)
-        {
-            messageSuccess &= drivers->can.sendMessage(can::CanBus::CAN_BUS2, can2MessageLow);
-        }
-        if (can2ValidMotorMessageHigh)
-        {
-            messageSuccess &= drivers->can.sendMessage(can::CanBus::CAN_BUS2, can2MessageHigh);
-        }
-        if (can2ValidMotorMessage6020Current)
-        {
-            messageSuccess &=
-                drivers->can.sendMessage(can::CanBus::CAN_BUS2, can2Message6020Current);
-        }
+        messageSuccess &= queueControlMessage(plannedMessages[i].bus, plannedMessages[i].message);
     }
 
     if (!messageSuccess)
     {
-        RAISE_ERROR(drivers, "sendMessage failure");
+        RAISE_ERROR(drivers, "can tx queue full");
     }
 }
 
-void DjiMotorTxHandler::serializeMotorStoreSendData(
-    DjiMotor** canMotorStore,
-    modm::can::Message* messageLow,
-    modm::can::Message* messageHigh,
-    modm::can::Message* message6020Current,
-    bool* validMotorMessageLow,
-    bool* validMotorMessageHigh,
-    bool* validMotorMessage6020Current)
+bool DjiMotorTxHandler::queueControlMessage(can::CanBus bus, const modm::can::Message& message)
+{
+    return drivers->canTxQueue.queueMessage(
+        bus,
+        message,
+        can::CanTxPriority::HIGH,
+        CONTROL_MESSAGE_MAX_AGE_US);
+}
+
+void DjiMotorTxHandler::updateMessagePlan()
 {
-    for (int i = 0; i < DJI_MOTORS_PER_CAN; i++)
+    numPlannedMessages = 0;
+    numPlannedMotors = 0;
+    addMotorStoreToMessagePlan(can::CanBus::CAN_BUS1, can1MotorStore);
+    addMotorStoreToMessagePlan(can::CanBus::CAN_BUS2, can2MotorStore);
+}
+
+void DjiMotorTxHandler::addMotorStoreToMessagePlan(can::CanBus bus, DjiMotor* const* canMotorStore)
+{
+    static constexpr uint32_t MESSAGE_IDENTIFIERS[] = {
+        CAN_DJI_LOW_IDENTIFIER,
+        CAN_DJI_HIGH_IDENTIFIER,
+        CAN_DJI_6020_CURRENT_IDENTIFIER};
+
+    for (uint32_t identifier : MESSAGE_IDENTIFIERS)
     {
-        const DjiMotor* const motor = canMotorStore[i];
-        if (motor != nullptr)
+        // Only plan a message if at least one motor is sent in it
+        PlannedMessage* message = nullptr;
+        for (int i = 0; i < DJI_MOTORS_PER_CAN; i++)
         {
-            if (DJI_MOTOR_TO_NORMALIZED_ID(motor->getMotorIdentifier()) <=
-                DJI_MOTOR_TO_NORMALIZED_ID(tap::motor::MOTOR4))
-            {
-                motor->serializeCanSendData(messageLow);
-                *validMotorMessageLow = true;
-            }
-            else if (motor->isInCurrentControl())
+            const DjiMotor* const motor = canMotorStore[i];
+            if (motor == nullptr || getControlMessageIdentifier(*motor) != identifier)
             {
-                motor->serializeCanSendData(message6020Current);
-                *validMotorMessage6020Current = true;
+                continue;
             }
-            else
+
+            if (message == nullptr)
             {
-                motor->serializeCanSendData(messageHigh);
-                *validMotorMessageHigh = true;
+                message = &plannedMessages[numPlannedMessages++];
+                message->bus = bus;
+                message->message =
+                    modm::can::Message(identifier, CAN_DJI_MESSAGE_SEND_LENGTH, 0, false);
             }
+            plannedMotors[numPlannedMotors++] = {motor, message};
         }
     }
 }
 
+uint32_t DjiMotorTxHandler::getControlMessageIdentifier(const DjiMotor& motor)
+{
+    if (DJI_MOTOR_TO_NORMALIZED_ID(motor.getMotorIdentifier()) <=
+        DJI_MOTOR_TO_NORMALIZED_ID(tap::motor::MOTOR4))
+    {
+        return CAN_DJI_LOW_IDENTIFIER;
+    }
+    return motor.isInCurrentControl() ? CAN_DJI_6020_CURRENT_IDENTIFIER : CAN_DJI_HIGH_IDENTIFIER;
+}
+
 void DjiMotorTxHandler::removeFromMotorManager(const DjiMotor& motor)
 {
     if (motor.getCanBus() == tap::can::CanBus::CAN_BUS1)
@@ -212,6 +156,7 @@ void DjiMotorTxHandler::removeFromMotorManager(const DjiMotor& motor, DjiMotor**
         return;
     }
     motorStore[id] = nullptr;
+    updateMessagePlan();
 }
 
 DjiMotor const* DjiMotorTxHandler::getCan1Motor(MotorId motorId)
@@ -22,6 +22,7 @@
 
 #include <limits.h>
 
+#include "tap/communication/can/can_bus.hpp"
 #include "tap/util_macros.hpp"
 
 #include "modm/architecture/interface/can_message.hpp"
@@ -79,21 +80,40 @@ class DjiMotorTxHandler
     static constexpr uint32_t CAN_DJI_HIGH_IDENTIFIER = 0X1FF;
     /** CAN message identifier for 6020s in current mode of control message. */
     static constexpr uint32_t CAN_DJI_6020_CURRENT_IDENTIFIER = 0x1FE;
+    /**
+     * Microseconds a queued control message may wait for a free transmit mailbox before it is
+     * discarded instead of sent late. Each call to `encodeAndSendCanData` replaces any control
+     * message still waiting, so this only matters when calls stop.
+     */
+    static constexpr uint32_t CONTROL_MESSAGE_MAX_AGE_US = 10'000;
 
     DjiMotorTxHandler(Drivers* drivers) : drivers(drivers) {}
     mockable ~DjiMotorTxHandler() = default;
     DISALLOW_COPY_AND_ASSIGN(DjiMotorTxHandler)
 
+    /** Most control messages sent by `encodeAndSendCanData`, 3 per CAN bus. */
+    static constexpr int MAX_CONTROL_MESSAGES = 6;
+
     /**
      * Adds the motor to the manager so that it can receive motor messages from the CAN bus. If
-     * there is already a motor with the same ID in the manager, the program will abort
+     * there is already a motor with the same ID in the manager, the program will abort.
+     *
+     * The control message the motor is sent in is chosen here from its ID and
+     * `isInCurrentControl()`, neither of which may change while the motor is in the manager.
      */
     mockable void addMotorToManager(DjiMotor* motor);
 
     /**
-     * Sends motor commands across the CAN bus. Sends up to 4 messages (2 per CAN bus), though it
+     * Sends motor commands across the CAN bus. Sends up to 6 messages (3 per CAN bus), though it
      * may send less depending on which motors have been registered with the motor manager. Each
      * messages encodes motor controller command information for up to 4 motors.
+     *
+     * Messages are queued in the drivers' `CanTxQueue` at high priority, so a message that does
+     * not fit in a transmit mailbox right away is sent as soon as one frees up.
+     *
+     * Which messages are sent and which motor is serialized into which message is planned when
+     * motors are added or removed, so this only serializes each motor's output and queues the
+     * planned messages.
      */
     mockable void encodeAndSendCanData();
 
@@ -112,18 +132,45 @@ class DjiMotorTxHandler
     DjiMotor* can1MotorStore[DJI_MOTORS_PER_CAN] = {0};
     DjiMotor* can2MotorStore[DJI_MOTORS_PER_CAN] = {0};
 
-    void addMotorToManager(DjiMotor** canMotorStore, DjiMotor* const motor);
+    /** A control message sent by every call to `encodeAndSendCanData`. */
+    struct PlannedMessage
+    {
+        can::CanBus bus;
+        /// Reused every call, bytes of absent motors stay 0.
+        modm::can::Message message;
+    };
+
+    /** A motor and the planned message its output is serialized into. */
+    struct PlannedMotor
+    {
+        const DjiMotor* motor;
+        PlannedMessage* message;
+    };
+
+    /// Messages to send, in the order low, high, 6020 current, CAN1 before CAN2.
+    PlannedMessage plannedMessages[MAX_CONTROL_MESSAGES];
+    int numPlannedMessages = 0;
+
+    PlannedMotor plannedMotors[2 * DJI_MOTORS_PER_CAN];
+    int numPlannedMotors = 0;
 
-    void serializeMotorStoreSendData(
-        DjiMotor** canMotorStore,
-        modm::can::Message* messageLow,
-        modm::can::Message* messageHigh,
-        modm::can::Message* message6020Current,
-        bool* validMotorMessageLow,
-        bool* validMotorMessageHigh,
-        bool* validMotorMessage6020Current);
+    void addMotorToManager(DjiMotor** canMotorStore, DjiMotor* const motor);
 
     void removeFromMotorManager(const DjiMotor& motor, DjiMotor** motorStore);
+
+    /**
+     * Rebuilds `plannedMessages` and `plannedMotors` from the motor stores. Called whenever a
+     * motor is added or removed.
+     */
+    void updateMessagePlan();
+
+    void addMotorStoreToMessagePlan(can::CanBus bus, DjiMotor* const* canMotorStore);
+
+    /// @return The identifier of the control message `motor`'s output is sent in.
+    static uint32_t getControlMessageIdentifier(const DjiMotor& motor);
+
+    /// @return `false` if the drivers' `CanTxQueue` for `bus` is full.
+    mockable bool queueControlMessage(can::CanBus bus, const modm::can::Message& message);
 };
 
 }  // namespace tap::motor
@@ -103,6 +103,20 @@ bool DjiMotorSimHandler::encodeMessage(CanBus bus, modm::can::Message* message)
     return true;
 }
 
+bool DjiMotorSimHandler::encodeMessage(CanBus bus, MotorId motorId, modm::can::Message* message)
+{
+    auto motorSim = motorIDToMotorSimMap.find(std::tuple<can::CanBus, MotorId>(bus, motorId));
+    if (message == nullptr || motorSim == motorIDToMotorSimMap.end()) return false;
+
+    *message = CanSerializer::serializeFeedback(
+        motorSim->second->getEnc(),
+        motorSim->second->getRPM(),
+        motorSim->second->getInput(),
+        motorId);
+
+    return true;
+}
+
 void DjiMotorSimHandler::updateSims()
 {
     for (auto& it : motorIDToMotorSimMap)
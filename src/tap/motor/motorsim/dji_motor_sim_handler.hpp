@@ -69,6 +69,13 @@ class DjiMotorSimHandler
      */
     bool encodeMessage(tap::can::CanBus bus, modm::can::Message* message);
 
+    /**
+     * Fills the given pointer with the feedback message of the motor sim registered at the given
+     * position on the given CAN bus.
+     * Returns false if no motor sim is registered there.
+     */
+    bool encodeMessage(tap::can::CanBus bus, MotorId motorId, modm::can::Message* message);
+
     /// Updates all MotorSim objects (position, RPM, time values).
     void updateSims();
 
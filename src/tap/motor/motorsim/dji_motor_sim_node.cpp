@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2026 Advanced Robotics at the University of Washington <robomstr@uw.edu>
+ *
+ * This file is part of Taproot.
+ *
+ * Taproot is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Taproot is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Taproot.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifdef PLATFORM_HOSTED
+
+#include "dji_motor_sim_node.hpp"
+
+#include "tap/motor/dji_motor_tx_handler.hpp"
+
+#include "modm/architecture/interface/can_message.hpp"
+
+#include "dji_motor_sim_handler.hpp"
+
+namespace tap::motor::motorsim
+{
+DjiMotorSimNode::DjiMotorSimNode(
+    tap::can::VirtualCanBus *bus,
+    tap::can::CanBus canBus,
+    DjiMotorSimHandler *handler)
+    : bus(bus),
+      canBus(canBus),
+      handler(handler)
+{
+    bus->attachNode(this);
+}
+
+DjiMotorSimNode::~DjiMotorSimNode() { bus->detachNode(this); }
+
+void DjiMotorSimNode::onFrameReceived(const modm::can::Message &message, uint64_t time)
+{
+    UNUSED(time);
+
+    if (!message.isExtended() &&
+        (message.getIdentifier() == DjiMotorTxHandler::CAN_DJI_LOW_IDENTIFIER ||
+         message.getIdentifier() == DjiMotorTxHandler::CAN_DJI_HIGH_IDENTIFIER))
+    {
+        handler->parseMotorMessage(canBus, message);
+    }
+}
+
+void DjiMotorSimNode::onFrameTransmitted(const modm::can::Message &message, uint64_t time)
+{
+    UNUSED(time);
+
+    uint32_t normalizedId = DJI_MOTOR_TO_NORMALIZED_ID(message.getIdentifier());
+    if (!message.isExtended() && normalizedId < DjiMotorTxHandler::DJI_MOTORS_PER_CAN)
+    {
+        feedbackWaiting[normalizedId] = false;
+    }
+}
+
+uint64_t DjiMotorSimNode::update(uint64_t time)
+{
+    for (int i = 0; i < DjiMotorTxHandler::DJI_MOTORS_PER_CAN; i++)
+    {
+        modm::can::Message feedback;
+        if (!feedbackWaiting[i] &&
+            handler->encodeMessage(canBus, NORMALIZED_ID_TO_DJI_MOTOR(i), &feedback))
+        {
+            bus->transmit(this, feedback);
+            feedbackWaiting[i] = true;
+        }
+    }
+
+    return time + FEEDBACK_PERIOD_US;
+}
+}  // namespace tap::motor::motorsim
+
+#endif  // PLATFORM_HOSTED
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2026 Advanced Robotics at the University of Washington <robomstr@uw.edu>
+ *
+ * This file is part of Taproot.
+ *
+ * Taproot is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Taproot is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Taproot.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef TAPROOT_DJI_MOTOR_SIM_NODE_HPP_
+#define TAPROOT_DJI_MOTOR_SIM_NODE_HPP_
+
+#ifdef PLATFORM_HOSTED
+
+#include <cstdint>
+
+#include "tap/communication/can/can_bus.hpp"
+#include "tap/communication/can/virtual_can_bus.hpp"
+#include "tap/motor/dji_motor_tx_handler.hpp"
+#include "tap/util_macros.hpp"
+
+namespace tap::motor::motorsim
+{
+class DjiMotorSimHandler;
+
+/**
+ * Puts the DJI motor sims registered with a `DjiMotorSimHandler` for one CAN bus on a
+ * `tap::can::VirtualCanBus`, the way DJI speed controllers sit on a real bus.
+ *
+ * Control frames (`DjiMotorTxHandler::CAN_DJI_LOW_IDENTIFIER` and `CAN_DJI_HIGH_IDENTIFIER`)
+ * set the sims' inputs, and every `FEEDBACK_PERIOD_US` each sim sends its feedback frame. A sim
+ * whose previous feedback frame is still waiting for the bus skips its turn, so a saturated bus
+ * does not build up a backlog of stale feedback.
+ * `Can` attaches one node per bus in hosted builds, so sims registered with
+ * `DjiMotorSimHandler::getInstance()` respond without any further setup.
+ */
+class DjiMotorSimNode : public tap::can::VirtualCanNode
+{
+public:
+    /// DJI speed controllers send feedback at 1 kHz.
+    static constexpr uint32_t FEEDBACK_PERIOD_US = 1'000;
+
+    DjiMotorSimNode(
+        tap::can::VirtualCanBus *bus,
+        tap::can::CanBus canBus,
+        DjiMotorSimHandler *handler);
+    DISALLOW_COPY_AND_ASSIGN(DjiMotorSimNode)
+    ~DjiMotorSimNode();
+
+    void onFrameReceived(const modm::can::Message &message, uint64_t time) override;
+
+    void onFrameTransmitted(const modm::can::Message &message, uint64_t time) override;
+
+    uint64_t update(uint64_t time) override;
+
+private:
+    tap::can::VirtualCanBus *bus;
+
+    const tap::can::CanBus canBus;
+
+    DjiMotorSimHandler *handler;
+
+    /// Whether each motor's last feedback frame, indexed by normalized id, is still waiting.
+    bool feedbackWaiting[DjiMotorTxHandler::DJI_MOTORS_PER_CAN] = {};
+};  // class DjiMotorSimNode
+}  // namespace tap::motor::motorsim
+
+#endif  // PLATFORM_HOSTED
+
+#endif  // TAPROOT_DJI_MOTOR_SIM_NODE_HPP_
@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2026 Advanced Robotics at the University of Washington <robomstr@uw.edu>
+ *
+ * This file is part of Taproot.
+ *
+ * Taproot is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Taproot is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Taproot.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifdef PLATFORM_HOSTED
+
+#include "rev_motor_sim_node.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#include "tap/algorithms/math_user_utils.hpp"
+
+#include "modm/architecture/interface/can_message.hpp"
+
+namespace tap::motor::motorsim
+{
+/// Device type (motor controller) and manufacturer (REV) fields of REV arbitration identifiers.
+static constexpr uint32_t REV_MOTOR_CONTROLLER_PREFIX = 0x0205;
+
+RevMotorSimNode::RevMotorSimNode(tap::can::VirtualCanBus *bus, uint8_t deviceId)
+    : bus(bus),
+      deviceId(deviceId)
+{
+    lastUpdateTime = bus->getTime();
+    bus->attachNode(this);
+}
+
+RevMotorSimNode::~RevMotorSimNode() { bus->detachNode(this); }
+
+bool RevMotorSimNode::isEnabled() const
+{
+    return heartbeatReceived && bus->getTime() - lastHeartbeatTime < HEARTBEAT_TIMEOUT_US;
+}
+
+float RevMotorSimNode::getAppliedOutput() const
+{
+    if (!isEnabled())
+    {
+        return 0;
+    }
+
+    switch (controlCommand)
+    {
+        case RevMotor::APICommand::DutyCycle:
+            return tap::algorithms::limitVal(setpoint, -1.0f, 1.0f);
+        case RevMotor::APICommand::Voltage:
+            return tap::algorithms::limitVal(setpoint / BUS_VOLTAGE, -1.0f, 1.0f);
+        default:
+            return tap::algorithms::limitVal(velocity / FREE_SPEED_RPM, -1.0f, 1.0f);
+    }
+}
+
+void RevMotorSimNode::onFrameReceived(const modm::can::Message &message, uint64_t time)
+{
+    uint32_t identifier = message.getIdentifier();
+    if (!message.isExtended() || (identifier >> 16) != REV_MOTOR_CONTROLLER_PREFIX ||
+        (identifier & 0x3f) != deviceId)
+    {
+        return;
+    }
+
+    updateMotor(time);
+
+    auto command = static_cast<RevMotor::APICommand>((identifier >> 6) & 0x3ff);
+    switch (command)
+    {
+        case RevMotor::APICommand::Heartbeat:
+            heartbeatReceived = true;
+            lastHeartbeatTime = time;
+            break;
+        case RevMotor::APICommand::DutyCycle:
+        case RevMotor::APICommand::Velocity:
+        case RevMotor::APICommand::SmartVelocity:
+        case RevMotor::APICommand::Position:
+        case RevMotor::APICommand::Voltage:
+        case RevMotor::APICommand::Current:
+        case RevMotor::APICommand::SmartMotion:
+            controlCommand = command;
+            std::memcpy(&setpoint, message.data, sizeof(setpoint));
+            break;
+        default:
+            // Parameter writes and other commands are accepted and ignored
+            break;
+    }
+
+    // Apply the new command right away, no time has passed since the position was integrated
+    updateMotor(time);
+}
+
+uint64_t RevMotorSimNode::update(uint64_t time)
+{
+    updateMotor(time);
+
+    if (time >= nextStatus0Time)
+    {
+        int16_t appliedOutput = static_cast<int16_t>(
+            tap::algorithms::limitVal(getAppliedOutput() * 32768.0f, -32768.0f, 32767.0f));
+        sendStatus(RevMotor::APICommand::Period0, static_cast<uint16_t>(appliedOutput));
+        nextStatus0Time = time + STATUS_0_PERIOD_US;
+    }
+    if (time >= nextStatus1Time)
+    {
+        uint32_t velocityBits;
+        std::memcpy(&velocityBits, &velocity, sizeof(velocityBits));
+        constexpr uint64_t TEMPERATURE = 25;
+        constexpr uint64_t VOLTAGE = static_cast<uint64_t>(BUS_VOLTAGE * 128);
+        sendStatus(
+            RevMotor::APICommand::Period1,
+            velocityBits | (TEMPERATURE << 32) | (VOLTAGE << 40));
+        nextStatus1Time = time + STATUS_1_PERIOD_US;
+    }
+    if (time >= nextStatus2Time)
+    {
+        uint32_t positionBits;
+        std::memcpy(&positionBits, &position, sizeof(positionBits));
+        sendStatus(RevMotor::APICommand::Period2, positionBits);
+        nextStatus2Time = time + STATUS_2_PERIOD_US;
+    }
+
+    return std::min({nextStatus0Time, nextStatus1Time, nextStatus2Time});
+}
+
+uint32_t RevMotorSimNode::getIdentifier(RevMotor::APICommand command) const
+{
+    return (REV_MOTOR_CONTROLLER_PREFIX << 16) | (static_cast<uint32_t>(command) << 6) | deviceId;
+}
+
+void RevMotorSimNode::updateMotor(uint64_t time)
+{
+    float dt = static_cast<float>(time - lastUpdateTime) / 60'000'000.0f;
+    lastUpdateTime = time;
+
+    position += velocity * dt;
+
+    if (!isEnabled())
+    {
+        velocity = 0;
+        return;
+    }
+
+    switch (controlCommand)
+    {
+        case RevMotor::APICommand::Velocity:
+        case RevMotor::APICommand::SmartVelocity:
+            velocity = tap::algorithms::limitVal(setpoint, -FREE_SPEED_RPM, FREE_SPEED_RPM);
+            break;
+        case RevMotor::APICommand::Position:
+        case RevMotor::APICommand::SmartMotion:
+            position = setpoint;
+            velocity = 0;
+            break;
+        default:
+            velocity = getAppliedOutput() * FREE_SPEED_RPM;
+            break;
+    }
+}
+
+void RevMotorSimNode::sendStatus(RevMotor::APICommand status, uint64_t data)
+{
+    modm::can::Message message(getIdentifier(status), 8, 0, true);
+    std::memcpy(message.data, &data, sizeof(data));
+    bus->transmit(this, message);
+}
+}  // namespace tap::motor::motorsim
+
+#endif  // PLATFORM_HOSTED
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2026 Advanced Robotics at the University of Washington <robomstr@uw.edu>
+ *
+ * This file is part of Taproot.
+ *
+ * Taproot is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Taproot is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Taproot.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef TAPROOT_REV_MOTOR_SIM_NODE_HPP_
+#define TAPROOT_REV_MOTOR_SIM_NODE_HPP_
+
+#ifdef PLATFORM_HOSTED
+
+#include <cstdint>
+
+#include "tap/communication/can/virtual_can_bus.hpp"
+#include "tap/motor/sparkmax/rev_motor.hpp"
+#include "tap/util_macros.hpp"
+
+namespace tap::motor::motorsim
+{
+/**
+ * A simulated REV SPARK MAX on a `tap::can::VirtualCanBus`, enough to run `RevMotor` and
+ * `RevMotorTxHandler` against.
+ *
+ * The node follows the control frames sent to its device number and reports back with periodic
+ * status frames 0 (applied output), 1 (velocity) and 2 (position) at the SPARK MAX's default
+ * rates. The motor is ideal: its velocity follows the last setpoint immediately, with
+ * `FREE_SPEED_RPM` at full output. Without a heartbeat for `HEARTBEAT_TIMEOUT_US` the output
+ * is disabled, as on the real controller.
+ */
+class RevMotorSimNode : public tap::can::VirtualCanNode
+{
+public:
+    static constexpr uint32_t STATUS_0_PERIOD_US = 10'000;
+    static constexpr uint32_t STATUS_1_PERIOD_US = 20'000;
+    static constexpr uint32_t STATUS_2_PERIOD_US = 20'000;
+
+    static constexpr uint32_t HEARTBEAT_TIMEOUT_US = 100'000;
+
+    /// Free speed of a NEO brushless motor.
+    static constexpr float FREE_SPEED_RPM = 5676.0f;
+
+    static constexpr float BUS_VOLTAGE = 12.0f;
+
+    /**
+     * @param[in] deviceId The REV device number, [`0`, `63`].
+     */
+    RevMotorSimNode(tap::can::VirtualCanBus *bus, uint8_t deviceId);
+    DISALLOW_COPY_AND_ASSIGN(RevMotorSimNode)
+    ~RevMotorSimNode();
+
+    inline uint8_t getDeviceId() const { return deviceId; }
+
+    /// @return `true` if a heartbeat was received in the last `HEARTBEAT_TIMEOUT_US`.
+    bool isEnabled() const;
+
+    /// @return The control command of the last control frame received.
+    inline RevMotor::APICommand getControlCommand() const { return controlCommand; }
+
+    /// @return The value of the last control frame received.
+    inline float getSetpoint() const { return setpoint; }
+
+    /// @return The applied output, as a duty cycle in [-1, 1].
+    float getAppliedOutput() const;
+
+    /// @return Motor velocity, in RPM.
+    inline float getVelocity() const { return velocity; }
+
+    /// @return Motor position, in rotations.
+    inline float getPosition() const { return position; }
+
+    void onFrameReceived(const modm::can::Message &message, uint64_t time) override;
+
+    uint64_t update(uint64_t time) override;
+
+private:
+    tap::can::VirtualCanBus *bus;
+
+    const uint8_t deviceId;
+
+    RevMotor::APICommand controlCommand = RevMotor::APICommand::DutyCycle;
+    float setpoint = 0;
+
+    bool heartbeatReceived = false;
+    uint64_t lastHeartbeatTime = 0;
+
+    float velocity = 0;
+    float position = 0;
+
+    uint64_t lastUpdateTime = 0;
+    uint64_t nextStatus0Time = 0;
+    uint64_t nextStatus1Time = 0;
+    uint64_t nextStatus2Time = 0;
+
+    /// @return The arbitration identifier of `command` for this device.
+    uint32_t getIdentifier(RevMotor::APICommand command) const;
+
+    /// Integrates position and updates velocity from the current setpoint.
+    void updateMotor(uint64_t time);
+
+    void sendStatus(RevMotor::APICommand status, uint64_t data);
+};  // class RevMotorSimNode
+}  // namespace tap::motor::motorsim
+
+#endif  // PLATFORM_HOSTED
+
+#endif  // TAPROOT_REV_MOTOR_SIM_NODE_HPP_
@@ -47,7 +47,11 @@ RevMotor::RevMotor(
     float gearRatio,
     [[maybe_unused]] uint32_t encoderHomePosition,
     tap::encoder::EncoderInterface* externalEncoder)
-    : CanRxListener(drivers, static_cast<uint32_t>(desMotorIdentifier), motorCanBus),
+    : CanRxListener(
+          drivers,
+          static_cast<uint32_t>(desMotorIdentifier),
+          motorCanBus,
+          can::CanRxIdType::REV_DEVICE),
       motorName(name),
       drivers(drivers),
       motorIdentifier(desMotorIdentifier),
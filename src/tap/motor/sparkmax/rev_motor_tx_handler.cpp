@@ -58,17 +58,13 @@ void RevMotorTxHandler::addMotorToManager(RevMotor* motor)
 }
 
 /**
- * Encodes and sends control and heartbeat messages for all connected REV motors on both CAN buses.
+ * Queues a control message for every connected REV motor on both CAN buses.
  *
- * This method iterates through each motor store (CAN1 and CAN2) and for each valid motor:
- * 1. Sends a heartbeat message to maintain connection with the motor controller
- * 2. Sends a control message with the motor's current target values
+ * Each control message carries the motor's current target value, or the next parameter write
+ * the motor has queued. Messages go through the drivers' `CanTxQueue`, so a message that does
+ * not fit in a transmit mailbox right away is sent once one frees up instead of being dropped.
  *
- * The heartbeat messages prevent timeout disconnections, while the control messages
- * provide the actual motor commands. Each message is properly formatted with the
- * correct arbitration ID based on the motor's ID and message type.
- *
- * If any send operation fails, an error will be raised.
+ * If the queue is full, an error will be raised.
  *
  * @note This method should be called periodically to maintain motor control.
  */
@@ -76,40 +72,30 @@ void RevMotorTxHandler::encodeAndSendCanData()
 {
     bool messageSuccess = true;
 
-    // Process CAN bus 1 motors
-    if (drivers->can.isReadyToSend(can::CanBus::CAN_BUS1))
+    for (int i = 0; i < REV_MOTORS_PER_CAN; i++)
     {
-        for (int i = 0; i < REV_MOTORS_PER_CAN; i++)
+        // Control messages may be queued parameter writes, which must not expire
+        if (can1MotorStore[i] != nullptr)
         {
-            RevMotor* motor = can1MotorStore[i];
-            if (motor != nullptr)
-            {
-                // Create and send control message for this motor
-                modm::can::Message controlMsg = motor->createRevCanMessage(motor);
-                messageSuccess &= drivers->can.sendMessage(can::CanBus::CAN_BUS1, controlMsg);
-            }
+            messageSuccess &= drivers->canTxQueue.queueMessage(
+                can::CanBus::CAN_BUS1,
+                can1MotorStore[i]->createRevCanMessage(can1MotorStore[i]),
+                can::CanTxPriority::HIGH,
+                can::CanTxQueue::NO_DEADLINE);
         }
-    }
-
-    // Process CAN bus 2 motors
-    if (drivers->can.isReadyToSend(can::CanBus::CAN_BUS2))
-    {
-        // Then do the same for CAN2
-        for (int i = 0; i < REV_MOTORS_PER_CAN; i++)
+        if (can2MotorStore[i] != nullptr)
         {
-            RevMotor* motor = can2MotorStore[i];
-            if (motor != nullptr)
-            {
-                // Create and send control message for this motor
-                modm::can::Message controlMsg = motor->createRevCanMessage(motor);
-                messageSuccess &= drivers->can.sendMessage(can::CanBus::CAN_BUS2, controlMsg);
-            }
+            messageSuccess &= drivers->canTxQueue.queueMessage(
+                can::CanBus::CAN_BUS2,
+                can2MotorStore[i]->createRevCanMessage(can2MotorStore[i]),
+                can::CanTxPriority::HIGH,
+                can::CanTxQueue::NO_DEADLINE);
         }
     }
 
     if (!messageSuccess)
     {
-        RAISE_ERROR(drivers, "sendMessage failure");
+        RAISE_ERROR(drivers, "can tx queue full");
     }
 }
 
@@ -117,41 +103,29 @@ void RevMotorTxHandler::heartBeat()
 {
     bool messageSuccess = true;
 
-    // Process CAN bus 1 motors
-    if (drivers->can.isReadyToSend(can::CanBus::CAN_BUS1))
+    for (int i = 0; i < REV_MOTORS_PER_CAN; i++)
     {
-        for (int i = 0; i < REV_MOTORS_PER_CAN; i++)
+        if (can1MotorStore[i] != nullptr)
         {
-            RevMotor* motor = can1MotorStore[i];
-            if (motor != nullptr)
-            {
-                // Create and send heartbeat for this motor
-                modm::can::Message heartbeatMsg = motor->constructRevMotorHeartBeat(motor);
-                messageSuccess &= drivers->can.sendMessage(can::CanBus::CAN_BUS1, heartbeatMsg);
-            }
+            messageSuccess &= drivers->canTxQueue.queueMessage(
+                can::CanBus::CAN_BUS1,
+                can1MotorStore[i]->constructRevMotorHeartBeat(can1MotorStore[i]),
+                can::CanTxPriority::NORMAL,
+                HEARTBEAT_MAX_AGE_US);
         }
-    }
-
-    // Process CAN bus 2 motors
-    if (drivers->can.isReadyToSend(can::CanBus::CAN_BUS2))
-    {
-        // Then do the same for CAN2
-        for (int i = 0; i < REV_MOTORS_PER_CAN; i++)
+        if (can2MotorStore[i] != nullptr)
         {
-            RevMotor* motor = can2MotorStore[i];
-            if (motor != nullptr)
-            {
-                // TODO: MOVE THESE FUNCTIONS INTO REV MOTOR CLASS and then reimplement them here
-                // Create and send heartbeat for this motor
-                modm::can::Message heartbeatMsg = motor->constructRevMotorHeartBeat(motor);
-                messageSuccess &= drivers->can.sendMessage(can::CanBus::CAN_BUS2, heartbeatMsg);
-            }
+            messageSuccess &= drivers->canTxQueue.queueMessage(
+                can::CanBus::CAN_BUS2,
+                can2MotorStore[i]->constructRevMotorHeartBeat(can2MotorStore[i]),
+                can::CanTxPriority::NORMAL,
+                HEARTBEAT_MAX_AGE_US);
         }
     }
 
     if (!messageSuccess)
     {
-        RAISE_ERROR(drivers, "sendMessage failure");
+        RAISE_ERROR(drivers, "can tx queue full");
     }
 }
 
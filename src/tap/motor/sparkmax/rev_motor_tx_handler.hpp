@@ -78,6 +78,11 @@ class RevMotorTxHandler
     static constexpr int REV_MOTORS_PER_CAN = 8;
     /** CAN message length of each motor control message. */
     static constexpr int CAN_REV_MESSAGE_SEND_LENGTH = 8;
+    /**
+     * Microseconds a queued heartbeat may wait for a free transmit mailbox before it is
+     * discarded. Well below the motor controller's heartbeat timeout.
+     */
+    static constexpr uint32_t HEARTBEAT_MAX_AGE_US = 20'000;
     // /** CAN message identifier for "low" segment (low 4 CAN motor IDs) of control message.
     // */ static constexpr uint32_t CAN_DJI_LOW_IDENTIFIER = 0X200;
     // /** CAN message identifier for "high" segment (high 4 CAN motor IDs) of control message.
@@ -100,6 +105,9 @@ class RevMotorTxHandler
      */
     void encodeAndSendCanData();
 
+    /**
+     * Queues a heartbeat for every connected motor, at a lower priority than control messages.
+     */
     void heartBeat();
 
     /**
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2026 Advanced Robotics at the University of Washington <robomstr@uw.edu>
+ *
+ * This file is part of Taproot.
+ *
+ * Taproot is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Taproot is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Taproot.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "can_capture_log_writer.hpp"
+
+#include "littlefs_internal.hpp"
+
+namespace tap::storage
+{
+CanCaptureLogWriter::CanCaptureLogWriter(LittleFSInternal *storage) : storage(storage) {}
+
+int CanCaptureLogWriter::write(const tap::can::CanCapture &capture, const char *path)
+{
+    if (storage->getFSConfig()->cache_size > sizeof(fileBuffer))
+    {
+        return LFS_ERR_INVAL;
+    }
+
+    lfs_file_t file;
+    lfs_file_config fileConfig = {};
+    fileConfig.buffer = fileBuffer;
+
+    int error = lfs_file_opencfg(
+        storage->getFS(),
+        &file,
+        path,
+        LFS_O_WRONLY | LFS_O_CREAT | LFS_O_TRUNC,
+        &fileConfig);
+    if (error != LFS_ERR_OK)
+    {
+        return error;
+    }
+
+    char line[tap::can::CanCapture::MAX_LOG_LINE_LENGTH];
+    for (std::size_t i = 0; i < capture.size() && error == LFS_ERR_OK; i++)
+    {
+        int length = tap::can::CanCapture::formatRecord(capture.getRecord(i), line, sizeof(line));
+        lfs_ssize_t written = lfs_file_write(storage->getFS(), &file, line, length);
+        if (written < 0)
+        {
+            error = written;
+        }
+    }
+
+    int closeError = lfs_file_close(storage->getFS(), &file);
+    return error != LFS_ERR_OK ? error : closeError;
+}
+}  // namespace tap::storage
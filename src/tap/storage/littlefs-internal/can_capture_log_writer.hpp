@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2026 Advanced Robotics at the University of Washington <robomstr@uw.edu>
+ *
+ * This file is part of Taproot.
+ *
+ * Taproot is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Taproot is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Taproot.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef TAPROOT_CAN_CAPTURE_LOG_WRITER_HPP_
+#define TAPROOT_CAN_CAPTURE_LOG_WRITER_HPP_
+
+#include <cstdint>
+
+#include "tap/communication/can/can_capture.hpp"
+#include "tap/util_macros.hpp"
+
+#include "littlefs/lfs.h"
+
+namespace tap::storage
+{
+class LittleFSInternal;
+
+/**
+ * Saves the frames of a CanCapture to a LittleFS file as a candump log (see
+ * `CanCapture::formatRecord`), so a match's CAN traffic can be read off the board afterwards
+ * and replayed with `CanLogReplayer`.
+ *
+ * Writing flash is slow and blocks, so only save a capture once the robot is disabled. Stop the
+ * capture first so that it does not change while it is being written.
+ */
+class CanCaptureLogWriter
+{
+public:
+    /// Largest `cache_size` of the file system this writer supports.
+    static constexpr lfs_size_t MAX_CACHE_SIZE = 256;
+
+    /**
+     * @param[in] storage A mounted file system.
+     */
+    explicit CanCaptureLogWriter(LittleFSInternal *storage);
+    DISALLOW_COPY_AND_ASSIGN(CanCaptureLogWriter)
+
+    /**
+     * Writes every frame in `capture` to `path`, replacing the file if it exists.
+     *
+     * @return `LFS_ERR_OK`, or the negative LittleFS error code of the operation that failed.
+     */
+    int write(const tap::can::CanCapture &capture, const char *path);
+
+private:
+    LittleFSInternal *storage;
+
+    /// File cache, so that opening the file does not allocate.
+    uint8_t fileBuffer[MAX_CACHE_SIZE];
+};  // class CanCaptureLogWriter
+}  // namespace tap::storage
+
+#endif  // TAPROOT_CAN_CAPTURE_LOG_WRITER_HPP_
@@ -20,12 +20,14 @@ from SCons.Script import *
 
 CMD_LINE_ARGS                       = 1
 TEST_BUILD_TARGET_ACCEPTED_ARGS     = ["build-tests", "run-tests", "run-tests-gcov"]
+BENCHMARK_BUILD_TARGET_ACCEPTED_ARGS = ["build-benchmarks", "run-benchmarks"]
 SIM_BUILD_TARGET_ACCEPTED_ARGS      = ["build-sim", "run-sim"]
 HARDWARE_BUILD_TARGET_ACCEPTED_ARGS = ["build", "run", "size", "gdb"]
 VALID_BUILD_PROFILES                = ["debug", "release", "fast"]
 VALID_PROFILING_TYPES               = ["true", "false"]
+VALID_BENCHMARK_FORMATS             = ["csv", "json"]
 
-USAGE = "Usage: scons <target> [profile=<debug|release|fast>] [profiling=<true|false>] [test=\"<test>\"]\n\
+USAGE = "Usage: scons <target> [profile=<debug|release|fast>] [profiling=<true|false>] [test=\"<test>\"] [benchmark=\"<filter>\"] [format=<csv|json>]\n\
     \"<target>\" is one of:\n\
         - \"build\": build all code for the hardware platform.\n\
         - \"run\": build all code for the hardware platform, and deploy it to the board via a connected ST-Link.\n\
@@ -34,6 +36,8 @@ USAGE = "Usage: scons <target> [profile=<debug|release|fast>] [profiling=<true|f
         - \"build-tests\": build core code and tests for the current host platform.\n\
         - \"run-tests\": build core code and tests for the current host platform, and execute them locally with the test runner.\n\
         - \"run-tests-gcov\": builds core code and tests, executes them locally, and captures and prints code coverage information\n\
+        - \"build-benchmarks\": build core code and microbenchmarks for the current host platform.\n\
+        - \"run-benchmarks\": build core code and microbenchmarks for the current host platform, and execute them locally, printing results as CSV or JSON.\n\
         - \"build-sim\": build all code for the simulated environment, for the current host platform.\n\
         - \"run-sim\": build all code for the simulated environment, for the current host platform, and execute the simulator locally."
 
@@ -42,7 +46,8 @@ def parse_args():
     args = {
         "TARGET_ENV": "",
         "BUILD_PROFILE": "",
-        "PROFILING": ""
+        "PROFILING": "",
+        "BENCHMARKS": False
     }
     if len(COMMAND_LINE_TARGETS) > CMD_LINE_ARGS:
         raise Exception("You did not enter the correct number of arguments.\n" + USAGE)
@@ -56,6 +61,10 @@ def parse_args():
             exit(0)
         elif build_target in TEST_BUILD_TARGET_ACCEPTED_ARGS:
             args["TARGET_ENV"] = "tests"
+        elif build_target in BENCHMARK_BUILD_TARGET_ACCEPTED_ARGS:
+            # Benchmarks link against the same hosted library and mocks as the tests
+            args["TARGET_ENV"] = "tests"
+            args["BENCHMARKS"] = True
         elif build_target in SIM_BUILD_TARGET_ACCEPTED_ARGS:
             args["TARGET_ENV"] = "sim"
         elif build_target in HARDWARE_BUILD_TARGET_ACCEPTED_ARGS:
@@ -66,7 +75,7 @@ def parse_args():
         raise Exception("You must select a valid robot target.\n" + USAGE)
 
     # Extract and validate the build profile (either debug or release)
-    default_build_profile = "debug" if args["TARGET_ENV"] == "tests" else "release"
+    default_build_profile = "debug" if args["TARGET_ENV"] == "tests" and not args["BENCHMARKS"] else "release"
     args["BUILD_PROFILE"] = ARGUMENTS.get("profile", default_build_profile)
     ARGUMENTS["profile"] = args["BUILD_PROFILE"]
     if args["BUILD_PROFILE"] not in VALID_BUILD_PROFILES:
@@ -79,4 +88,11 @@ def parse_args():
     if "test" in ARGUMENTS:
         args["TEST"] = ARGUMENTS.get("test", None)
 
+    if "benchmark" in ARGUMENTS:
+        args["BENCHMARK"] = ARGUMENTS.get("benchmark", None)
+
+    args["BENCHMARK_FORMAT"] = ARGUMENTS.get("format", "csv")
+    if args["BENCHMARK_FORMAT"] not in VALID_BENCHMARK_FORMATS:
+        raise Exception("You specified an invalid benchmark output format.\n" + USAGE)
+
     return args
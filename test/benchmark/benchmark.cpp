@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2026 Advanced Robotics at the University of Washington <robomstr@uw.edu>
+ *
+ * This file is part of Taproot.
+ *
+ * Taproot is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Taproot is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Taproot.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "benchmark.hpp"
+
+#include <cstring>
+#include <iostream>
+
+namespace tap::benchmark
+{
+void Reporter::report(
+    const std::string &name,
+    const std::string &params,
+    int64_t iterations,
+    double nsPerOp)
+{
+    if (format == Format::CSV)
+    {
+        if (!headerPrinted)
+        {
+            out << "benchmark,params,iterations,ns_per_op\n";
+            headerPrinted = true;
+        }
+        out << name << ",\"" << params << "\"," << iterations << "," << nsPerOp << std::endl;
+    }
+    else
+    {
+        out << "{\"benchmark\": \"" << name << "\", \"params\": \"" << params
+            << "\", \"iterations\": " << iterations << ", \"ns_per_op\": " << nsPerOp << "}"
+            << std::endl;
+    }
+}
+
+BenchmarkRegistration::BenchmarkRegistration(const char *name, BenchmarkFunction function)
+{
+    getBenchmarks().push_back({name, function});
+}
+
+std::vector<BenchmarkRegistration::Entry> &BenchmarkRegistration::getBenchmarks()
+{
+    static std::vector<Entry> benchmarks;
+    return benchmarks;
+}
+}  // namespace tap::benchmark
+
+static void printUsage(const char *program)
+{
+    std::cerr << "Usage: " << program << " [--format=csv|json] [--filter=<substring>] [--list]\n";
+}
+
+int main(int argc, char **argv)
+{
+    using tap::benchmark::BenchmarkRegistration;
+    using tap::benchmark::Reporter;
+
+    Reporter::Format format = Reporter::Format::CSV;
+    const char *filter = "";
+    bool list = false;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--format=csv") == 0)
+        {
+            format = Reporter::Format::CSV;
+        }
+        else if (strcmp(argv[i], "--format=json") == 0)
+        {
+            format = Reporter::Format::JSON;
+        }
+        else if (strncmp(argv[i], "--filter=", strlen("--filter=")) == 0)
+        {
+            filter = argv[i] + strlen("--filter=");
+        }
+        else if (strcmp(argv[i], "--list") == 0)
+        {
+            list = true;
+        }
+        else
+        {
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+
+    Reporter reporter(std::cout, format);
+
+    for (const auto &benchmark : BenchmarkRegistration::getBenchmarks())
+    {
+        if (strstr(benchmark.name, filter) == nullptr)
+        {
+            continue;
+        }
+
+        if (list)
+        {
+            std::cout << benchmark.name << std::endl;
+        }
+        else
+        {
+            benchmark.function(reporter);
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2026 Advanced Robotics at the University of Washington <robomstr@uw.edu>
+ *
+ * This file is part of Taproot.
+ *
+ * Taproot is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Taproot is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Taproot.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef TAPROOT_BENCHMARK_HPP_
+#define TAPROOT_BENCHMARK_HPP_
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace tap::benchmark
+{
+/**
+ * Collects benchmark results and prints them in a machine-readable format, either CSV with a
+ * header row or one JSON object per line.
+ */
+class Reporter
+{
+public:
+    enum class Format
+    {
+        CSV,
+        JSON,
+    };
+
+    Reporter(std::ostream &out, Format format) : out(out), format(format) {}
+
+    /**
+     * Prints one result.
+     *
+     * @param[in] name Name of the measured operation, e.g. `CommandScheduler::run`.
+     * @param[in] params Comma separated `key=value` pairs describing the configuration.
+     * @param[in] iterations The number of operations timed.
+     * @param[in] nsPerOp The time taken per operation, in nanoseconds.
+     */
+    void report(
+        const std::string &name,
+        const std::string &params,
+        int64_t iterations,
+        double nsPerOp);
+
+private:
+    std::ostream &out;
+    Format format;
+    bool headerPrinted = false;
+};
+
+using BenchmarkFunction = void (*)(Reporter &reporter);
+
+/**
+ * Adds a benchmark to the list run by the benchmark program's `main`. Use through
+ * `TAPROOT_BENCHMARK`.
+ */
+class BenchmarkRegistration
+{
+public:
+    BenchmarkRegistration(const char *name, BenchmarkFunction function);
+
+    struct Entry
+    {
+        const char *name;
+        BenchmarkFunction function;
+    };
+
+    static std::vector<Entry> &getBenchmarks();
+};
+
+/**
+ * Prevents the compiler from optimizing away the computation of `value`.
+ */
+template <typename T>
+inline void doNotOptimize(const T &value)
+{
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+/**
+ * Times `runOps`, which must perform `ops` operations each time it is called, and returns the
+ * median time per operation in nanoseconds over `repetitions` calls after one warm up call.
+ */
+template <typename F>
+double measureNanosecondsPerOp(int64_t ops, F &&runOps, int repetitions = 5)
+{
+    runOps();
+
+    std::vector<double> samples;
+    for (int i = 0; i < repetitions; i++)
+    {
+        auto start = std::chrono::steady_clock::now();
+        runOps();
+        auto end = std::chrono::steady_clock::now();
+        samples.push_back(std::chrono::duration<double, std::nano>(end - start).count() / ops);
+    }
+
+    std::sort(samples.begin(), samples.end());
+    return samples[samples.size() / 2];
+}
+}  // namespace tap::benchmark
+
+/**
+ * Defines a benchmark function, `void name(tap::benchmark::Reporter &reporter)`, and registers it
+ * with the benchmark program.
+ */
+#define TAPROOT_BENCHMARK(name)                                                          \
+    static void name(::tap::benchmark::Reporter &reporter);                              \
+    static const ::tap::benchmark::BenchmarkRegistration name##Registration(#name, name); \
+    static void name(::tap::benchmark::Reporter &reporter)
+
+#endif  // TAPROOT_BENCHMARK_HPP_
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2026 Advanced Robotics at the University of Washington <robomstr@uw.edu>
+ *
+ * This file is part of Taproot.
+ *
+ * Taproot is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Taproot is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Taproot.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <string>
+#include <vector>
+
+#include "tap/architecture/profiler.hpp"
+#include "tap/drivers.hpp"
+
+#include "benchmark.hpp"
+
+using tap::arch::Profiler;
+
+TAPROOT_BENCHMARK(ProfilerPushPop)
+{
+    constexpr int OPS = 1'000'000;
+
+    for (int numProfiles : {1, 16, 128})
+    {
+        tap::Drivers drivers;
+        Profiler profiler(&drivers);
+
+        std::vector<std::string> names;
+        for (int i = 0; i < numProfiles; i++)
+        {
+            names.push_back("profile " + std::to_string(i));
+        }
+        for (const std::string &name : names)
+        {
+            profiler.pop(profiler.push(name.c_str()));
+        }
+
+        // The most recently registered profile is the slowest to find by name
+        const char *name = names.back().c_str();
+        const std::string params = "profiles=" + std::to_string(numProfiles);
+
+        double byNameNs = tap::benchmark::measureNanosecondsPerOp(OPS, [&] {
+            for (int i = 0; i < OPS; i++)
+            {
+                profiler.pop(profiler.push(name));
+            }
+        });
+
+        std::size_t cachedKey = Profiler::NO_KEY;
+        double cachedNs = tap::benchmark::measureNanosecondsPerOp(OPS, [&] {
+            for (int i = 0; i < OPS; i++)
+            {
+                profiler.pop(profiler.push(name, cachedKey));
+            }
+        });
+
+        reporter.report("Profiler::push(name)+pop", params, OPS, byNameNs);
+        reporter.report("Profiler::push(name, cachedKey)+pop", params, OPS, cachedNs);
+    }
+}
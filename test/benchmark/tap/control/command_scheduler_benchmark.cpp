@@ -0,0 +1,293 @@
+/*
+ * Copyright (c) 2026 Advanced Robotics at the University of Washington <robomstr@uw.edu>
+ *
+ * This file is part of Taproot.
+ *
+ * Taproot is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Taproot is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Taproot.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "tap/control/command.hpp"
+#include "tap/control/command_scheduler.hpp"
+#include "tap/control/command_scheduler_types.hpp"
+#include "tap/control/subsystem.hpp"
+#include "tap/drivers.hpp"
+
+#include "benchmark.hpp"
+
+using namespace tap::control;
+
+namespace
+{
+class BenchmarkSubsystem : public Subsystem
+{
+public:
+    explicit BenchmarkSubsystem(tap::Drivers *drivers) : Subsystem(drivers) {}
+    void refresh() override { refreshes++; }
+    void refreshSafeDisconnect() override {}
+    const char *getName() const override { return "benchmark subsystem"; }
+
+    int refreshes = 0;
+};
+
+class BenchmarkCommand : public Command
+{
+public:
+    void initialize() override {}
+    void execute() override { executions++; }
+    void end(bool) override {}
+    bool isFinished() const override { return false; }
+    const char *getName() const override { return "benchmark command"; }
+
+    int executions = 0;
+};
+
+/**
+ * A synthetic set of subsystems and commands. Command `i` requires `requirementsPerCommand`
+ * consecutive subsystems starting at subsystem `i` (wrapping around), so with more than one
+ * requirement per command, adding a command interrupts its neighbours. If `withDefaultCommands`,
+ * every other subsystem has a default command.
+ */
+struct SyntheticGraph
+{
+    SyntheticGraph(
+        tap::Drivers *drivers,
+        int numSubsystems,
+        int requirementsPerCommand,
+        bool withDefaultCommands)
+        : scheduler(drivers, true)
+    {
+        for (int i = 0; i < numSubsystems; i++)
+        {
+            subsystems.emplace_back(std::make_unique<BenchmarkSubsystem>(drivers));
+        }
+
+        for (int i = 0; i < numSubsystems; i++)
+        {
+            commands.emplace_back(std::make_unique<BenchmarkCommand>());
+            for (int r = 0; r < requirementsPerCommand; r++)
+            {
+                commands.back()->addSubsystemRequirement(
+                    subsystems[(i + r) % numSubsystems].get());
+            }
+        }
+
+        for (int i = 0; withDefaultCommands && i < numSubsystems; i += 2)
+        {
+            defaultCommands.emplace_back(std::make_unique<BenchmarkCommand>());
+            defaultCommands.back()->addSubsystemRequirement(subsystems[i].get());
+            subsystems[i]->setDefaultCommand(defaultCommands.back().get());
+        }
+
+        for (auto &subsystem : subsystems)
+        {
+            scheduler.registerSubsystem(subsystem.get());
+        }
+    }
+
+    void addAllCommands()
+    {
+        for (auto &command : commands)
+        {
+            scheduler.addCommand(command.get());
+        }
+    }
+
+    void removeAllCommands()
+    {
+        for (auto &command : commands)
+        {
+            scheduler.removeCommand(command.get(), true);
+        }
+    }
+
+    // Subsystems and commands must outlive the scheduler
+    std::vector<std::unique_ptr<BenchmarkSubsystem>> subsystems;
+    std::vector<std::unique_ptr<BenchmarkCommand>> commands;
+    std::vector<std::unique_ptr<BenchmarkCommand>> defaultCommands;
+    CommandScheduler scheduler;
+};
+
+struct GraphShape
+{
+    int numSubsystems;
+    int requirementsPerCommand;
+    bool withDefaultCommands;
+};
+
+/// Graph shapes measured, sized to fit the configured scheduler bitmaps.
+std::vector<GraphShape> getGraphShapes()
+{
+    std::vector<GraphShape> shapes;
+    for (int numSubsystems : {4, 5, 16, 30, 32, 64, 128})
+    {
+        if (numSubsystems > subsystem_scheduler_bitmap_t::SIZE)
+        {
+            continue;
+        }
+
+        if (numSubsystems * 3 / 2 <= command_scheduler_bitmap_t::SIZE)
+        {
+            // 1 command per subsystem plus a default command on every other subsystem
+            shapes.push_back({numSubsystems, 1, true});
+            shapes.push_back({numSubsystems, 3, true});
+        }
+        else if (numSubsystems <= command_scheduler_bitmap_t::SIZE)
+        {
+            // Too many subsystems for default commands to fit, 1 command per subsystem only
+            shapes.push_back({numSubsystems, 1, false});
+        }
+    }
+    return shapes;
+}
+
+std::string formatParams(const GraphShape &shape)
+{
+    return "subsystems=" + std::to_string(shape.numSubsystems) +
+           ",requirements=" + std::to_string(shape.requirementsPerCommand) +
+           (shape.withDefaultCommands ? "" : ",default_commands=none");
+}
+}  // namespace
+
+TAPROOT_BENCHMARK(CommandSchedulerRun)
+{
+    constexpr int TICKS = 10'000;
+
+    for (const GraphShape &shape : getGraphShapes())
+    {
+        tap::Drivers drivers;
+        SyntheticGraph graph(
+            &drivers,
+            shape.numSubsystems,
+            shape.requirementsPerCommand,
+            shape.withDefaultCommands);
+        graph.addAllCommands();
+
+        double ns = tap::benchmark::measureNanosecondsPerOp(TICKS, [&] {
+            for (int i = 0; i < TICKS; i++)
+            {
+                graph.scheduler.run();
+            }
+        });
+
+        reporter.report(
+            "CommandScheduler::run",
+            formatParams(shape),
+            TICKS,
+            ns);
+    }
+}
+
+TAPROOT_BENCHMARK(CommandSchedulerAddRemoveCommand)
+{
+    constexpr int ROUNDS = 1'000;
+
+    for (const GraphShape &shape : getGraphShapes())
+    {
+        tap::Drivers drivers;
+        SyntheticGraph graph(
+            &drivers,
+            shape.numSubsystems,
+            shape.requirementsPerCommand,
+            shape.withDefaultCommands);
+        const int64_t ops = static_cast<int64_t>(ROUNDS) * shape.numSubsystems;
+
+        // Every round adds all commands to an empty scheduler and then removes them all, the two
+        // halves are timed separately
+        std::chrono::steady_clock::duration addTime{0};
+        std::chrono::steady_clock::duration removeTime{0};
+        graph.addAllCommands();
+        graph.removeAllCommands();
+        for (int round = 0; round < ROUNDS; round++)
+        {
+            auto addStart = std::chrono::steady_clock::now();
+            graph.addAllCommands();
+            auto removeStart = std::chrono::steady_clock::now();
+            graph.removeAllCommands();
+            auto removeEnd = std::chrono::steady_clock::now();
+
+            addTime += removeStart - addStart;
+            removeTime += removeEnd - removeStart;
+        }
+
+        reporter.report(
+            "CommandScheduler::addCommand",
+            formatParams(shape),
+            ops,
+            std::chrono::duration<double, std::nano>(addTime).count() / ops);
+        reporter.report(
+            "CommandScheduler::removeCommand",
+            formatParams(shape),
+            ops,
+            std::chrono::duration<double, std::nano>(removeTime).count() / ops);
+    }
+}
+
+TAPROOT_BENCHMARK(CommandSchedulerIterators)
+{
+    constexpr int PASSES = 10'000;
+
+    for (const GraphShape &shape : getGraphShapes())
+    {
+        tap::Drivers drivers;
+        SyntheticGraph graph(
+            &drivers,
+            shape.numSubsystems,
+            shape.requirementsPerCommand,
+            shape.withDefaultCommands);
+        graph.addAllCommands();
+
+        const int numCommands = graph.scheduler.commandListSize();
+        const int64_t commandOps = static_cast<int64_t>(PASSES) * std::max(numCommands, 1);
+        const int64_t subsystemOps = static_cast<int64_t>(PASSES) * shape.numSubsystems;
+
+        double commandNs = tap::benchmark::measureNanosecondsPerOp(commandOps, [&] {
+            for (int i = 0; i < PASSES; i++)
+            {
+                for (auto it = graph.scheduler.cmdMapBegin(); it != graph.scheduler.cmdMapEnd();
+                     it++)
+                {
+                    tap::benchmark::doNotOptimize(*it);
+                }
+            }
+        });
+
+        double subsystemNs = tap::benchmark::measureNanosecondsPerOp(subsystemOps, [&] {
+            for (int i = 0; i < PASSES; i++)
+            {
+                for (auto it = graph.scheduler.subMapBegin(); it != graph.scheduler.subMapEnd();
+                     it++)
+                {
+                    tap::benchmark::doNotOptimize(*it);
+                }
+            }
+        });
+
+        reporter.report(
+            "CommandScheduler::CommandIterator",
+            formatParams(shape) + ",commands=" + std::to_string(numCommands),
+            commandOps,
+            commandNs);
+        reporter.report(
+            "CommandScheduler::SubsystemIterator",
+            formatParams(shape),
+            subsystemOps,
+            subsystemNs);
+    }
+}
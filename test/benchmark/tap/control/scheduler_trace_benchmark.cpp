@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2026 Advanced Robotics at the University of Washington <robomstr@uw.edu>
+ *
+ * This file is part of Taproot.
+ *
+ * Taproot is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Taproot is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Taproot.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "tap/control/command.hpp"
+#include "tap/control/command_scheduler.hpp"
+#include "tap/control/scheduler_trace.hpp"
+#include "tap/control/subsystem.hpp"
+#include "tap/drivers.hpp"
+
+#include "benchmark.hpp"
+
+using namespace tap::control;
+
+namespace
+{
+class TraceBenchmarkSubsystem : public Subsystem
+{
+public:
+    explicit TraceBenchmarkSubsystem(tap::Drivers *drivers) : Subsystem(drivers) {}
+    void refresh() override {}
+    void refreshSafeDisconnect() override {}
+    const char *getName() const override { return "trace benchmark subsystem"; }
+};
+
+class TraceBenchmarkCommand : public Command
+{
+public:
+    void initialize() override {}
+    void execute() override {}
+    void end(bool) override {}
+    bool isFinished() const override { return finished; }
+    const char *getName() const override { return "trace benchmark command"; }
+
+    bool finished = false;
+};
+}  // namespace
+
+TAPROOT_BENCHMARK(SchedulerTraceRecord)
+{
+    constexpr int EVENTS = 1'000'000;
+    StaticSchedulerTrace<1024> trace;
+
+    double ns = tap::benchmark::measureNanosecondsPerOp(EVENTS, [&] {
+        for (int i = 0; i < EVENTS; i++)
+        {
+            trace.record(i, SchedulerTraceEventType::COMMAND_ADDED, i & 0xff, 0);
+        }
+    });
+
+    reporter.report("SchedulerTrace::record", "capacity=1024", EVENTS, ns);
+}
+
+TAPROOT_BENCHMARK(CommandSchedulerRunWithTrace)
+{
+    constexpr int NUM_SUBSYSTEMS = 30;
+    constexpr int TICKS = 10'000;
+
+    tap::Drivers drivers;
+    std::vector<std::unique_ptr<TraceBenchmarkSubsystem>> subsystems;
+    std::vector<std::unique_ptr<TraceBenchmarkCommand>> commands;
+    for (int i = 0; i < NUM_SUBSYSTEMS; i++)
+    {
+        subsystems.emplace_back(std::make_unique<TraceBenchmarkSubsystem>(&drivers));
+        commands.emplace_back(std::make_unique<TraceBenchmarkCommand>());
+        commands.back()->addSubsystemRequirement(subsystems.back().get());
+    }
+
+    StaticSchedulerTrace<1024> trace;
+    CommandScheduler scheduler(&drivers, true);
+    scheduler.setTrace(&trace);
+    for (auto &subsystem : subsystems)
+    {
+        scheduler.registerSubsystem(subsystem.get());
+    }
+
+    // Every tick adds a command that finishes during the tick, so each tick records several events
+    double ns = tap::benchmark::measureNanosecondsPerOp(TICKS, [&] {
+        for (int i = 0; i < TICKS; i++)
+        {
+            TraceBenchmarkCommand *command = commands[i % NUM_SUBSYSTEMS].get();
+            command->finished = false;
+            scheduler.addCommand(command);
+            command->finished = true;
+            scheduler.run();
+        }
+    });
+
+    reporter.report(
+        "CommandScheduler::run with trace",
+        "subsystems=" + std::to_string(NUM_SUBSYSTEMS),
+        TICKS,
+        ns);
+}
@@ -0,0 +1,229 @@
+/*
+ * Copyright (c) 2026 Advanced Robotics at the University of Washington <robomstr@uw.edu>
+ *
+ * This file is part of Taproot.
+ *
+ * Taproot is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Taproot is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Taproot.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "tap/drivers.hpp"
+#include "tap/errors/create_errors.hpp"
+#include "tap/motor/dji_motor.hpp"
+#include "tap/motor/dji_motor_tx_handler.hpp"
+
+#include "benchmark.hpp"
+
+using namespace tap::motor;
+using testing::Return;
+
+namespace
+{
+/**
+ * Constructs `numMotors` motors, filling CAN1 first. On each bus the first 4 motors share the low
+ * frame and the last 2 are 6020s in current control, so 8 motors on a bus fill all 3 frames.
+ */
+std::vector<std::unique_ptr<DjiMotor>> makeMotors(tap::Drivers *drivers, int numMotors)
+{
+    std::vector<std::unique_ptr<DjiMotor>> motors;
+    for (int i = 0; i < numMotors; i++)
+    {
+        int index = i % DjiMotorTxHandler::DJI_MOTORS_PER_CAN;
+        motors.emplace_back(std::make_unique<DjiMotor>(
+            drivers,
+            NORMALIZED_ID_TO_DJI_MOTOR(index),
+            i < DjiMotorTxHandler::DJI_MOTORS_PER_CAN ? tap::can::CanBus::CAN_BUS1
+                                                      : tap::can::CanBus::CAN_BUS2,
+            false,
+            "benchmark motor",
+            index >= DjiMotorTxHandler::DJI_MOTORS_PER_CAN - 2));
+    }
+    return motors;
+}
+
+/**
+ * Drops control messages instead of queueing them, to time only the handler's own work.
+ */
+class NoQueueDjiMotorTxHandler : public DjiMotorTxHandler
+{
+public:
+    using DjiMotorTxHandler::DjiMotorTxHandler;
+
+protected:
+    bool queueControlMessage(tap::can::CanBus, const modm::can::Message &message) override
+    {
+        tap::benchmark::doNotOptimize(message);
+        return true;
+    }
+};
+
+/**
+ * Reference for the planned messages: builds and fills all 6 control messages from the motor
+ * stores on every call, the way `encodeAndSendCanData` worked before messages were planned when
+ * motors are added. Queues messages through `Base::queueControlMessage`.
+ */
+template <typename Base>
+class PerTickDjiMotorTxHandler : public Base
+{
+public:
+    using Base::Base;
+
+    void encodeAndSendCanData() override
+    {
+        modm::can::Message messages[DjiMotorTxHandler::MAX_CONTROL_MESSAGES];
+        bool valid[DjiMotorTxHandler::MAX_CONTROL_MESSAGES] = {};
+
+        // In the order low, high, 6020 current, CAN1 before CAN2
+        for (int bus = 0; bus < 2; bus++)
+        {
+            messages[3 * bus] = makeMessage(DjiMotorTxHandler::CAN_DJI_LOW_IDENTIFIER);
+            messages[3 * bus + 1] = makeMessage(DjiMotorTxHandler::CAN_DJI_HIGH_IDENTIFIER);
+            messages[3 * bus + 2] =
+                makeMessage(DjiMotorTxHandler::CAN_DJI_6020_CURRENT_IDENTIFIER);
+            serializeMotorStoreSendData(
+                bus == 0 ? this->can1MotorStore : this->can2MotorStore,
+                &messages[3 * bus],
+                &valid[3 * bus]);
+        }
+
+        bool messageSuccess = true;
+        for (int i = 0; i < DjiMotorTxHandler::MAX_CONTROL_MESSAGES; i++)
+        {
+            if (valid[i])
+            {
+                messageSuccess &= this->queueControlMessage(
+                    i < 3 ? tap::can::CanBus::CAN_BUS1 : tap::can::CanBus::CAN_BUS2,
+                    messages[i]);
+            }
+        }
+
+        if (!messageSuccess)
+        {
+            RAISE_ERROR(this->drivers, "can tx queue full");
+        }
+    }
+
+private:
+    static modm::can::Message makeMessage(uint32_t identifier)
+    {
+        return modm::can::Message(
+            identifier,
+            DjiMotorTxHandler::CAN_DJI_MESSAGE_SEND_LENGTH,
+            0,
+            false);
+    }
+
+    /// Serializes every motor in `canMotorStore` into the bus's low, high or 6020 message.
+    static void serializeMotorStoreSendData(
+        DjiMotor *const *canMotorStore,
+        modm::can::Message *busMessages,
+        bool *busValid)
+    {
+        for (int i = 0; i < DjiMotorTxHandler::DJI_MOTORS_PER_CAN; i++)
+        {
+            const DjiMotor *const motor = canMotorStore[i];
+            if (motor == nullptr)
+            {
+                continue;
+            }
+
+            int message;
+            if (DJI_MOTOR_TO_NORMALIZED_ID(motor->getMotorIdentifier()) <=
+                DJI_MOTOR_TO_NORMALIZED_ID(tap::motor::MOTOR4))
+            {
+                message = 0;
+            }
+            else if (motor->isInCurrentControl())
+            {
+                message = 2;
+            }
+            else
+            {
+                message = 1;
+            }
+            motor->serializeCanSendData(&busMessages[message]);
+            busValid[message] = true;
+        }
+    }
+};
+
+template <typename Handler>
+double measureEncodeAndSend(tap::Drivers *drivers, int numMotors, int ticks)
+{
+    Handler handler(drivers);
+    std::vector<std::unique_ptr<DjiMotor>> motors = makeMotors(drivers, numMotors);
+    for (auto &motor : motors)
+    {
+        handler.addMotorToManager(motor.get());
+    }
+
+    return tap::benchmark::measureNanosecondsPerOp(ticks, [&] {
+        for (int i = 0; i < ticks; i++)
+        {
+            motors[i % numMotors]->setDesiredOutput(i);
+            handler.encodeAndSendCanData();
+        }
+    });
+}
+}  // namespace
+
+TAPROOT_BENCHMARK(DjiMotorTxHandlerEncodeAndSend)
+{
+    constexpr int TICKS = 10'000;
+
+    for (int numMotors : {1, 4, 8, 16})
+    {
+        tap::Drivers drivers;
+        // Every frame is sent right away, so the queue does not fill up between ticks
+        ON_CALL(drivers.can, isReadyToSend).WillByDefault(Return(true));
+        ON_CALL(drivers.can, sendMessage).WillByDefault(Return(true));
+
+        double ns = measureEncodeAndSend<DjiMotorTxHandler>(&drivers, numMotors, TICKS);
+        reporter.report(
+            "DjiMotorTxHandler::encodeAndSendCanData",
+            "motors=" + std::to_string(numMotors),
+            TICKS,
+            ns);
+
+        ns = measureEncodeAndSend<NoQueueDjiMotorTxHandler>(&drivers, numMotors, TICKS);
+        reporter.report(
+            "DjiMotorTxHandler::encodeAndSendCanData without queueing",
+            "motors=" + std::to_string(numMotors),
+            TICKS,
+            ns);
+
+        ns = measureEncodeAndSend<PerTickDjiMotorTxHandler<DjiMotorTxHandler>>(
+            &drivers,
+            numMotors,
+            TICKS);
+        reporter.report(
+            "DjiMotorTxHandler::encodeAndSendCanData per-tick reference",
+            "motors=" + std::to_string(numMotors),
+            TICKS,
+            ns);
+
+        ns = measureEncodeAndSend<PerTickDjiMotorTxHandler<NoQueueDjiMotorTxHandler>>(
+            &drivers,
+            numMotors,
+            TICKS);
+        reporter.report(
+            "DjiMotorTxHandler::encodeAndSendCanData per-tick reference without queueing",
+            "motors=" + std::to_string(numMotors),
+            TICKS,
+            ns);
+    }
+}
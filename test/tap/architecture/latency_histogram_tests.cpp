@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2026 Advanced Robotics at the University of Washington <robomstr@uw.edu>
+ *
+ * This file is part of Taproot.
+ *
+ * Taproot is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Taproot is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Taproot.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "tap/architecture/latency_histogram.hpp"
+
+using tap::arch::LatencyHistogram;
+
+using Histogram = LatencyHistogram<20>;
+
+TEST(LatencyHistogram, getBucket_power_of_two_boundaries)
+{
+    EXPECT_EQ(0, Histogram::getBucket(0));
+    EXPECT_EQ(1, Histogram::getBucket(1));
+    EXPECT_EQ(2, Histogram::getBucket(2));
+    EXPECT_EQ(2, Histogram::getBucket(3));
+    EXPECT_EQ(3, Histogram::getBucket(4));
+    EXPECT_EQ(10, Histogram::getBucket(1023));
+    EXPECT_EQ(11, Histogram::getBucket(1024));
+    EXPECT_EQ(19, Histogram::getBucket(1 << 18));
+    EXPECT_EQ(19, Histogram::getBucket(UINT32_MAX));
+
+    for (std::size_t bucket = 0; bucket < 20; bucket++)
+    {
+        EXPECT_EQ(bucket, Histogram::getBucket(Histogram::getBucketLowerBound(bucket)));
+    }
+}
+
+TEST(LatencyHistogram, add_counts_in_buckets)
+{
+    Histogram histogram;
+
+    histogram.add(5);
+    histogram.add(6);
+    histogram.add(100);
+
+    EXPECT_EQ(3, histogram.getCount());
+    EXPECT_EQ(2, histogram.getBucketCount(3));
+    EXPECT_EQ(1, histogram.getBucketCount(7));
+    EXPECT_EQ(0, histogram.getBucketCount(20));
+}
+
+TEST(LatencyHistogram, getPercentile_empty_returns_zero)
+{
+    Histogram histogram;
+
+    EXPECT_EQ(0, histogram.getPercentile(0.5f));
+}
+
+TEST(LatencyHistogram, getPercentile_finds_rare_spikes)
+{
+    Histogram histogram;
+
+    for (int i = 0; i < 985; i++)
+    {
+        histogram.add(10);
+    }
+    for (int i = 0; i < 14; i++)
+    {
+        histogram.add(100);
+    }
+    histogram.add(700);
+
+    uint32_t p50 = histogram.getPercentile(0.5f);
+    EXPECT_GE(p50, 8);
+    EXPECT_LT(p50, 16);
+
+    uint32_t p99 = histogram.getPercentile(0.99f);
+    EXPECT_GE(p99, 64);
+    EXPECT_LT(p99, 128);
+
+    uint32_t p100 = histogram.getPercentile(1.0f);
+    EXPECT_GE(p100, 512);
+    EXPECT_LT(p100, 1024);
+}
+
+TEST(LatencyHistogram, getPercentile_within_factor_of_two)
+{
+    for (uint32_t duration : {1u, 3u, 17u, 250u, 4096u, 100'000u})
+    {
+        Histogram histogram;
+        histogram.add(duration);
+
+        uint32_t estimate = histogram.getPercentile(0.5f);
+        EXPECT_LE(estimate, 2 * duration) << duration;
+        EXPECT_GE(2 * estimate, duration) << duration;
+    }
+}
+
+TEST(LatencyHistogram, getPercentile_last_bucket_returns_lower_bound)
+{
+    Histogram histogram;
+
+    histogram.add(UINT32_MAX);
+
+    EXPECT_EQ(Histogram::getBucketLowerBound(19), histogram.getPercentile(0.5f));
+}
+
+TEST(LatencyHistogram, reset_clears_counts)
+{
+    Histogram histogram;
+    histogram.add(10);
+
+    histogram.reset();
+
+    EXPECT_EQ(0, histogram.getCount());
+    EXPECT_EQ(0, histogram.getBucketCount(4));
+    EXPECT_EQ(0, histogram.getPercentile(0.5f));
+}
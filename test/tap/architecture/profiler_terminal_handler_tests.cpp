@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2026 Advanced Robotics at the University of Washington <robomstr@uw.edu>
+ *
+ * This file is part of Taproot.
+ *
+ * Taproot is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Taproot is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Taproot.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "tap/architecture/clock.hpp"
+#include "tap/architecture/profiler_terminal_handler.hpp"
+#include "tap/drivers.hpp"
+#include "tap/stub/terminal_device_stub.hpp"
+
+using namespace tap;
+using namespace testing;
+using namespace tap::arch;
+
+class ProfilerTerminalHandlerTest : public Test
+{
+protected:
+    ProfilerTerminalHandlerTest()
+        : serialHandler(&drivers),
+          terminalDevice(&drivers),
+          stream(terminalDevice)
+    {
+    }
+
+    clock::ClockStub clock;
+    Drivers drivers;
+    ProfilerTerminalHandler serialHandler;
+    tap::stub::TerminalDeviceStub terminalDevice;
+    modm::IOStream stream;
+};
+
+TEST_F(ProfilerTerminalHandlerTest, init__adds_to_terminal_handler)
+{
+    EXPECT_CALL(drivers.terminalSerial, addHeader(_, &serialHandler));
+
+    serialHandler.init();
+}
+
+TEST_F(ProfilerTerminalHandlerTest, terminalSerialCallback__prints_usage_if_invalid_input)
+{
+    char input[] = "sdsdf";
+    EXPECT_FALSE(serialHandler.terminalSerialCallback(input, stream, false));
+
+    EXPECT_THAT(terminalDevice.readAllItemsFromWriteBufferToString(), HasSubstr("Usage"));
+}
+
+TEST_F(ProfilerTerminalHandlerTest, terminalSerialCallback__prints_usage_if_help_specified)
+{
+    char input[] = "-H";
+    EXPECT_TRUE(serialHandler.terminalSerialCallback(input, stream, false));
+
+    EXPECT_THAT(terminalDevice.readAllItemsFromWriteBufferToString(), HasSubstr("Usage"));
+}
+
+TEST_F(ProfilerTerminalHandlerTest, terminalSerialCallback__stats_prints_every_profile)
+{
+    clock.time = 1;
+    std::size_t key = drivers.profiler.push("foo");
+    clock.time = 3;
+    drivers.profiler.pop(key);
+    drivers.profiler.registerProfile("bar");
+
+    char input[] = "stats";
+    EXPECT_TRUE(serialHandler.terminalSerialCallback(input, stream, false));
+
+    std::string output = terminalDevice.readAllItemsFromWriteBufferToString();
+    EXPECT_THAT(output, HasSubstr(" foo\t2000\t2000\t"));
+    EXPECT_THAT(output, HasSubstr(" bar\t-\t-\t-"));
+}
+
+TEST_F(ProfilerTerminalHandlerTest, terminalSerialCallback__trace_start_and_stop_toggle_recording)
+{
+    char start[] = "trace start";
+    EXPECT_TRUE(serialHandler.terminalSerialCallback(start, stream, false));
+    EXPECT_TRUE(drivers.profiler.getTrace().isEnabled());
+
+    char stop[] = "trace stop";
+    EXPECT_TRUE(serialHandler.terminalSerialCallback(stop, stream, false));
+    EXPECT_FALSE(drivers.profiler.getTrace().isEnabled());
+}
+
+TEST_F(ProfilerTerminalHandlerTest, terminalSerialCallback__trace_dump_prints_names_and_events)
+{
+    char start[] = "trace start";
+    serialHandler.terminalSerialCallback(start, stream, false);
+    clock.time = 1;
+    std::size_t key = drivers.profiler.push("foo");
+    clock.time = 3;
+    drivers.profiler.pop(key);
+    terminalDevice.readAllItemsFromWriteBufferToString();
+
+    char dump[] = "trace dump";
+    EXPECT_TRUE(serialHandler.terminalSerialCallback(dump, stream, false));
+
+    EXPECT_FALSE(drivers.profiler.getTrace().isEnabled());
+    EXPECT_EQ(
+        "profiler trace begin\n"
+        "frequency 1000000\n"
+        "name 0 foo\n"
+        "event 1000 B 0 0\n"
+        "event 3000 E 0 0\n"
+        "profiler trace end 0\n",
+        terminalDevice.readAllItemsFromWriteBufferToString());
+}
+
+TEST_F(ProfilerTerminalHandlerTest, terminalSerialCallback__trace_without_subcommand_prints_usage)
+{
+    char input[] = "trace";
+    EXPECT_FALSE(serialHandler.terminalSerialCallback(input, stream, false));
+
+    EXPECT_THAT(terminalDevice.readAllItemsFromWriteBufferToString(), HasSubstr("Usage"));
+}
@@ -90,6 +90,23 @@ TEST_F(ProfilerTest, getData_with_time_btwn_push_pop_populates_min_max_avg)
     EXPECT_EQ(algorithms::lowPassFilter(0, 12'000, Profiler::AVG_LOW_PASS_ALPHA), data.avg);
 }
 
+TEST_F(ProfilerTest, getData_measures_sub_microsecond_durations_with_timebase)
+{
+    timebase::TimebaseStub timebaseStub;
+    timebaseStub.ticksPerSecond = 180'000'000;
+
+    timebaseStub.ticks = 1'000;
+    std::size_t key = profiler.push("hi");
+    timebaseStub.ticks = 1'090;  // 0.5 us
+    profiler.pop(key);
+
+    Profiler::ProfilerData data = profiler.getData(key);
+
+    EXPECT_EQ(0, data.min);
+    EXPECT_EQ(0, data.max);
+    EXPECT_FLOAT_EQ(algorithms::lowPassFilter(0, 0.5f, Profiler::AVG_LOW_PASS_ALPHA), data.avg);
+}
+
 TEST_F(ProfilerTest, getData_multiple_push_pops_chooses_correct_min_max)
 {
     const char* hi = "hi";
@@ -128,14 +145,303 @@ TEST_F(ProfilerTest, push_big_batch_insertion)
     profiler.push("hi");
 }
 
+TEST_F(ProfilerTest, push_with_cached_key_sets_key_on_first_push)
+{
+    const char* hi = "hi";
+    std::size_t cachedKey = Profiler::NO_KEY;
+
+    profiler.push("other");
+    std::size_t key = profiler.push(hi, cachedKey);
+
+    EXPECT_EQ(1, key);
+    EXPECT_EQ(1, cachedKey);
+    EXPECT_EQ(key, profiler.push(hi, cachedKey));
+    EXPECT_EQ(key, profiler.push(hi));
+}
+
+TEST_F(ProfilerTest, push_with_cached_key_of_other_profile_finds_correct_key)
+{
+    const char* hi = "hi";
+    std::size_t cachedKey = profiler.push("other");
+
+    profiler.push(hi, cachedKey);
+
+    EXPECT_EQ(1, cachedKey);
+    EXPECT_EQ(hi, profiler.getData(cachedKey).name);
+}
+
+TEST_F(ProfilerTest, push_with_cached_key_from_other_profiler_finds_correct_key)
+{
+    const char* hi = "hi";
+    std::size_t cachedKey = Profiler::NO_KEY;
+    Profiler other(&drivers);
+    other.push("other");
+    other.push(hi, cachedKey);
+
+    std::size_t key = profiler.push(hi, cachedKey);
+    clock.time = 2;
+    profiler.pop(key);
+
+    EXPECT_EQ(0, key);
+    EXPECT_EQ(2000, profiler.getData(key).max);
+}
+
+TEST_F(ProfilerTest, push_with_cached_key_timing_matches_push)
+{
+    const char* hi = "hi";
+    std::size_t cachedKey = Profiler::NO_KEY;
+
+    for (int i = 0; i < 3; i++)
+    {
+        std::size_t key = profiler.push(hi, cachedKey);
+        clock.time += i + 1;
+        profiler.pop(key);
+    }
+
+    Profiler::ProfilerData data = profiler.getData(cachedKey);
+    EXPECT_EQ(1000, data.min);
+    EXPECT_EQ(3000, data.max);
+}
+
+#ifdef TAPROOT_PROFILER_HIERARCHY
+TEST_F(ProfilerTest, call_tree_empty_when_hierarchical_profiling_disabled)
+{
+    profiler.pop(profiler.push("hi"));
+
+    EXPECT_FALSE(profiler.isHierarchicalProfilingEnabled());
+    EXPECT_EQ(0, profiler.getNodeCount());
+    EXPECT_EQ(Profiler::NO_NODE, profiler.getFirstRootNode());
+}
+
+TEST_F(ProfilerTest, hierarchical_nested_profiles_have_inclusive_and_self_time)
+{
+    profiler.setHierarchicalProfilingEnabled(true);
+
+    std::size_t outer = profiler.push("outer");
+    clock.time = 1;
+    std::size_t inner = profiler.push("inner");
+    clock.time = 3;
+    profiler.pop(inner);
+    clock.time = 6;
+    profiler.pop(outer);
+
+    ASSERT_EQ(2, profiler.getNodeCount());
+
+    const Profiler::ProfilerNode* outerNode = profiler.getNode(profiler.getFirstRootNode());
+    ASSERT_NE(nullptr, outerNode);
+    EXPECT_EQ(outer, outerNode->key);
+    EXPECT_EQ(Profiler::NO_NODE, outerNode->parent);
+    EXPECT_EQ(1, outerNode->callCount);
+    EXPECT_EQ(6'000, outerNode->inclusiveTime);
+    EXPECT_EQ(4'000, outerNode->selfTime);
+
+    const Profiler::ProfilerNode* innerNode = profiler.getNode(outerNode->firstChild);
+    ASSERT_NE(nullptr, innerNode);
+    EXPECT_EQ(inner, innerNode->key);
+    EXPECT_EQ(profiler.getFirstRootNode(), innerNode->parent);
+    EXPECT_EQ(1, innerNode->callCount);
+    EXPECT_EQ(2'000, innerNode->inclusiveTime);
+    EXPECT_EQ(2'000, innerNode->selfTime);
+
+    EXPECT_EQ(6'000, profiler.getData(outer).max);
+    EXPECT_EQ(2'000, profiler.getData(inner).max);
+}
+
+TEST_F(ProfilerTest, hierarchical_same_profile_under_different_parents_has_separate_nodes)
+{
+    profiler.setHierarchicalProfilingEnabled(true);
+
+    for (const char* parent : {"a", "b", "a"})
+    {
+        std::size_t parentKey = profiler.push(parent);
+        std::size_t child = profiler.push("child");
+        clock.time += 1;
+        profiler.pop(child);
+        profiler.pop(parentKey);
+    }
+
+    ASSERT_EQ(4, profiler.getNodeCount());
+
+    const Profiler::ProfilerNode* a = profiler.getNode(profiler.getFirstRootNode());
+    const Profiler::ProfilerNode* b = profiler.getNode(a->nextSibling);
+    ASSERT_NE(nullptr, b);
+    EXPECT_EQ(Profiler::NO_NODE, b->nextSibling);
+
+    EXPECT_EQ(2, a->callCount);
+    EXPECT_EQ(2, profiler.getNode(a->firstChild)->callCount);
+    EXPECT_EQ(2'000, profiler.getNode(a->firstChild)->inclusiveTime);
+    EXPECT_EQ(1, b->callCount);
+    EXPECT_EQ(1, profiler.getNode(b->firstChild)->callCount);
+    EXPECT_NE(a->firstChild, b->firstChild);
+}
+
+static void recurse(Profiler& profiler, clock::ClockStub& clock, int depth)
+{
+    std::size_t key = profiler.push("recurse");
+    clock.time += 1;
+    if (depth > 0)
+    {
+        recurse(profiler, clock, depth - 1);
+    }
+    profiler.pop(key);
+}
+
+TEST_F(ProfilerTest, hierarchical_recursion_counted_once_in_inclusive_time)
+{
+    profiler.setHierarchicalProfilingEnabled(true);
+
+    recurse(profiler, clock, 3);
+
+    ASSERT_EQ(1, profiler.getNodeCount());
+    const Profiler::ProfilerNode* node = profiler.getNode(0);
+    EXPECT_EQ(4, node->callCount);
+    EXPECT_EQ(4'000, node->inclusiveTime);
+    EXPECT_EQ(4'000, node->selfTime);
+
+    // Each call is timed from its own push
+    Profiler::ProfilerData data = profiler.getData(0);
+    EXPECT_EQ(1'000, data.min);
+    EXPECT_EQ(4'000, data.max);
+}
+
+TEST_F(ProfilerTest, hierarchical_indirect_recursion_self_times_add_up)
+{
+    profiler.setHierarchicalProfilingEnabled(true);
+
+    std::size_t a = profiler.push("a");
+    clock.time = 1;
+    std::size_t b = profiler.push("b");
+    clock.time = 2;
+    std::size_t innerA = profiler.push("a");
+    clock.time = 4;
+    profiler.pop(innerA);
+    clock.time = 7;
+    profiler.pop(b);
+    clock.time = 11;
+    profiler.pop(a);
+
+    ASSERT_EQ(2, profiler.getNodeCount());
+    const Profiler::ProfilerNode* aNode = profiler.getNode(0);
+    const Profiler::ProfilerNode* bNode = profiler.getNode(1);
+
+    EXPECT_EQ(2, aNode->callCount);
+    EXPECT_EQ(11'000, aNode->inclusiveTime);
+    EXPECT_EQ(1'000 + 4'000 + 2'000, aNode->selfTime);
+    EXPECT_EQ(6'000, bNode->inclusiveTime);
+    EXPECT_EQ(4'000, bNode->selfTime);
+    EXPECT_EQ(11'000, aNode->selfTime + bNode->selfTime);
+}
+
+TEST_F(ProfilerTest, hierarchical_pop_out_of_order_errors)
+{
+    EXPECT_CALL(drivers.errorController, addToErrorList).Times(1);
+    profiler.setHierarchicalProfilingEnabled(true);
+
+    std::size_t a = profiler.push("a");
+    profiler.push("b");
+    profiler.pop(a);
+}
+
+TEST_F(ProfilerTest, hierarchical_profiles_deeper_than_max_stack_depth_only_update_flat_data)
+{
+    EXPECT_CALL(drivers.errorController, addToErrorList).Times(0);
+    profiler.setHierarchicalProfilingEnabled(true);
+
+    constexpr std::size_t DEPTH = Profiler::MAX_STACK_DEPTH + 2;
+    std::string names[DEPTH];
+    std::size_t keys[DEPTH];
+    for (std::size_t i = 0; i < DEPTH; i++)
+    {
+        names[i] = std::to_string(i);
+        keys[i] = profiler.push(names[i].c_str());
+        clock.time += 1;
+    }
+    for (std::size_t i = DEPTH; i > 0; i--)
+    {
+        profiler.pop(keys[i - 1]);
+    }
+
+    EXPECT_EQ(Profiler::MAX_STACK_DEPTH, profiler.getNodeCount());
+    EXPECT_EQ(1'000, profiler.getData(keys[DEPTH - 1]).max);
+    EXPECT_EQ(DEPTH * 1'000, profiler.getNode(0)->inclusiveTime);
+}
+#endif
+
+TEST_F(ProfilerTest, getPercentiles_reports_spikes)
+{
+    std::size_t key = 0;
+    for (int i = 0; i < 1000; i++)
+    {
+        key = profiler.push("hi");
+        clock.time += (i % 100 == 0) ? 50 : 1;
+        profiler.pop(key);
+    }
+
+    Profiler::LatencyPercentiles percentiles = profiler.getPercentiles(key);
+
+    EXPECT_GE(percentiles.p50, 512);
+    EXPECT_LT(percentiles.p50, 1024 * 2);
+    EXPECT_GE(percentiles.p999, 32'768);
+    EXPECT_LT(percentiles.p999, 65'536);
+    EXPECT_LE(percentiles.p90, percentiles.p99);
+}
+
+TEST_F(ProfilerTest, getPercentiles_invalid_key_returns_zeros)
+{
+    Profiler::LatencyPercentiles percentiles = profiler.getPercentiles(3);
+
+    EXPECT_EQ(0, percentiles.p50);
+    EXPECT_EQ(0, percentiles.p999);
+}
+
+TEST_F(ProfilerTest, histogram_window_clears_old_samples)
+{
+    profiler.setHistogramWindow(10);
+
+    std::size_t key = profiler.push("hi");
+    clock.time += 50;
+    profiler.pop(key);
+    for (int i = 0; i < 9; i++)
+    {
+        key = profiler.push("hi");
+        clock.time += 1;
+        profiler.pop(key);
+    }
+
+    EXPECT_EQ(10, profiler.getData(key).histogram.getCount());
+    EXPECT_GE(profiler.getPercentiles(key).p999, 32'768);
+
+    key = profiler.push("hi");
+    clock.time += 1;
+    profiler.pop(key);
+
+    EXPECT_EQ(1, profiler.getData(key).histogram.getCount());
+    EXPECT_LT(profiler.getPercentiles(key).p999, 2'048);
+    // min and max are not windowed
+    EXPECT_EQ(50'000, profiler.getData(key).max);
+}
+
+TEST_F(ProfilerTest, reset_clears_histogram)
+{
+    std::size_t key = profiler.push("hi");
+    clock.time = 1;
+    profiler.pop(key);
+
+    profiler.reset(key);
+
+    EXPECT_EQ(0, profiler.getData(key).histogram.getCount());
+    EXPECT_EQ(0, profiler.getPercentiles(key).p50);
+}
+
 // redeclare profile macro s.t. we can test it even if profiling is turned off
 #undef PROFILE
-#define PROFILE(profiler, func, params) \
-    do                                  \
-    {                                   \
-        int key = profiler.push(#func); \
-        func params;                    \
-        profiler.pop(key);              \
+#define PROFILE(profiler, func, params)                                      \
+    do                                                                       \
+    {                                                                        \
+        static std::size_t profileCallSiteKey = tap::arch::Profiler::NO_KEY; \
+        std::size_t key = profiler.push(#func, profileCallSiteKey);          \
+        func params;                                                         \
+        profiler.pop(key);                                                   \
     } while (0);
 
 void testFunc(clock::ClockStub& clock) { clock.time += 1; }
@@ -154,3 +460,14 @@ TEST_F(ProfilerTest, profile_macro)
     EXPECT_EQ(1000, data.min);
     EXPECT_EQ(1000, data.max);
 }
+
+TEST_F(ProfilerTest, profile_macro_call_site_reused_across_calls)
+{
+    for (int i = 0; i < 3; i++)
+    {
+        PROFILE(profiler, testFunc, (clock));
+    }
+
+    EXPECT_EQ(1000, profiler.getData(0).max);
+    EXPECT_EQ(nullptr, profiler.getData(1).name);
+}
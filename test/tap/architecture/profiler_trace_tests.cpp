@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2026 Advanced Robotics at the University of Washington <robomstr@uw.edu>
+ *
+ * This file is part of Taproot.
+ *
+ * Taproot is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Taproot is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Taproot.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "tap/architecture/clock.hpp"
+#include "tap/architecture/profiler.hpp"
+#include "tap/drivers.hpp"
+
+using namespace tap;
+using namespace testing;
+using namespace tap::arch;
+
+TEST(ProfilerTrace, disabled_by_default_and_records_nothing)
+{
+    ProfilerTrace trace;
+
+    EXPECT_FALSE(trace.isEnabled());
+    trace.record(1, 0, ProfilerTraceEventType::BEGIN);
+
+    EXPECT_EQ(0u, trace.size());
+    EXPECT_EQ(0u, trace.getTotalRecorded());
+}
+
+TEST(ProfilerTrace, record_stores_events_oldest_first)
+{
+    ProfilerTrace trace;
+    trace.setEnabled(true);
+
+    trace.record(10, 3, ProfilerTraceEventType::BEGIN);
+    trace.record(25, 3, ProfilerTraceEventType::END);
+
+    ASSERT_EQ(2u, trace.size());
+    EXPECT_EQ(10u, trace.getEvent(0).timestamp);
+    EXPECT_EQ(3, trace.getEvent(0).key);
+    EXPECT_EQ(ProfilerTraceEventType::BEGIN, trace.getEvent(0).type);
+    EXPECT_EQ(0, trace.getEvent(0).context);
+    EXPECT_EQ(25u, trace.getEvent(1).timestamp);
+    EXPECT_EQ(ProfilerTraceEventType::END, trace.getEvent(1).type);
+}
+
+TEST(ProfilerTrace, full_trace_overwrites_oldest_events)
+{
+    ProfilerTrace trace;
+    trace.setEnabled(true);
+
+    for (uint32_t i = 0; i < ProfilerTrace::CAPACITY + 5; i++)
+    {
+        trace.record(i, 0, ProfilerTraceEventType::BEGIN);
+    }
+
+    EXPECT_EQ(ProfilerTrace::CAPACITY, trace.size());
+    EXPECT_EQ(ProfilerTrace::CAPACITY + 5, trace.getTotalRecorded());
+    EXPECT_EQ(5u, trace.getEvent(0).timestamp);
+    EXPECT_EQ(ProfilerTrace::CAPACITY + 4, trace.getEvent(ProfilerTrace::CAPACITY - 1).timestamp);
+}
+
+TEST(ProfilerTrace, clear_removes_events)
+{
+    ProfilerTrace trace;
+    trace.setEnabled(true);
+    trace.record(1, 0, ProfilerTraceEventType::BEGIN);
+
+    trace.clear();
+
+    EXPECT_EQ(0u, trace.size());
+    trace.record(2, 0, ProfilerTraceEventType::BEGIN);
+    EXPECT_EQ(2u, trace.getEvent(0).timestamp);
+}
+
+class ProfilerTraceTest : public Test
+{
+protected:
+    ProfilerTraceTest() : profiler(&drivers) {}
+
+    clock::ClockStub clock;
+    Drivers drivers;
+    Profiler profiler;
+};
+
+TEST_F(ProfilerTraceTest, push_and_pop_record_begin_and_end)
+{
+    profiler.getTrace().setEnabled(true);
+
+    clock.time = 1;
+    std::size_t outer = profiler.push("outer");
+    clock.time = 2;
+    std::size_t inner = profiler.push("inner");
+    clock.time = 4;
+    profiler.pop(inner);
+    clock.time = 7;
+    profiler.pop(outer);
+
+    const ProfilerTrace& trace = profiler.getTrace();
+    ASSERT_EQ(4u, trace.size());
+    EXPECT_EQ(1'000u, trace.getEvent(0).timestamp);
+    EXPECT_EQ(outer, trace.getEvent(0).key);
+    EXPECT_EQ(ProfilerTraceEventType::BEGIN, trace.getEvent(0).type);
+    EXPECT_EQ(inner, trace.getEvent(1).key);
+    EXPECT_EQ(ProfilerTraceEventType::BEGIN, trace.getEvent(1).type);
+    EXPECT_EQ(4'000u, trace.getEvent(2).timestamp);
+    EXPECT_EQ(inner, trace.getEvent(2).key);
+    EXPECT_EQ(ProfilerTraceEventType::END, trace.getEvent(2).type);
+    EXPECT_EQ(7'000u, trace.getEvent(3).timestamp);
+    EXPECT_EQ(outer, trace.getEvent(3).key);
+    EXPECT_EQ(ProfilerTraceEventType::END, trace.getEvent(3).type);
+}
+
+TEST_F(ProfilerTraceTest, push_and_pop_record_nothing_while_disabled)
+{
+    profiler.pop(profiler.push("hi"));
+
+    EXPECT_EQ(0u, profiler.getTrace().size());
+}
+
+TEST_F(ProfilerTraceTest, traceBegin_and_traceEnd_record_without_updating_data)
+{
+    std::size_t key = profiler.registerProfile("isr");
+    profiler.getTrace().setEnabled(true);
+
+    clock.time = 3;
+    profiler.traceBegin(key);
+    clock.time = 5;
+    profiler.traceEnd(key);
+
+    const ProfilerTrace& trace = profiler.getTrace();
+    ASSERT_EQ(2u, trace.size());
+    EXPECT_EQ(3'000u, trace.getEvent(0).timestamp);
+    EXPECT_EQ(ProfilerTraceEventType::BEGIN, trace.getEvent(0).type);
+    EXPECT_EQ(5'000u, trace.getEvent(1).timestamp);
+    EXPECT_EQ(ProfilerTraceEventType::END, trace.getEvent(1).type);
+    EXPECT_EQ(0u, profiler.getData(key).max);
+}
+
+TEST_F(ProfilerTraceTest, registerProfile_returns_same_key_as_push)
+{
+    std::size_t key = profiler.registerProfile("hi");
+
+    EXPECT_EQ(1u, profiler.getNumProfiles());
+    EXPECT_EQ(key, profiler.push("hi"));
+    EXPECT_EQ(1u, profiler.getNumProfiles());
+}
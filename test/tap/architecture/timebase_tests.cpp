@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2026 Advanced Robotics at the University of Washington <robomstr@uw.edu>
+ *
+ * This file is part of Taproot.
+ *
+ * Taproot is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Taproot is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Taproot.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "tap/architecture/clock.hpp"
+#include "tap/architecture/timebase.hpp"
+
+using namespace tap::arch;
+
+TEST(Timebase, getTicks_follows_clock_stub_without_timebase_stub)
+{
+    clock::ClockStub clock;
+    clock.time = 12;
+
+    EXPECT_EQ(12'000u, timebase::getTicks());
+    EXPECT_EQ(1'000'000u, timebase::getTicksPerSecond());
+}
+
+TEST(Timebase, getTicks_returns_timebase_stub_ticks)
+{
+    clock::ClockStub clock;
+    timebase::TimebaseStub timebaseStub;
+    clock.time = 12;
+    timebaseStub.ticks = 42;
+    timebaseStub.ticksPerSecond = 180'000'000;
+
+    EXPECT_EQ(42u, timebase::getTicks());
+    EXPECT_EQ(180'000'000u, timebase::getTicksPerSecond());
+}
+
+TEST(Timebase, ticks_convert_to_time_at_stub_frequency)
+{
+    timebase::TimebaseStub timebaseStub;
+    timebaseStub.ticksPerSecond = 180'000'000;
+
+    EXPECT_EQ(0u, timebase::ticksToMicroseconds(179));
+    EXPECT_EQ(1u, timebase::ticksToMicroseconds(180));
+    EXPECT_EQ(1'000'000u, timebase::ticksToMicroseconds(180'000'000));
+    EXPECT_FLOAT_EQ(0.5f, timebase::ticksToMicrosecondsFloat(90));
+    EXPECT_EQ(500u, timebase::ticksToNanoseconds(90));
+}
+
+TEST(Timebase, conversions_do_not_overflow_for_full_32_bit_durations)
+{
+    timebase::TimebaseStub timebaseStub;
+    timebaseStub.ticksPerSecond = 180'000'000;
+
+    EXPECT_EQ(23'860'929u, timebase::ticksToMicroseconds(UINT32_MAX));
+    EXPECT_EQ(23'860'929'416u, timebase::ticksToNanoseconds(UINT32_MAX));
+}
@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2026 Advanced Robotics at the University of Washington <robomstr@uw.edu>
+ *
+ * This file is part of Taproot.
+ *
+ * Taproot is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Taproot is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Taproot.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "tap/architecture/clock.hpp"
+#include "tap/architecture/conditional_timer.hpp"
+#include "tap/architecture/periodic_timer.hpp"
+#include "tap/architecture/timeout.hpp"
+
+using namespace tap::arch;
+
+/// `ClockStub::time`, in ms, just before `getTimeMicroseconds()` wraps.
+static constexpr uint32_t MS_BEFORE_MICROSECOND_WRAP = 4'294'967;
+
+TEST(Timeout, getTimeMicroseconds64_continues_past_32_bit_boundary)
+{
+    clock::ClockStub clock;
+    clock.time = MS_BEFORE_MICROSECOND_WRAP;
+    uint64_t before = clock::getTimeMicroseconds64();
+
+    clock.time += 1;
+
+    EXPECT_LT(clock::getTimeMicroseconds(), 1'000u);
+    EXPECT_EQ(before + 1'000, clock::getTimeMicroseconds64());
+    EXPECT_GT(clock::getTimeMicroseconds64(), UINT32_MAX);
+}
+
+TEST(Timeout, MilliTimeout_expires_after_timeout)
+{
+    clock::ClockStub clock;
+    MilliTimeout timeout;
+    EXPECT_TRUE(timeout.isStopped());
+    EXPECT_FALSE(timeout.isExpired());
+
+    timeout.restart(10);
+    clock.time = 9;
+    EXPECT_FALSE(timeout.isExpired());
+    EXPECT_EQ(1u, timeout.timeRemaining());
+
+    clock.time = 10;
+    EXPECT_TRUE(timeout.isExpired());
+    EXPECT_TRUE(timeout.execute());
+    EXPECT_FALSE(timeout.execute());
+}
+
+TEST(Timeout, MicroTimeout64_does_not_expire_early_across_32_bit_boundary)
+{
+    clock::ClockStub clock;
+    clock.time = MS_BEFORE_MICROSECOND_WRAP - 1;
+    MicroTimeout64 timeout(5'000);
+
+    clock.time = MS_BEFORE_MICROSECOND_WRAP + 1;
+    EXPECT_FALSE(timeout.isExpired());
+    EXPECT_EQ(3'000u, timeout.timeRemaining());
+
+    clock.time = MS_BEFORE_MICROSECOND_WRAP + 4;
+    EXPECT_TRUE(timeout.isExpired());
+}
+
+TEST(Timeout, MicroTimeout64_expires_across_32_bit_boundary)
+{
+    clock::ClockStub clock;
+    clock.time = MS_BEFORE_MICROSECOND_WRAP - 1;
+    MicroTimeout64 timeout(1'000);
+    // Expires at 4'294'967'000 us which a 32-bit timeout would compute as well, but the 32-bit
+    // clock wraps before the timeout is checked
+    MicroTimeout timeout32(1'000);
+
+    clock.time = MS_BEFORE_MICROSECOND_WRAP + 1;
+
+    EXPECT_TRUE(timeout.isExpired());
+    EXPECT_FALSE(timeout32.isExpired());
+}
+
+TEST(PeriodicTimer, PeriodicMicroTimer64_fires_once_per_period_across_32_bit_boundary)
+{
+    clock::ClockStub clock;
+    clock.time = MS_BEFORE_MICROSECOND_WRAP - 2;
+    PeriodicMicroTimer64 timer(2'000);
+
+    int fired = 0;
+    for (uint32_t i = 0; i < 10; i++)
+    {
+        clock.time++;
+        fired += timer.execute();
+    }
+
+    EXPECT_EQ(5, fired);
+}
+
+TEST(PeriodicTimer, execute_skips_missed_periods)
+{
+    clock::ClockStub clock;
+    PeriodicMilliTimer timer(10);
+
+    clock.time = 35;
+    EXPECT_TRUE(timer.execute());
+    EXPECT_FALSE(timer.execute());
+
+    clock.time = 39;
+    EXPECT_FALSE(timer.execute());
+    clock.time = 40;
+    EXPECT_TRUE(timer.execute());
+}
+
+TEST(ConditionalTimer, ConditionalMicroTimer64_restarts_while_condition_false_across_boundary)
+{
+    clock::ClockStub clock;
+    clock.time = MS_BEFORE_MICROSECOND_WRAP - 1;
+    ConditionalMicroTimer64 timer(2'000);
+    timer.restart();
+
+    clock.time = MS_BEFORE_MICROSECOND_WRAP + 1;
+    EXPECT_TRUE(timer.execute(true));
+
+    EXPECT_FALSE(timer.execute(false));
+    clock.time = MS_BEFORE_MICROSECOND_WRAP + 2;
+    EXPECT_FALSE(timer.execute(true));
+    clock.time = MS_BEFORE_MICROSECOND_WRAP + 3;
+    EXPECT_TRUE(timer.execute(true));
+}
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2026 Advanced Robotics at the University of Washington <robomstr@uw.edu>
+ *
+ * This file is part of Taproot.
+ *
+ * Taproot is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Taproot is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Taproot.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "tap/architecture/work_stealing_thread_pool.hpp"
+
+using tap::arch::WorkStealingThreadPool;
+
+TEST(WorkStealingThreadPool, numThreads_less_than_one_treated_as_one)
+{
+    WorkStealingThreadPool pool(0);
+
+    EXPECT_EQ(1, pool.getNumThreads());
+
+    int count = 0;
+    pool.run(10, [&](int) { count++; });
+    EXPECT_EQ(10, count);
+}
+
+TEST(WorkStealingThreadPool, run_with_no_tasks_returns_immediately)
+{
+    WorkStealingThreadPool pool(4);
+
+    pool.run(0, [](int) { FAIL(); });
+}
+
+TEST(WorkStealingThreadPool, run_calls_every_task_exactly_once)
+{
+    WorkStealingThreadPool pool(4);
+
+    for (int numTasks : {1, 2, 3, 4, 5, 17, 64, 1000})
+    {
+        std::vector<std::atomic<int>> calls(numTasks);
+        pool.run(numTasks, [&](int i) { calls[i]++; });
+
+        for (int i = 0; i < numTasks; i++)
+        {
+            EXPECT_EQ(1, calls[i]) << "task " << i << " of " << numTasks;
+        }
+    }
+}
+
+TEST(WorkStealingThreadPool, run_returns_after_all_tasks_finish)
+{
+    WorkStealingThreadPool pool(3);
+
+    for (int batch = 0; batch < 50; batch++)
+    {
+        std::atomic<int> finished = 0;
+        pool.run(6, [&](int i) {
+            if (i % 3 == 0)
+            {
+                std::this_thread::sleep_for(std::chrono::microseconds(100));
+            }
+            finished++;
+        });
+        ASSERT_EQ(6, finished);
+    }
+}
+
+TEST(WorkStealingThreadPool, idle_threads_steal_from_busy_thread)
+{
+    WorkStealingThreadPool pool(2);
+
+    // All of the slow tasks are in the first thread's range. The second thread finishes its
+    // range of fast tasks and must steal the rest of the slow ones.
+    std::vector<std::thread::id> ranOn(8);
+    pool.run(8, [&](int i) {
+        if (i < 4)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+        ranOn[i] = std::this_thread::get_id();
+    });
+
+    int slowTasksOnOtherThreads = 0;
+    for (int i = 0; i < 4; i++)
+    {
+        if (ranOn[i] != std::this_thread::get_id())
+        {
+            slowTasksOnOtherThreads++;
+        }
+    }
+    EXPECT_GT(slowTasksOnOtherThreads, 0);
+}
@@ -0,0 +1,216 @@
+/*
+ * Copyright (c) 2026 Advanced Robotics at the University of Washington <robomstr@uw.edu>
+ *
+ * This file is part of Taproot.
+ *
+ * Taproot is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Taproot is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Taproot.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "tap/architecture/clock.hpp"
+#include "tap/communication/can/can_bus_load_monitor.hpp"
+
+#include "modm/architecture/interface/can_message.hpp"
+
+using namespace testing;
+using namespace tap::can;
+using namespace tap::arch;
+
+class CanBusLoadMonitorTest : public Test
+{
+protected:
+    clock::ClockStub clock;
+    CanBusLoadMonitor monitor;
+};
+
+TEST(CanBusLoadMonitor, getFrameBits__zeroed_standard_frame_counts_stuff_bits)
+{
+    // 19 header bits and 15 CRC bits, all 0, need a stuff bit after every 5
+    modm::can::Message message(0, 0, 0, false);
+
+    EXPECT_EQ(
+        34 + 6 + CanBusLoadMonitor::FRAME_TRAILER_BITS,
+        CanBusLoadMonitor::getFrameBits(message));
+}
+
+TEST(CanBusLoadMonitor, getWorstCaseFrameBits__matches_known_worst_cases)
+{
+    EXPECT_EQ(135, CanBusLoadMonitor::getWorstCaseFrameBits(8, false));
+    EXPECT_EQ(160, CanBusLoadMonitor::getWorstCaseFrameBits(8, true));
+    EXPECT_EQ(55, CanBusLoadMonitor::getWorstCaseFrameBits(0, false));
+}
+
+TEST(CanBusLoadMonitor, getFrameBits__between_unstuffed_and_worst_case_size)
+{
+    for (uint32_t i = 0; i < 1000; i++)
+    {
+        bool extended = i % 2;
+        uint8_t length = i % 9;
+        uint32_t id = (i * 2654435761u) & (extended ? 0x1fffffff : 0x7ff);
+        modm::can::Message message(id, length, i * 0x9e3779b97f4a7c15ull, extended);
+
+        uint16_t unstuffedBits =
+            (extended ? 54 : 34) + 8 * length + CanBusLoadMonitor::FRAME_TRAILER_BITS;
+        uint16_t bits = CanBusLoadMonitor::getFrameBits(message);
+
+        EXPECT_LE(unstuffedBits, bits);
+        EXPECT_GE(CanBusLoadMonitor::getWorstCaseFrameBits(length, extended), bits);
+    }
+}
+
+TEST(CanBusLoadMonitor, getFrameBits__remote_frame_has_no_data)
+{
+    modm::can::Message remote(0x123, 8, 0xffff'ffff'ffff'ffff, false);
+    remote.setRemoteTransmitRequest(true);
+    modm::can::Message data(0x123, 8, 0xffff'ffff'ffff'ffff, false);
+
+    EXPECT_GE(
+        CanBusLoadMonitor::getWorstCaseFrameBits(0, false),
+        CanBusLoadMonitor::getFrameBits(remote));
+    EXPECT_LT(CanBusLoadMonitor::getFrameBits(remote), CanBusLoadMonitor::getFrameBits(data));
+}
+
+TEST_F(CanBusLoadMonitorTest, recordTx__failed_frames_not_counted_in_load)
+{
+    modm::can::Message message(0x200, 8, 0, false);
+
+    monitor.recordTx(CanBus::CAN_BUS1, message, true);
+    monitor.recordTx(CanBus::CAN_BUS1, message, false);
+    monitor.recordRx(CanBus::CAN_BUS1, message);
+
+    CanBusLoadMonitor::BusStats stats = monitor.getBusStats(CanBus::CAN_BUS1);
+    EXPECT_EQ(1u, stats.txFrames);
+    EXPECT_EQ(1u, stats.txFailures);
+    EXPECT_EQ(1u, stats.rxFrames);
+    EXPECT_EQ(2u * CanBusLoadMonitor::getFrameBits(message), stats.totalBits);
+
+    CanBusLoadMonitor::BusStats otherStats = monitor.getBusStats(CanBus::CAN_BUS2);
+    EXPECT_EQ(0u, otherStats.txFrames);
+    EXPECT_EQ(0u, otherStats.totalBits);
+}
+
+TEST_F(CanBusLoadMonitorTest, getBusStats__utilization_measured_over_sliding_window)
+{
+    modm::can::Message message(0x200, 8, 0, false);
+    uint16_t frameBits = CanBusLoadMonitor::getFrameBits(message);
+
+    for (int i = 0; i < 1000; i++)
+    {
+        monitor.recordTx(CanBus::CAN_BUS1, message, true);
+    }
+
+    // Frames in the bucket still being filled are not counted yet
+    EXPECT_EQ(0u, monitor.getBusStats(CanBus::CAN_BUS1).windowBits);
+
+    clock.time = CanBusLoadMonitor::BUCKET_PERIOD_MS;
+    CanBusLoadMonitor::BusStats stats = monitor.getBusStats(CanBus::CAN_BUS1);
+    EXPECT_EQ(1000u * frameBits, stats.windowBits);
+    EXPECT_FLOAT_EQ(1000.0f * frameBits / CanBusLoadMonitor::BITRATE, stats.utilization);
+    EXPECT_FLOAT_EQ(stats.utilization, stats.peakUtilization);
+
+    clock.time = CanBusLoadMonitor::WINDOW_MS + CanBusLoadMonitor::BUCKET_PERIOD_MS - 1;
+    EXPECT_EQ(1000u * frameBits, monitor.getBusStats(CanBus::CAN_BUS1).windowBits);
+
+    clock.time = CanBusLoadMonitor::WINDOW_MS + CanBusLoadMonitor::BUCKET_PERIOD_MS;
+    stats = monitor.getBusStats(CanBus::CAN_BUS1);
+    EXPECT_EQ(0u, stats.windowBits);
+    EXPECT_FLOAT_EQ(0, stats.utilization);
+    EXPECT_FLOAT_EQ(1000.0f * frameBits / CanBusLoadMonitor::BITRATE, stats.peakUtilization);
+}
+
+TEST_F(CanBusLoadMonitorTest, getBusStats__long_gap_clears_window)
+{
+    modm::can::Message message(0x200, 8, 0, false);
+    monitor.recordTx(CanBus::CAN_BUS1, message, true);
+
+    clock.time = 100 * CanBusLoadMonitor::WINDOW_MS + 37;
+    EXPECT_EQ(0u, monitor.getBusStats(CanBus::CAN_BUS1).windowBits);
+
+    monitor.recordTx(CanBus::CAN_BUS1, message, true);
+    clock.time += CanBusLoadMonitor::BUCKET_PERIOD_MS;
+    EXPECT_EQ(
+        CanBusLoadMonitor::getFrameBits(message),
+        monitor.getBusStats(CanBus::CAN_BUS1).windowBits);
+}
+
+TEST_F(CanBusLoadMonitorTest, getIdStats__tracks_bus_identifier_and_direction_separately)
+{
+    modm::can::Message command(0x200, 8, 0, false);
+    modm::can::Message feedback(0x201, 8, 0, false);
+
+    for (uint32_t ms = 0; ms < CanBusLoadMonitor::WINDOW_MS; ms++)
+    {
+        clock.time = ms;
+        monitor.recordTx(CanBus::CAN_BUS1, command, true);
+        monitor.recordRx(CanBus::CAN_BUS1, feedback);
+        if (ms % 2 == 0)
+        {
+            monitor.recordTx(CanBus::CAN_BUS2, command, true);
+        }
+    }
+    monitor.recordRx(CanBus::CAN_BUS1, command);
+    clock.time = CanBusLoadMonitor::WINDOW_MS;
+
+    ASSERT_EQ(4, monitor.getNumTrackedIds());
+
+    CanBusLoadMonitor::IdStats stats = monitor.getIdStats(0);
+    EXPECT_EQ(0x200u, stats.identifier);
+    EXPECT_EQ(CanBus::CAN_BUS1, stats.bus);
+    EXPECT_TRUE(stats.transmit);
+    EXPECT_EQ(1000u, stats.framesPerWindow);
+    EXPECT_EQ(CanBusLoadMonitor::getFrameBits(command), stats.bitsPerFrame);
+
+    stats = monitor.getIdStats(1);
+    EXPECT_EQ(0x201u, stats.identifier);
+    EXPECT_FALSE(stats.transmit);
+    EXPECT_EQ(1000u, stats.framesPerWindow);
+
+    stats = monitor.getIdStats(2);
+    EXPECT_EQ(CanBus::CAN_BUS2, stats.bus);
+    EXPECT_EQ(500u, stats.framesPerWindow);
+
+    stats = monitor.getIdStats(3);
+    EXPECT_EQ(0x200u, stats.identifier);
+    EXPECT_FALSE(stats.transmit);
+    EXPECT_EQ(1u, stats.frames);
+}
+
+TEST_F(CanBusLoadMonitorTest, getIdStats__frames_past_table_size_counted_as_untracked)
+{
+    for (uint32_t id = 0; id < CanBusLoadMonitor::MAX_TRACKED_IDS + 3; id++)
+    {
+        monitor.recordRx(CanBus::CAN_BUS1, modm::can::Message(id, 8, 0, false));
+    }
+
+    EXPECT_EQ(CanBusLoadMonitor::MAX_TRACKED_IDS, monitor.getNumTrackedIds());
+    EXPECT_EQ(3u, monitor.getUntrackedFrames());
+    EXPECT_EQ(
+        CanBusLoadMonitor::MAX_TRACKED_IDS + 3u,
+        monitor.getBusStats(CanBus::CAN_BUS1).rxFrames);
+}
+
+TEST_F(CanBusLoadMonitorTest, reset__clears_counters)
+{
+    monitor.recordRx(CanBus::CAN_BUS1, modm::can::Message(1, 8, 0, false));
+    clock.time = 1000;
+
+    monitor.reset();
+
+    EXPECT_EQ(0, monitor.getNumTrackedIds());
+    CanBusLoadMonitor::BusStats stats = monitor.getBusStats(CanBus::CAN_BUS1);
+    EXPECT_EQ(0u, stats.rxFrames);
+    EXPECT_EQ(0u, stats.totalBits);
+    EXPECT_FLOAT_EQ(0, stats.peakUtilization);
+}
@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2026 Advanced Robotics at the University of Washington <robomstr@uw.edu>
+ *
+ * This file is part of Taproot.
+ *
+ * Taproot is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Taproot is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Taproot.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "tap/communication/can/can_capture.hpp"
+
+using namespace tap::can;
+
+static std::string format(const CanCaptureRecord &record)
+{
+    char line[CanCapture::MAX_LOG_LINE_LENGTH];
+    int length = CanCapture::formatRecord(record, line, sizeof(line));
+    return std::string(line, length);
+}
+
+TEST(CanCapture, nothing_recorded_until_started)
+{
+    StaticCanCapture<4> capture;
+
+    capture.record(CanBus::CAN_BUS1, modm::can::Message(0x201, 8, 0, false), 10, false);
+    EXPECT_EQ(0u, capture.size());
+
+    capture.start();
+    capture.record(CanBus::CAN_BUS1, modm::can::Message(0x201, 8, 0, false), 20, false);
+    capture.stop();
+    capture.record(CanBus::CAN_BUS1, modm::can::Message(0x201, 8, 0, false), 30, false);
+
+    ASSERT_EQ(1u, capture.size());
+    EXPECT_EQ(20u, capture.getRecord(0).timestamp);
+}
+
+TEST(CanCapture, record_stores_frame)
+{
+    StaticCanCapture<4> capture;
+    capture.start();
+
+    modm::can::Message message(0x0205'1843, 8, 0x0807'0605'0403'0201, true);
+    capture.record(CanBus::CAN_BUS2, message, 1234, true);
+
+    const CanCaptureRecord &record = capture.getRecord(0);
+    EXPECT_EQ(1234u, record.timestamp);
+    EXPECT_EQ(0x0205'1843u, record.identifier);
+    EXPECT_EQ(8, record.length);
+    EXPECT_EQ(1, record.data[0]);
+    EXPECT_EQ(8, record.data[7]);
+    EXPECT_EQ(CanBus::CAN_BUS2, record.getBus());
+    EXPECT_TRUE(record.isTransmit());
+    EXPECT_TRUE(record.flags & CanCaptureRecord::FLAG_EXTENDED);
+    EXPECT_FALSE(record.flags & CanCaptureRecord::FLAG_REMOTE);
+}
+
+TEST(CanCapture, full_capture_overwrites_oldest_frames)
+{
+    StaticCanCapture<3> capture;
+    capture.start();
+
+    for (uint32_t i = 0; i < 5; i++)
+    {
+        capture.record(CanBus::CAN_BUS1, modm::can::Message(0x201 + i, 8, 0, false), i, false);
+    }
+
+    EXPECT_EQ(3u, capture.size());
+    EXPECT_EQ(5u, capture.getTotalRecorded());
+    EXPECT_EQ(2u, capture.getDroppedCount());
+    EXPECT_EQ(0x203u, capture.getRecord(0).identifier);
+    EXPECT_EQ(0x205u, capture.getRecord(2).identifier);
+
+    capture.clear();
+    EXPECT_EQ(0u, capture.size());
+    EXPECT_TRUE(capture.isRunning());
+}
+
+TEST(CanCapture, formatRecord_writes_candump_log_lines)
+{
+    StaticCanCapture<4> capture;
+    capture.start();
+
+    capture.record(
+        CanBus::CAN_BUS1,
+        modm::can::Message(0x201, 8, 0xddcc'bbaa'4433'2211, false),
+        12'000'345,
+        false);
+    capture.record(
+        CanBus::CAN_BUS2,
+        modm::can::Message(0x0205'0083, 4, 0x3f00'0000, true),
+        999'999,
+        true);
+    modm::can::Message remote(0x7ff, 2, 0, false);
+    remote.setRemoteTransmitRequest(true);
+    capture.record(CanBus::CAN_BUS1, remote, 0, false);
+    capture.record(CanBus::CAN_BUS1, modm::can::Message(0x1ff, 0, 0, false), 1, true);
+
+    EXPECT_EQ("(12.000345) can1 201#11223344AABBCCDD R\n", format(capture.getRecord(0)));
+    EXPECT_EQ("(0.999999) can2 02050083#0000003F T\n", format(capture.getRecord(1)));
+    EXPECT_EQ("(0.000000) can1 7FF#R R\n", format(capture.getRecord(2)));
+    EXPECT_EQ("(0.000001) can1 1FF# T\n", format(capture.getRecord(3)));
+}
+
+TEST(CanCapture, formatRecord_rejects_short_buffer)
+{
+    CanCaptureRecord record = {};
+    char line[CanCapture::MAX_LOG_LINE_LENGTH - 1];
+
+    EXPECT_EQ(0, CanCapture::formatRecord(record, line, sizeof(line)));
+}
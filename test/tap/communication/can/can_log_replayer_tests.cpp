@@ -0,0 +1,248 @@
+/*
+ * Copyright (c) 2026 Advanced Robotics at the University of Washington <robomstr@uw.edu>
+ *
+ * This file is part of Taproot.
+ *
+ * Taproot is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Taproot is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Taproot.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "tap/communication/can/can_capture.hpp"
+#include "tap/communication/can/can_log_replayer.hpp"
+#include "tap/communication/can/virtual_can_bus.hpp"
+#include "tap/communication/can/virtual_can_controller.hpp"
+
+using namespace tap::can;
+
+class CanLogReplayerTest : public testing::Test
+{
+protected:
+    CanLogReplayerTest()
+        : can1Controller(&can1Bus),
+          can2Controller(&can2Bus),
+          replayer(&can1Bus, &can2Bus)
+    {
+    }
+
+    void advanceTo(uint64_t time)
+    {
+        can1Bus.advanceTo(time);
+        can2Bus.advanceTo(time);
+    }
+
+    CanLogFrame parse(const std::string &line)
+    {
+        CanLogFrame frame;
+        EXPECT_TRUE(replayer.parseLogLine(line, &frame)) << line;
+        return frame;
+    }
+
+    VirtualCanBus can1Bus;
+    VirtualCanBus can2Bus;
+    VirtualCanController can1Controller;
+    VirtualCanController can2Controller;
+    CanLogReplayer replayer;
+};
+
+TEST_F(CanLogReplayerTest, parseLogLine_reads_candump_lines)
+{
+    CanLogFrame frame = parse("(1436509052.249713) can1 201#11223344AABBCCDD");
+    EXPECT_EQ(1'436'509'052'249'713u, frame.timestamp);
+    EXPECT_EQ(CanBus::CAN_BUS1, frame.bus);
+    EXPECT_FALSE(frame.transmit);
+    EXPECT_EQ(0x201u, frame.message.getIdentifier());
+    EXPECT_FALSE(frame.message.isExtended());
+    EXPECT_EQ(8, frame.message.getLength());
+    EXPECT_EQ(0x11, frame.message.data[0]);
+    EXPECT_EQ(0xdd, frame.message.data[7]);
+
+    frame = parse("(0.000010) can2 02051843#00 T");
+    EXPECT_EQ(10u, frame.timestamp);
+    EXPECT_EQ(CanBus::CAN_BUS2, frame.bus);
+    EXPECT_TRUE(frame.transmit);
+    EXPECT_TRUE(frame.message.isExtended());
+    EXPECT_EQ(0x0205'1843u, frame.message.getIdentifier());
+    EXPECT_EQ(1, frame.message.getLength());
+
+    frame = parse("(0.000010) can1 7FF#R");
+    EXPECT_TRUE(frame.message.isRemoteTransmitRequest());
+    EXPECT_EQ(0, frame.message.getLength());
+}
+
+TEST_F(CanLogReplayerTest, parseLogLine_rejects_malformed_and_unsupported_lines)
+{
+    CanLogFrame frame;
+    EXPECT_FALSE(replayer.parseLogLine("", &frame));
+    EXPECT_FALSE(replayer.parseLogLine("(0.000010) can3 201#00", &frame));
+    EXPECT_FALSE(replayer.parseLogLine("(0.000010) can1 201#0", &frame));
+    EXPECT_FALSE(replayer.parseLogLine("(0.000010) can1 2011#00", &frame));
+    EXPECT_FALSE(replayer.parseLogLine("(0.000010) can1 20G#00", &frame));
+    EXPECT_FALSE(replayer.parseLogLine("(0.000010) can1 201##100", &frame));
+    EXPECT_FALSE(replayer.parseLogLine("(0.000010) can1 20000004#0000000000000000", &frame));
+    EXPECT_FALSE(replayer.parseLogLine("(0.10) can1 201#00", &frame));
+}
+
+TEST_F(CanLogReplayerTest, setInterfaceName_maps_interfaces_to_buses)
+{
+    replayer.setInterfaceName(CanBus::CAN_BUS1, "vcan0");
+
+    CanLogFrame frame;
+    EXPECT_FALSE(replayer.parseLogLine("(0.000010) can1 201#00", &frame));
+    EXPECT_TRUE(replayer.parseLogLine("(0.000010) vcan0 201#00", &frame));
+    EXPECT_EQ(CanBus::CAN_BUS1, frame.bus);
+}
+
+TEST_F(CanLogReplayerTest, parseLogLine_reads_captured_frames)
+{
+    StaticCanCapture<1> capture;
+    capture.start();
+    capture.record(
+        CanBus::CAN_BUS2,
+        modm::can::Message(0x0205'1883, 8, 0x0123'4567'89ab'cdef, true),
+        71'000'001,
+        true);
+
+    char line[CanCapture::MAX_LOG_LINE_LENGTH];
+    CanCapture::formatRecord(capture.getRecord(0), line, sizeof(line));
+    CanLogFrame frame = parse(line);
+
+    EXPECT_EQ(71'000'001u, frame.timestamp);
+    EXPECT_EQ(CanBus::CAN_BUS2, frame.bus);
+    EXPECT_TRUE(frame.transmit);
+    EXPECT_EQ(0x0205'1883u, frame.message.getIdentifier());
+    EXPECT_EQ(0xef, frame.message.data[0]);
+}
+
+TEST_F(CanLogReplayerTest, readLogFile_unwraps_capture_timestamps)
+{
+    const std::string path = testing::TempDir() + "can_log_replayer_wrap.log";
+    {
+        std::ofstream file(path);
+        file << "(4294.967000) can1 201#01\n"
+                "(4294.967200) can1 202#02\n"
+                "not a frame\n"
+                "(0.000100) can1 203#03\n"
+                "(0.000090) can1 204#04\n"
+                "(0.000300) can1 205#05\n";
+    }
+
+    std::vector<CanLogFrame> frames;
+    ASSERT_TRUE(replayer.readLogFile(path, frames));
+    std::remove(path.c_str());
+
+    ASSERT_EQ(5u, frames.size());
+    EXPECT_EQ(4'294'967'000u, frames[0].timestamp);
+    EXPECT_EQ(4'294'967'200u, frames[1].timestamp);
+    EXPECT_EQ(CanLogReplayer::TIMESTAMP_WRAP_US + 100, frames[2].timestamp);
+    // Frames logged slightly out of order keep the previous timestamp
+    EXPECT_EQ(CanLogReplayer::TIMESTAMP_WRAP_US + 100, frames[3].timestamp);
+    EXPECT_EQ(CanLogReplayer::TIMESTAMP_WRAP_US + 300, frames[4].timestamp);
+}
+
+TEST_F(CanLogReplayerTest, readLogFile_fails_if_file_missing)
+{
+    std::vector<CanLogFrame> frames;
+    EXPECT_FALSE(replayer.readLogFile(testing::TempDir() + "no_such_can_log.log", frames));
+    EXPECT_TRUE(frames.empty());
+}
+
+TEST_F(CanLogReplayerTest, replays_received_frames_at_recorded_times)
+{
+    advanceTo(1'000);
+    std::vector<CanLogFrame> frames = {
+        parse("(100.000000) can1 201#01"),
+        parse("(100.000000) can1 200#0000000000000000 T"),
+        parse("(100.002000) can2 202#02"),
+        parse("(100.005000) can1 203#03"),
+    };
+
+    replayer.start(frames);
+
+    modm::can::Message message;
+    uint32_t arrivalTime;
+
+    advanceTo(1'500);
+    ASSERT_TRUE(can1Controller.getMessage(&message, &arrivalTime));
+    EXPECT_EQ(0x201u, message.getIdentifier());
+    EXPECT_LT(1'000u, arrivalTime);
+    // Frames the recording board sent are not replayed
+    EXPECT_FALSE(can1Controller.getMessage(&message, nullptr));
+    EXPECT_FALSE(can2Controller.getMessage(&message, nullptr));
+
+    advanceTo(3'500);
+    ASSERT_TRUE(can2Controller.getMessage(&message, &arrivalTime));
+    EXPECT_EQ(0x202u, message.getIdentifier());
+    EXPECT_LE(3'000u, arrivalTime);
+    EXPECT_FALSE(replayer.isFinished());
+
+    advanceTo(6'500);
+    ASSERT_TRUE(can1Controller.getMessage(&message, &arrivalTime));
+    EXPECT_EQ(0x203u, message.getIdentifier());
+    EXPECT_LE(6'000u, arrivalTime);
+
+    EXPECT_TRUE(replayer.isFinished());
+    EXPECT_EQ(3u, replayer.getNumReplayed());
+}
+
+TEST_F(CanLogReplayerTest, replays_faster_at_higher_speed)
+{
+    std::vector<CanLogFrame> frames = {
+        parse("(0.000000) can1 201#01"),
+        parse("(0.010000) can1 202#02"),
+    };
+
+    replayer.start(frames, 10.0f);
+    advanceTo(1'500);
+
+    EXPECT_TRUE(replayer.isFinished());
+    EXPECT_EQ(2u, replayer.getNumReplayed());
+}
+
+TEST_F(CanLogReplayerTest, replays_frames_late_in_long_log_at_recorded_time)
+{
+    std::vector<CanLogFrame> frames = {
+        parse("(0.000000) can1 201#01"),
+        parse("(3600.000001) can1 202#02"),
+    };
+
+    replayer.start(frames);
+    advanceTo(3'600'000'000);
+    EXPECT_EQ(1u, replayer.getNumReplayed());
+
+    advanceTo(3'600'000'001);
+    EXPECT_TRUE(replayer.isFinished());
+    EXPECT_EQ(2u, replayer.getNumReplayed());
+}
+
+TEST_F(CanLogReplayerTest, stop_stops_replay)
+{
+    std::vector<CanLogFrame> frames = {
+        parse("(0.000000) can1 201#01"),
+        parse("(0.010000) can1 202#02"),
+    };
+
+    replayer.start(frames);
+    advanceTo(1'000);
+    replayer.stop();
+    advanceTo(20'000);
+
+    EXPECT_TRUE(replayer.isFinished());
+    EXPECT_EQ(1u, replayer.getNumReplayed());
+}
@@ -18,6 +18,7 @@
  */
 
 #include <memory>
+#include <utility>
 
 #include <gtest/gtest.h>
 
@@ -68,88 +69,76 @@ TEST_F(CanRxHandlerTest, attachReceiveHandler_attaches_listener_can2)
 
     EXPECT_EQ(
         &listener,
-        handler.getHandlerStore(
-            tap::can::CanBus::CAN_BUS2)[tap::can::CanRxHandler::binIndexForCanId(
-            listener.canIdentifier)]);
+        handler.getListener(
+            tap::can::CanBus::CAN_BUS2,
+            tap::motor::MOTOR1,
+            tap::can::CanRxIdType::STANDARD));
+    EXPECT_EQ(
+        nullptr,
+        handler.getListener(
+            tap::can::CanBus::CAN_BUS1,
+            tap::motor::MOTOR1,
+            tap::can::CanRxIdType::STANDARD));
 
     handler.removeReceiveHandler(listener);
 }
 
-TEST_F(CanRxHandlerTest, attach_and_remove_recieve_handler_with_bin_conflicts_in_order)
+TEST_F(CanRxHandlerTest, attachReceiveHandler_accepts_any_standard_id)
 {
-    CanRxListenerMock listener(&drivers, tap::motor::MOTOR1, tap::can::CanBus::CAN_BUS2);
-    CanRxListenerMock listener2(
-        &drivers,
-        tap::motor::MOTOR1 + tap::can::CanRxHandler::CAN_BINS,
-        tap::can::CanBus::CAN_BUS2);
+    CanRxListenerMock listener(&drivers, 0x000, tap::can::CanBus::CAN_BUS1);
+    CanRxListenerMock listener2(&drivers, 0x1E0, tap::can::CanBus::CAN_BUS1);
+    CanRxListenerMock listener3(&drivers, 0x7FF, tap::can::CanBus::CAN_BUS1);
 
+    EXPECT_CALL(drivers.errorController, addToErrorList).Times(0);
     handler.attachReceiveHandler(&listener);
     handler.attachReceiveHandler(&listener2);
+    handler.attachReceiveHandler(&listener3);
 
-    EXPECT_EQ(
-        &listener,
-        handler.getHandlerStore(
-            tap::can::CanBus::CAN_BUS2)[tap::can::CanRxHandler::binIndexForCanId(
-            listener.canIdentifier)]);
-
-    EXPECT_EQ(
-        &listener2,
-        handler
-            .getHandlerStore(tap::can::CanBus::CAN_BUS2)[tap::can::CanRxHandler::binIndexForCanId(
-                listener.canIdentifier)]
-            ->next);
+    EXPECT_CALL(listener, processMessage);
+    EXPECT_CALL(listener2, processMessage);
+    EXPECT_CALL(listener3, processMessage);
+    handler.processReceivedCanData(
+        tap::can::CanBus::CAN_BUS1,
+        modm::can::Message(0x000, 8, 0, false));
+    handler.processReceivedCanData(
+        tap::can::CanBus::CAN_BUS1,
+        modm::can::Message(0x1E0, 8, 0, false));
+    handler.processReceivedCanData(
+        tap::can::CanBus::CAN_BUS1,
+        modm::can::Message(0x7FF, 8, 0, false));
 
     handler.removeReceiveHandler(listener);
-
-    EXPECT_EQ(
-        &listener2,
-        handler.getHandlerStore(
-            tap::can::CanBus::CAN_BUS2)[tap::can::CanRxHandler::binIndexForCanId(
-            listener.canIdentifier)]);
-
     handler.removeReceiveHandler(listener2);
+    handler.removeReceiveHandler(listener3);
 }
 
-TEST_F(CanRxHandlerTest, attach_and_remove_recieve_handler_with_bin_conflicts_in_reverse_order)
+TEST_F(CanRxHandlerTest, attachReceiveHandler__error_logged_with_out_of_range_id)
 {
-    CanRxListenerMock listener(&drivers, tap::motor::MOTOR1, tap::can::CanBus::CAN_BUS2);
-    CanRxListenerMock listener2(
-        &drivers,
-        tap::motor::MOTOR1 + tap::can::CanRxHandler::CAN_BINS,
-        tap::can::CanBus::CAN_BUS2);
+    CanRxListenerMock listener(&drivers, 0x800, tap::can::CanBus::CAN_BUS1);
 
+    EXPECT_CALL(drivers.errorController, addToErrorList).Times(1);
     handler.attachReceiveHandler(&listener);
-    handler.attachReceiveHandler(&listener2);
+}
 
-    EXPECT_EQ(
-        &listener,
-        handler.getHandlerStore(
-            tap::can::CanBus::CAN_BUS2)[tap::can::CanRxHandler::binIndexForCanId(
-            listener.canIdentifier)]);
+TEST_F(CanRxHandlerTest, same_id_on_different_buses_processed_by_correct_listener)
+{
+    CanRxListenerMock listener(&drivers, tap::motor::MOTOR1, tap::can::CanBus::CAN_BUS1);
+    CanRxListenerMock listener2(&drivers, tap::motor::MOTOR1, tap::can::CanBus::CAN_BUS2);
 
-    EXPECT_EQ(
-        &listener2,
-        handler
-            .getHandlerStore(tap::can::CanBus::CAN_BUS2)[tap::can::CanRxHandler::binIndexForCanId(
-                listener.canIdentifier)]
-            ->next);
+    handler.attachReceiveHandler(&listener);
+    handler.attachReceiveHandler(&listener2);
 
-    handler.removeReceiveHandler(listener2);
+    const modm::can::Message rxMessage(tap::motor::MOTOR1, 8, 0, false);
 
-    EXPECT_EQ(
-        &listener,
-        handler.getHandlerStore(
-            tap::can::CanBus::CAN_BUS2)[tap::can::CanRxHandler::binIndexForCanId(
-            listener.canIdentifier)]);
+    EXPECT_CALL(listener, processMessage);
+    EXPECT_CALL(listener2, processMessage).Times(0);
+    handler.processReceivedCanData(tap::can::CanBus::CAN_BUS1, rxMessage);
 
-    EXPECT_EQ(
-        nullptr,
-        handler
-            .getHandlerStore(tap::can::CanBus::CAN_BUS2)[tap::can::CanRxHandler::binIndexForCanId(
-                listener.canIdentifier)]
-            ->next);
+    EXPECT_CALL(listener2, processMessage);
+    handler.processReceivedCanData(tap::can::CanBus::CAN_BUS2, rxMessage);
 
     handler.removeReceiveHandler(listener);
+    handler.removeReceiveHandler(listener2);
 }
 
 TEST_F(CanRxHandlerTest, ListenerAttachesAndDetatchesInArray)
@@ -160,13 +149,21 @@ TEST_F(CanRxHandlerTest, ListenerAttachesAndDetatchesInArray)
     {
         handler.attachReceiveHandler(listener.get());
 
-        int bin = tap::can::CanRxHandler::binIndexForCanId(listener->canIdentifier);
-
-        EXPECT_EQ(listener.get(), handler.getHandlerStore(tap::can::CanBus::CAN_BUS1)[bin]);
+        EXPECT_EQ(
+            listener.get(),
+            handler.getListener(
+                tap::can::CanBus::CAN_BUS1,
+                listener->canIdentifier,
+                tap::can::CanRxIdType::STANDARD));
 
         handler.removeReceiveHandler(*listener);
 
-        EXPECT_EQ(nullptr, handler.getHandlerStore(tap::can::CanBus::CAN_BUS1)[bin]);
+        EXPECT_EQ(
+            nullptr,
+            handler.getListener(
+                tap::can::CanBus::CAN_BUS1,
+                listener->canIdentifier,
+                tap::can::CanRxIdType::STANDARD));
     }
 }
 
@@ -183,35 +180,83 @@ TEST_F(CanRxHandlerTest, MessageIsProcessedByCorrectListener)
     {
         handler.attachReceiveHandler(listener.get());
 
-        const modm::can::Message rxMessage(listener->canIdentifier);
+        const modm::can::Message rxMessage(listener->canIdentifier, 8, 0, false);
 
-        handler.processReceivedCanData(
-            rxMessage,
-            handler.getHandlerStore(tap::can::CanBus::CAN_BUS1));
+        handler.processReceivedCanData(tap::can::CanBus::CAN_BUS1, rxMessage);
     }
 }
 
-TEST_F(CanRxHandlerTest, process_messages_with_bin_conflicts)
+TEST_F(CanRxHandlerTest, message_without_listener_is_ignored)
 {
-    CanRxListenerMock listener(&drivers, tap::motor::MOTOR1, tap::can::CanBus::CAN_BUS1);
-    CanRxListenerMock listener2(
-        &drivers,
-        tap::motor::MOTOR1 + tap::can::CanRxHandler::CAN_BINS,
-        tap::can::CanBus::CAN_BUS1);
+    constructListeners();
+    handler.attachReceiveHandler(listeners[0].get());
 
-    handler.attachReceiveHandler(&listener);
-    handler.attachReceiveHandler(&listener2);
+    EXPECT_CALL(*listeners[0], processMessage).Times(0);
 
-    EXPECT_CALL(listener, processMessage);
-    const modm::can::Message rxMessage(listener.canIdentifier);
-    handler.processReceivedCanData(rxMessage, handler.getHandlerStore(tap::can::CanBus::CAN_BUS1));
+    handler.processReceivedCanData(
+        tap::can::CanBus::CAN_BUS1,
+        modm::can::Message(tap::motor::MOTOR2, 8, 0, false));
+}
 
-    EXPECT_CALL(listener2, processMessage);
-    const modm::can::Message rxMessage2(listener2.canIdentifier);
-    handler.processReceivedCanData(rxMessage2, handler.getHandlerStore(tap::can::CanBus::CAN_BUS1));
+TEST_F(CanRxHandlerTest, rev_device_listener_receives_extended_rev_messages)
+{
+    CanRxListenerMock revListener(
+        &drivers,
+        3,
+        tap::can::CanBus::CAN_BUS1,
+        tap::can::CanRxIdType::REV_DEVICE);
+    CanRxListenerMock standardListener(&drivers, 3, tap::can::CanBus::CAN_BUS1);
+
+    handler.attachReceiveHandler(&revListener);
+    handler.attachReceiveHandler(&standardListener);
+
+    // Period 1 status frame (API class 6, index 1) from device 3
+    uint32_t revStatusId = (0x02 << 24) | (0x05 << 16) | (6 << 10) | (1 << 6) | 3;
+
+    EXPECT_CALL(revListener, processMessage);
+    EXPECT_CALL(standardListener, processMessage);
+    handler.processReceivedCanData(
+        tap::can::CanBus::CAN_BUS1,
+        modm::can::Message(revStatusId, 8, 0, true));
+    handler.processReceivedCanData(tap::can::CanBus::CAN_BUS1, modm::can::Message(3, 8, 0, false));
+
+    handler.removeReceiveHandler(revListener);
+    handler.removeReceiveHandler(standardListener);
+}
 
-    handler.removeReceiveHandler(listener);
-    handler.removeReceiveHandler(listener2);
+TEST_F(CanRxHandlerTest, rev_device_listener_ignores_extended_messages_from_other_devices)
+{
+    CanRxListenerMock revListener(
+        &drivers,
+        3,
+        tap::can::CanBus::CAN_BUS1,
+        tap::can::CanRxIdType::REV_DEVICE);
+
+    handler.attachReceiveHandler(&revListener);
+
+    EXPECT_CALL(revListener, processMessage).Times(0);
+    // Same device number, different manufacturer
+    handler.processReceivedCanData(
+        tap::can::CanBus::CAN_BUS1,
+        modm::can::Message((0x02 << 24) | (0x04 << 16) | 3, 8, 0, true));
+    // REV motor controller, different device number
+    handler.processReceivedCanData(
+        tap::can::CanBus::CAN_BUS1,
+        modm::can::Message((0x02 << 24) | (0x05 << 16) | 4, 8, 0, true));
+
+    handler.removeReceiveHandler(revListener);
+}
+
+TEST_F(CanRxHandlerTest, attachReceiveHandler__error_logged_with_out_of_range_rev_device_id)
+{
+    CanRxListenerMock revListener(
+        &drivers,
+        tap::can::CanRxHandler::NUM_REV_DEVICE_IDS,
+        tap::can::CanBus::CAN_BUS1,
+        tap::can::CanRxIdType::REV_DEVICE);
+
+    EXPECT_CALL(drivers.errorController, addToErrorList).Times(1);
+    handler.attachReceiveHandler(&revListener);
 }
 
 TEST_F(CanRxHandlerTest, attachReceiveHandler__error_logged_with_overloading_can_rx_listener_id)
@@ -223,14 +268,43 @@ TEST_F(CanRxHandlerTest, attachReceiveHandler__error_logged_with_overloading_can
 
     EXPECT_CALL(drivers.errorController, addToErrorList).Times(1);
     handler.attachReceiveHandler(&canRxListener2);
-    EXPECT_EQ(&canRxListener, handler.getHandlerStore(tap::can::CanBus::CAN_BUS1)[0]);
+    EXPECT_EQ(
+        &canRxListener,
+        handler.getListener(tap::can::CanBus::CAN_BUS1, 0, tap::can::CanRxIdType::STANDARD));
 
     handler.removeReceiveHandler(canRxListener);
 }
 
+TEST_F(CanRxHandlerTest, attachReceiveHandler__error_logged_when_full)
+{
+    vector<unique_ptr<CanRxListenerMock>> manyListeners;
+    for (uint32_t i = 0; i <= tap::can::CanRxHandler::MAX_LISTENERS; i++)
+    {
+        manyListeners.push_back(
+            make_unique<CanRxListenerMock>(&drivers, i, tap::can::CanBus::CAN_BUS1));
+    }
+
+    EXPECT_CALL(drivers.errorController, addToErrorList).Times(1);
+    for (auto &listener : manyListeners)
+    {
+        handler.attachReceiveHandler(listener.get());
+    }
+
+    // A removed listener's slot is reused
+    handler.removeReceiveHandler(*manyListeners[0]);
+    EXPECT_CALL(drivers.errorController, addToErrorList).Times(0);
+    handler.attachReceiveHandler(manyListeners.back().get());
+    EXPECT_EQ(
+        manyListeners.back().get(),
+        handler.getListener(
+            tap::can::CanBus::CAN_BUS1,
+            tap::can::CanRxHandler::MAX_LISTENERS,
+            tap::can::CanRxIdType::STANDARD));
+}
+
 TEST_F(
     CanRxHandlerTest,
-    removeReceiveHandler__error_logged_with_missing_can_rx_listener_id_with_empty_bin)
+    removeReceiveHandler__error_logged_with_missing_can_rx_listener_id_with_empty_entry)
 {
     CanRxListenerMock canRxListener(&drivers, 0, tap::can::CanBus::CAN_BUS1);
 
@@ -241,19 +315,19 @@ TEST_F(
 
 TEST_F(
     CanRxHandlerTest,
-    removeReceiveHandler__error_logged_with_missing_can_rx_listener_id_with_existing_bin)
+    removeReceiveHandler__error_logged_with_other_can_rx_listener_with_same_id)
 {
     CanRxListenerMock canRxListener(&drivers, 0, tap::can::CanBus::CAN_BUS1);
-    CanRxListenerMock canRxListener2(
-        &drivers,
-        tap::can::CanRxHandler::CAN_BINS,
-        tap::can::CanBus::CAN_BUS1);
+    CanRxListenerMock canRxListener2(&drivers, 0, tap::can::CanBus::CAN_BUS1);
 
     handler.attachReceiveHandler(&canRxListener);
 
     EXPECT_CALL(drivers.errorController, addToErrorList).Times(1);
     handler.removeReceiveHandler(canRxListener2);
 
+    EXPECT_EQ(
+        &canRxListener,
+        handler.getListener(tap::can::CanBus::CAN_BUS1, 0, tap::can::CanRxIdType::STANDARD));
     handler.removeReceiveHandler(canRxListener);
 }
 
@@ -265,13 +339,14 @@ TEST_F(CanRxHandlerTest, pollCanData_can1_calls_process_message_passing_msg_to_c
 
     modm::can::Message msg(tap::motor::MOTOR1, 8, 0xffff'ffff'ffff'ffff, false);
 
-    ON_CALL(drivers.can, getMessage(tap::can::CanBus::CAN_BUS1, _))
-        .WillByDefault([&](tap::can::CanBus, modm::can::Message *message) {
+    bool sent = false;
+    ON_CALL(drivers.can, getMessage(tap::can::CanBus::CAN_BUS1, _, _))
+        .WillByDefault([&](tap::can::CanBus, modm::can::Message *message, uint32_t *) {
             *message = msg;
-            return true;
+            return !std::exchange(sent, true);
         });
-    ON_CALL(drivers.can, getMessage(tap::can::CanBus::CAN_BUS2, _))
-        .WillByDefault([&](tap::can::CanBus, modm::can::Message *) { return false; });
+    ON_CALL(drivers.can, getMessage(tap::can::CanBus::CAN_BUS2, _, _))
+        .WillByDefault(Return(false));
 
     EXPECT_CALL(*listeners[0], processMessage);
 
@@ -286,15 +361,179 @@ TEST_F(CanRxHandlerTest, pollCanData_can2_calls_process_message_passing_msg_to_c
 
     modm::can::Message msg(tap::motor::MOTOR1, 8, 0xffff'ffff'ffff'ffff, false);
 
-    ON_CALL(drivers.can, getMessage(tap::can::CanBus::CAN_BUS1, _))
-        .WillByDefault([&](tap::can::CanBus, modm::can::Message *) { return false; });
-    ON_CALL(drivers.can, getMessage(tap::can::CanBus::CAN_BUS2, _))
-        .WillByDefault([&](tap::can::CanBus, modm::can::Message *message) {
+    ON_CALL(drivers.can, getMessage(tap::can::CanBus::CAN_BUS1, _, _))
+        .WillByDefault(Return(false));
+    bool sent = false;
+    ON_CALL(drivers.can, getMessage(tap::can::CanBus::CAN_BUS2, _, _))
+        .WillByDefault([&](tap::can::CanBus, modm::can::Message *message, uint32_t *) {
             *message = msg;
-            return true;
+            return !std::exchange(sent, true);
         });
 
     EXPECT_CALL(*listeners[0], processMessage);
 
     handler.pollCanData();
 }
+
+TEST_F(CanRxHandlerTest, pollCanData_processes_every_pending_message)
+{
+    constructListeners();
+    for (auto &listener : listeners)
+    {
+        handler.attachReceiveHandler(listener.get());
+        EXPECT_CALL(*listener, processMessage);
+    }
+
+    uint32_t nextId = tap::motor::MOTOR1;
+    ON_CALL(drivers.can, getMessage(tap::can::CanBus::CAN_BUS1, _, _))
+        .WillByDefault([&](tap::can::CanBus, modm::can::Message *message, uint32_t *) {
+            if (nextId > tap::motor::MOTOR8)
+            {
+                return false;
+            }
+            *message = modm::can::Message(nextId++, 8, 0, false);
+            return true;
+        });
+
+    handler.pollCanData();
+
+    const auto &stats = handler.getRxStats(tap::can::CanBus::CAN_BUS1);
+    EXPECT_EQ(8u, stats.framesProcessed);
+    EXPECT_EQ(8u, stats.framesProcessedLastPoll);
+    EXPECT_FALSE(stats.framesPending);
+    EXPECT_EQ(0u, stats.pollsWithFramesPending);
+    EXPECT_EQ(0u, handler.getRxStats(tap::can::CanBus::CAN_BUS2).framesProcessed);
+}
+
+TEST_F(CanRxHandlerTest, pollCanData_stops_at_budget_and_reports_pending_messages)
+{
+    constructListeners();
+    handler.attachReceiveHandler(listeners[0].get());
+    handler.setPollBudget(3);
+
+    modm::can::Message msg(tap::motor::MOTOR1, 8, 0, false);
+    ON_CALL(drivers.can, getMessage(tap::can::CanBus::CAN_BUS1, _, _))
+        .WillByDefault([&](tap::can::CanBus, modm::can::Message *message, uint32_t *) {
+            *message = msg;
+            return true;
+        });
+    ON_CALL(drivers.can, isMessageAvailable(tap::can::CanBus::CAN_BUS1))
+        .WillByDefault(Return(true));
+
+    EXPECT_CALL(*listeners[0], processMessage).Times(6);
+
+    handler.pollCanData();
+    handler.pollCanData();
+
+    const auto &stats = handler.getRxStats(tap::can::CanBus::CAN_BUS1);
+    EXPECT_EQ(6u, stats.framesProcessed);
+    EXPECT_EQ(3u, stats.framesProcessedLastPoll);
+    EXPECT_EQ(3u, stats.maxFramesProcessedPerPoll);
+    EXPECT_TRUE(stats.framesPending);
+    EXPECT_EQ(2u, stats.pollsWithFramesPending);
+
+    handler.resetRxStats();
+    EXPECT_EQ(0u, handler.getRxStats(tap::can::CanBus::CAN_BUS1).framesProcessed);
+}
+
+TEST_F(CanRxHandlerTest, pollCanData_budget_exactly_used_up_without_pending_messages)
+{
+    handler.setPollBudget(1);
+
+    ON_CALL(drivers.can, getMessage(tap::can::CanBus::CAN_BUS1, _, _))
+        .WillByDefault([&](tap::can::CanBus, modm::can::Message *message, uint32_t *) {
+            *message = modm::can::Message(tap::motor::MOTOR1, 8, 0, false);
+            return true;
+        });
+    ON_CALL(drivers.can, isMessageAvailable(tap::can::CanBus::CAN_BUS1))
+        .WillByDefault(Return(false));
+
+    handler.pollCanData();
+
+    EXPECT_FALSE(handler.getRxStats(tap::can::CanBus::CAN_BUS1).framesPending);
+}
+
+TEST_F(CanRxHandlerTest, pollCanData_records_received_frames_in_bus_load_monitor)
+{
+    handler.setPollBudget(2);
+
+    ON_CALL(drivers.can, getMessage(tap::can::CanBus::CAN_BUS2, _, _))
+        .WillByDefault([&](tap::can::CanBus, modm::can::Message *message, uint32_t *) {
+            *message = modm::can::Message(tap::motor::MOTOR1, 8, 0, false);
+            return true;
+        });
+
+    handler.pollCanData();
+
+    auto &monitor = drivers.can.getBusLoadMonitor();
+    EXPECT_EQ(0u, monitor.getBusStats(tap::can::CanBus::CAN_BUS1).rxFrames);
+    EXPECT_EQ(2u, monitor.getBusStats(tap::can::CanBus::CAN_BUS2).rxFrames);
+}
+
+TEST_F(CanRxHandlerTest, pollCanData_drains_can_tx_queue)
+{
+    ON_CALL(drivers.can, isReadyToSend).WillByDefault(Return(false));
+    drivers.canTxQueue.queueMessage(
+        tap::can::CanBus::CAN_BUS1,
+        modm::can::Message(0x200, 8, 0, false),
+        tap::can::CanTxPriority::NORMAL,
+        tap::can::CanTxQueue::NO_DEADLINE);
+
+    ON_CALL(drivers.can, isReadyToSend).WillByDefault(Return(true));
+    EXPECT_CALL(drivers.can, sendMessage(tap::can::CanBus::CAN_BUS1, _)).WillOnce(Return(true));
+
+    handler.pollCanData();
+
+    EXPECT_EQ(0, drivers.canTxQueue.getNumQueued(tap::can::CanBus::CAN_BUS1));
+}
+
+TEST_F(CanRxHandlerTest, pollCanData_passes_arrival_time_to_listener)
+{
+    constructListeners();
+    handler.attachReceiveHandler(listeners[0].get());
+
+    bool sent = false;
+    ON_CALL(drivers.can, getMessage(tap::can::CanBus::CAN_BUS1, _, _))
+        .WillByDefault([&](tap::can::CanBus, modm::can::Message *message, uint32_t *arrivalTime) {
+            *message = modm::can::Message(tap::motor::MOTOR1, 8, 0, false);
+            *arrivalTime = 123'456;
+            return !std::exchange(sent, true);
+        });
+
+    uint32_t arrivalTime = 0;
+    EXPECT_CALL(*listeners[0], processMessage).WillOnce([&](const modm::can::Message &) {
+        arrivalTime = listeners[0]->getMessageArrivalTime();
+    });
+
+    handler.pollCanData();
+
+    EXPECT_EQ(123'456u, arrivalTime);
+}
+
+TEST_F(CanRxHandlerTest, pollCanData_records_received_messages_in_capture)
+{
+    tap::can::StaticCanCapture<4> capture;
+    capture.start();
+    drivers.can.setCapture(&capture);
+
+    bool sent = false;
+    ON_CALL(drivers.can, getMessage(tap::can::CanBus::CAN_BUS2, _, _))
+        .WillByDefault([&](tap::can::CanBus, modm::can::Message *message, uint32_t *arrivalTime) {
+            if (sent)
+            {
+                return false;
+            }
+            *message = modm::can::Message(tap::motor::MOTOR3, 8, 0, false);
+            *arrivalTime = 4321;
+            sent = true;
+            return true;
+        });
+
+    handler.pollCanData();
+
+    ASSERT_EQ(1u, capture.size());
+    EXPECT_EQ(tap::can::CanBus::CAN_BUS2, capture.getRecord(0).getBus());
+    EXPECT_EQ(static_cast<uint32_t>(tap::motor::MOTOR3), capture.getRecord(0).identifier);
+    EXPECT_EQ(4321u, capture.getRecord(0).timestamp);
+    EXPECT_FALSE(capture.getRecord(0).isTransmit());
+}
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2026 Advanced Robotics at the University of Washington <robomstr@uw.edu>
+ *
+ * This file is part of Taproot.
+ *
+ * Taproot is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Taproot is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Taproot.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "tap/communication/can/can_rx_ring.hpp"
+
+using tap::can::CanRxRing;
+using tap::can::TimestampedCanMessage;
+
+TEST(CanRxRing, new_ring_is_empty)
+{
+    CanRxRing ring;
+    TimestampedCanMessage frame;
+
+    EXPECT_TRUE(ring.empty());
+    EXPECT_EQ(0u, ring.size());
+    EXPECT_FALSE(ring.pop(&frame));
+    EXPECT_EQ(0u, ring.getOverflowCount());
+}
+
+TEST(CanRxRing, pop_returns_frames_in_order_with_arrival_time)
+{
+    CanRxRing ring;
+
+    EXPECT_TRUE(ring.push(modm::can::Message(0x201, 8, 1, false), 100));
+    EXPECT_TRUE(ring.push(modm::can::Message(0x202, 8, 2, false), 250));
+    EXPECT_EQ(2u, ring.size());
+
+    TimestampedCanMessage frame;
+    ASSERT_TRUE(ring.pop(&frame));
+    EXPECT_EQ(0x201u, frame.message.getIdentifier());
+    EXPECT_EQ(1, frame.message.data[0]);
+    EXPECT_EQ(100u, frame.arrivalTime);
+
+    ASSERT_TRUE(ring.pop(&frame));
+    EXPECT_EQ(0x202u, frame.message.getIdentifier());
+    EXPECT_EQ(250u, frame.arrivalTime);
+
+    EXPECT_TRUE(ring.empty());
+}
+
+TEST(CanRxRing, push_drops_and_counts_frames_when_full)
+{
+    CanRxRing ring;
+
+    for (uint32_t i = 0; i < CanRxRing::CAPACITY; i++)
+    {
+        EXPECT_TRUE(ring.push(modm::can::Message(i, 8, 0, false), i));
+    }
+    EXPECT_FALSE(ring.push(modm::can::Message(0x7ff, 8, 0, false), 0));
+    EXPECT_EQ(CanRxRing::CAPACITY, ring.size());
+    EXPECT_EQ(1u, ring.getOverflowCount());
+
+    // Frames already in the ring are kept, the newest one was dropped
+    TimestampedCanMessage frame;
+    ASSERT_TRUE(ring.pop(&frame));
+    EXPECT_EQ(0u, frame.message.getIdentifier());
+
+    EXPECT_TRUE(ring.push(modm::can::Message(0x7ff, 8, 0, false), 0));
+}
+
+TEST(CanRxRing, recordOverflow_counts_frames_lost_before_the_ring)
+{
+    CanRxRing ring;
+
+    ring.recordOverflow();
+    ring.recordOverflow();
+
+    EXPECT_EQ(2u, ring.getOverflowCount());
+    EXPECT_TRUE(ring.empty());
+}
+
+TEST(CanRxRing, indices_wrap_around_capacity)
+{
+    CanRxRing ring;
+    TimestampedCanMessage frame;
+
+    for (uint32_t i = 0; i < 5 * CanRxRing::CAPACITY + 3; i++)
+    {
+        ASSERT_TRUE(ring.push(modm::can::Message(i & 0x7ff, 8, 0, false), i));
+        ASSERT_TRUE(ring.pop(&frame));
+        EXPECT_EQ(i, frame.arrivalTime);
+        EXPECT_TRUE(ring.empty());
+    }
+    EXPECT_EQ(0u, ring.getOverflowCount());
+}
@@ -0,0 +1,221 @@
+/*
+ * Copyright (c) 2026 Advanced Robotics at the University of Washington <robomstr@uw.edu>
+ *
+ * This file is part of Taproot.
+ *
+ * Taproot is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Taproot is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Taproot.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "tap/architecture/clock.hpp"
+#include "tap/communication/can/can_terminal_handler.hpp"
+#include "tap/drivers.hpp"
+#include "tap/stub/terminal_device_stub.hpp"
+
+#include "modm/architecture/interface/can_message.hpp"
+
+using namespace tap;
+using namespace testing;
+using namespace tap::can;
+
+class CanTerminalHandlerTest : public Test
+{
+protected:
+    CanTerminalHandlerTest()
+        : serialHandler(&drivers),
+          terminalDevice(&drivers),
+          stream(terminalDevice)
+    {
+    }
+
+    arch::clock::ClockStub clock;
+    Drivers drivers;
+    CanTerminalHandler serialHandler;
+    tap::stub::TerminalDeviceStub terminalDevice;
+    modm::IOStream stream;
+};
+
+TEST_F(CanTerminalHandlerTest, init__adds_to_terminal_handler)
+{
+    EXPECT_CALL(drivers.terminalSerial, addHeader(_, &serialHandler));
+
+    serialHandler.init();
+}
+
+TEST_F(CanTerminalHandlerTest, terminalSerialCallback__prints_usage_if_invalid_input)
+{
+    char input[] = "sdsdf";
+    EXPECT_FALSE(serialHandler.terminalSerialCallback(input, stream, false));
+
+    EXPECT_THAT(terminalDevice.readAllItemsFromWriteBufferToString(), HasSubstr("Usage"));
+}
+
+TEST_F(CanTerminalHandlerTest, terminalSerialCallback__prints_usage_if_help_specified)
+{
+    char input[] = "-H";
+    EXPECT_TRUE(serialHandler.terminalSerialCallback(input, stream, false));
+
+    EXPECT_THAT(terminalDevice.readAllItemsFromWriteBufferToString(), HasSubstr("Usage"));
+}
+
+TEST_F(CanTerminalHandlerTest, terminalSerialCallback__load_prints_every_bus)
+{
+    CanBusLoadMonitor &monitor = drivers.can.getBusLoadMonitor();
+    modm::can::Message message(0x200, 8, 0, false);
+    for (int i = 0; i < 4000; i++)
+    {
+        monitor.recordTx(CanBus::CAN_BUS1, message, true);
+    }
+    monitor.recordTx(CanBus::CAN_BUS1, message, false);
+    clock.time = CanBusLoadMonitor::BUCKET_PERIOD_MS;
+
+    ON_CALL(drivers.can, getTransmitErrorCount(CanBus::CAN_BUS2)).WillByDefault(Return(128));
+    ON_CALL(drivers.can, getReceiveErrorCount(CanBus::CAN_BUS2)).WillByDefault(Return(3));
+    ON_CALL(drivers.can, getRxOverflowCount(CanBus::CAN_BUS2)).WillByDefault(Return(7));
+
+    char input[] = "load";
+    EXPECT_TRUE(serialHandler.terminalSerialCallback(input, stream, false));
+
+    uint32_t bits = 4000 * CanBusLoadMonitor::getFrameBits(message);
+    char expectedUtilization[16];
+    snprintf(expectedUtilization, sizeof(expectedUtilization), "%.1f", bits / 10000.0);
+
+    EXPECT_EQ(
+        "bus\tutil%\tpeak%\tbits\ttx\trx\ttxfail\ttec\trec\trxlost\n"
+        "can1\t" + std::string(expectedUtilization) + "\t" + std::string(expectedUtilization) +
+            "\t" + std::to_string(bits) + "\t4000\t0\t1\t0\t0\t0\n"
+            "can2\t0.0\t0.0\t0\t0\t0\t0\t128\t3\t7\n",
+        terminalDevice.readAllItemsFromWriteBufferToString());
+}
+
+TEST_F(CanTerminalHandlerTest, terminalSerialCallback__ids_prints_every_tracked_id)
+{
+    CanBusLoadMonitor &monitor = drivers.can.getBusLoadMonitor();
+    modm::can::Message command(0x1ff, 8, 0, false);
+    modm::can::Message revStatus(0x2051841, 8, 0, true);
+    monitor.recordTx(CanBus::CAN_BUS1, command, true);
+    monitor.recordRx(CanBus::CAN_BUS2, revStatus);
+    clock.time = CanBusLoadMonitor::BUCKET_PERIOD_MS;
+
+    char input[] = "ids";
+    EXPECT_TRUE(serialHandler.terminalSerialCallback(input, stream, false));
+
+    EXPECT_EQ(
+        "bus\tid\tdir\tbits\tfps\tframes\n"
+        "can1\t0x1ff\ttx\t" + std::to_string(CanBusLoadMonitor::getFrameBits(command)) +
+            "\t1\t1\n"
+            "can2\t0x02051841\trx\t" +
+            std::to_string(CanBusLoadMonitor::getFrameBits(revStatus)) +
+            "\t1\t1\n"
+            "untracked 0\n",
+        terminalDevice.readAllItemsFromWriteBufferToString());
+}
+
+TEST_F(CanTerminalHandlerTest, terminalSerialCallback__queue_prints_tx_queue_counters)
+{
+    ON_CALL(drivers.can, isReadyToSend).WillByDefault(Return(false));
+    drivers.canTxQueue.queueMessage(
+        CanBus::CAN_BUS2,
+        modm::can::Message(0x200, 8, 0, false),
+        CanTxPriority::NORMAL,
+        CanTxQueue::NO_DEADLINE);
+    drivers.canTxQueue.queueMessage(
+        CanBus::CAN_BUS2,
+        modm::can::Message(0x200, 8, 1, false),
+        CanTxPriority::NORMAL,
+        CanTxQueue::NO_DEADLINE);
+
+    char input[] = "queue";
+    EXPECT_TRUE(serialHandler.terminalSerialCallback(input, stream, false));
+
+    EXPECT_EQ(
+        "bus\tqueued\tmax\tsent\treplaced\texpired\tdropped\tfail\n"
+        "can1\t0\t0\t0\t0\t0\t0\t0\n"
+        "can2\t1\t1\t0\t1\t0\t0\t0\n",
+        terminalDevice.readAllItemsFromWriteBufferToString());
+}
+
+TEST_F(CanTerminalHandlerTest, terminalSerialCallback__reset_clears_monitor_and_rx_stats)
+{
+    CanBusLoadMonitor &monitor = drivers.can.getBusLoadMonitor();
+    monitor.recordRx(CanBus::CAN_BUS1, modm::can::Message(0x201, 8, 0, false));
+
+    EXPECT_CALL(drivers.canRxHandler, resetRxStats);
+
+    char input[] = "reset";
+    EXPECT_TRUE(serialHandler.terminalSerialCallback(input, stream, false));
+
+    EXPECT_EQ(0, monitor.getNumTrackedIds());
+    EXPECT_EQ(0u, monitor.getBusStats(CanBus::CAN_BUS1).rxFrames);
+}
+
+TEST_F(CanTerminalHandlerTest, terminalSerialCallback__reset_not_allowed_while_streaming)
+{
+    CanBusLoadMonitor &monitor = drivers.can.getBusLoadMonitor();
+    monitor.recordRx(CanBus::CAN_BUS1, modm::can::Message(0x201, 8, 0, false));
+
+    EXPECT_CALL(drivers.canRxHandler, resetRxStats).Times(0);
+
+    char input[] = "reset";
+    EXPECT_FALSE(serialHandler.terminalSerialCallback(input, stream, true));
+
+    EXPECT_EQ(1, monitor.getNumTrackedIds());
+}
+
+TEST_F(CanTerminalHandlerTest, terminalSerialCallback__capture_fails_without_capture_set)
+{
+    char input[] = "capture start";
+    EXPECT_FALSE(serialHandler.terminalSerialCallback(input, stream, false));
+
+    EXPECT_THAT(terminalDevice.readAllItemsFromWriteBufferToString(), HasSubstr("no capture"));
+}
+
+TEST_F(CanTerminalHandlerTest, terminalSerialCallback__capture_start_and_dump)
+{
+    StaticCanCapture<8> capture;
+    drivers.can.setCapture(&capture);
+
+    char start[] = "capture start";
+    EXPECT_TRUE(serialHandler.terminalSerialCallback(start, stream, false));
+    EXPECT_TRUE(capture.isRunning());
+    EXPECT_THAT(
+        terminalDevice.readAllItemsFromWriteBufferToString(),
+        HasSubstr("capture running, 0/8 frames"));
+
+    capture.record(CanBus::CAN_BUS1, modm::can::Message(0x201, 1, 0x7f, false), 1'500'000, false);
+    capture.record(CanBus::CAN_BUS2, modm::can::Message(0x1ff, 1, 0x01, false), 1'500'010, true);
+
+    char dump[] = "capture dump";
+    EXPECT_TRUE(serialHandler.terminalSerialCallback(dump, stream, false));
+    EXPECT_EQ(
+        "(1.500000) can1 201#7F R\n(1.500010) can2 1FF#01 T\n",
+        terminalDevice.readAllItemsFromWriteBufferToString());
+
+    char stop[] = "capture stop";
+    EXPECT_TRUE(serialHandler.terminalSerialCallback(stop, stream, false));
+    EXPECT_FALSE(capture.isRunning());
+    EXPECT_EQ(2u, capture.size());
+}
+
+TEST_F(CanTerminalHandlerTest, terminalSerialCallback__capture_not_allowed_while_streaming)
+{
+    StaticCanCapture<8> capture;
+    drivers.can.setCapture(&capture);
+
+    char input[] = "capture start";
+    EXPECT_FALSE(serialHandler.terminalSerialCallback(input, stream, true));
+
+    EXPECT_FALSE(capture.isRunning());
+}
@@ -0,0 +1,241 @@
+/*
+ * Copyright (c) 2026 Advanced Robotics at the University of Washington <robomstr@uw.edu>
+ *
+ * This file is part of Taproot.
+ *
+ * Taproot is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Taproot is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Taproot.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "tap/architecture/clock.hpp"
+#include "tap/communication/can/can_tx_queue.hpp"
+#include "tap/drivers.hpp"
+
+using namespace testing;
+using namespace tap;
+using namespace tap::can;
+
+class CanTxQueueTest : public Test
+{
+protected:
+    CanTxQueueTest() : queue(&drivers) {}
+
+    void SetUp() override
+    {
+        ON_CALL(drivers.can, isReadyToSend).WillByDefault(Return(true));
+        ON_CALL(drivers.can, sendMessage)
+            .WillByDefault([this](CanBus bus, const modm::can::Message &message) {
+                sent.push_back({bus, message});
+                return true;
+            });
+    }
+
+    static modm::can::Message makeMessage(uint32_t id, uint64_t data = 0)
+    {
+        return modm::can::Message(id, 8, data, false);
+    }
+
+    arch::clock::ClockStub clock;
+    Drivers drivers;
+    CanTxQueue queue;
+    std::vector<std::pair<CanBus, modm::can::Message>> sent;
+};
+
+TEST_F(CanTxQueueTest, queueMessage_sends_immediately_when_bus_ready)
+{
+    EXPECT_TRUE(queue.queueMessage(CanBus::CAN_BUS1, makeMessage(0x200, 1)));
+
+    ASSERT_EQ(1u, sent.size());
+    EXPECT_EQ(CanBus::CAN_BUS1, sent[0].first);
+    EXPECT_EQ(makeMessage(0x200, 1), sent[0].second);
+    EXPECT_EQ(0, queue.getNumQueued(CanBus::CAN_BUS1));
+    EXPECT_EQ(1u, queue.getTxQueueStats(CanBus::CAN_BUS1).sent);
+}
+
+TEST_F(CanTxQueueTest, queueMessage_waits_while_bus_busy_and_drain_sends_later)
+{
+    ON_CALL(drivers.can, isReadyToSend).WillByDefault(Return(false));
+
+    queue.queueMessage(CanBus::CAN_BUS1, makeMessage(0x200));
+    queue.queueMessage(CanBus::CAN_BUS2, makeMessage(0x1ff));
+
+    EXPECT_TRUE(sent.empty());
+    EXPECT_EQ(1, queue.getNumQueued(CanBus::CAN_BUS1));
+    EXPECT_EQ(1, queue.getNumQueued(CanBus::CAN_BUS2));
+
+    ON_CALL(drivers.can, isReadyToSend).WillByDefault(Return(true));
+    queue.drain();
+
+    ASSERT_EQ(2u, sent.size());
+    EXPECT_EQ(CanBus::CAN_BUS1, sent[0].first);
+    EXPECT_EQ(CanBus::CAN_BUS2, sent[1].first);
+    EXPECT_EQ(0, queue.getNumQueued(CanBus::CAN_BUS1));
+}
+
+TEST_F(CanTxQueueTest, queueMessage_same_id_replaces_waiting_payload_and_keeps_place)
+{
+    ON_CALL(drivers.can, isReadyToSend).WillByDefault(Return(false));
+
+    queue.queueMessage(CanBus::CAN_BUS1, makeMessage(0x200, 1));
+    queue.queueMessage(CanBus::CAN_BUS1, makeMessage(0x1ff, 2));
+    queue.queueMessage(CanBus::CAN_BUS1, makeMessage(0x200, 3));
+
+    EXPECT_EQ(2, queue.getNumQueued(CanBus::CAN_BUS1));
+    EXPECT_EQ(1u, queue.getTxQueueStats(CanBus::CAN_BUS1).replaced);
+
+    ON_CALL(drivers.can, isReadyToSend).WillByDefault(Return(true));
+    queue.drain();
+
+    ASSERT_EQ(2u, sent.size());
+    EXPECT_EQ(makeMessage(0x200, 3), sent[0].second);
+    EXPECT_EQ(makeMessage(0x1ff, 2), sent[1].second);
+}
+
+TEST_F(CanTxQueueTest, queueMessage_same_id_different_id_type_not_replaced)
+{
+    ON_CALL(drivers.can, isReadyToSend).WillByDefault(Return(false));
+
+    queue.queueMessage(CanBus::CAN_BUS1, modm::can::Message(0x200, 8, 0, false));
+    queue.queueMessage(CanBus::CAN_BUS1, modm::can::Message(0x200, 8, 0, true));
+    queue.queueMessage(CanBus::CAN_BUS2, modm::can::Message(0x200, 8, 0, false));
+
+    EXPECT_EQ(2, queue.getNumQueued(CanBus::CAN_BUS1));
+    EXPECT_EQ(1, queue.getNumQueued(CanBus::CAN_BUS2));
+    EXPECT_EQ(0u, queue.getTxQueueStats(CanBus::CAN_BUS1).replaced);
+}
+
+TEST_F(CanTxQueueTest, drain_sends_higher_priority_first_then_in_queued_order)
+{
+    ON_CALL(drivers.can, isReadyToSend).WillByDefault(Return(false));
+
+    queue.queueMessage(CanBus::CAN_BUS1, makeMessage(1), CanTxPriority::LOW);
+    queue.queueMessage(CanBus::CAN_BUS1, makeMessage(2), CanTxPriority::NORMAL);
+    queue.queueMessage(CanBus::CAN_BUS1, makeMessage(3), CanTxPriority::HIGH);
+    queue.queueMessage(CanBus::CAN_BUS1, makeMessage(4), CanTxPriority::NORMAL);
+    queue.queueMessage(CanBus::CAN_BUS1, makeMessage(5), CanTxPriority::HIGH);
+
+    ON_CALL(drivers.can, isReadyToSend).WillByDefault(Return(true));
+    queue.drain();
+
+    std::vector<uint32_t> order;
+    for (const auto &frame : sent)
+    {
+        order.push_back(frame.second.getIdentifier());
+    }
+    EXPECT_EQ(std::vector<uint32_t>({3, 5, 2, 4, 1}), order);
+}
+
+TEST_F(CanTxQueueTest, drain_stops_when_bus_no_longer_ready)
+{
+    ON_CALL(drivers.can, isReadyToSend).WillByDefault(Return(false));
+    for (uint32_t id = 0; id < 5; id++)
+    {
+        queue.queueMessage(CanBus::CAN_BUS1, makeMessage(id));
+    }
+
+    // Three free mailboxes
+    EXPECT_CALL(drivers.can, isReadyToSend(CanBus::CAN_BUS1))
+        .WillOnce(Return(true))
+        .WillOnce(Return(true))
+        .WillOnce(Return(true))
+        .WillRepeatedly(Return(false));
+    queue.drain(CanBus::CAN_BUS1);
+
+    EXPECT_EQ(3u, sent.size());
+    EXPECT_EQ(2, queue.getNumQueued(CanBus::CAN_BUS1));
+}
+
+TEST_F(CanTxQueueTest, drain_keeps_frame_and_raises_error_if_sendMessage_fails)
+{
+    ON_CALL(drivers.can, sendMessage).WillByDefault(Return(false));
+
+    EXPECT_CALL(drivers.errorController, addToErrorList);
+
+    queue.queueMessage(CanBus::CAN_BUS1, makeMessage(0x200));
+
+    EXPECT_EQ(1, queue.getNumQueued(CanBus::CAN_BUS1));
+    EXPECT_EQ(1u, queue.getTxQueueStats(CanBus::CAN_BUS1).sendFailures);
+    EXPECT_EQ(0u, queue.getTxQueueStats(CanBus::CAN_BUS1).sent);
+}
+
+TEST_F(CanTxQueueTest, drain_discards_frames_past_deadline_and_raises_error)
+{
+    ON_CALL(drivers.can, isReadyToSend).WillByDefault(Return(false));
+
+    EXPECT_CALL(drivers.errorController, addToErrorList);
+
+    queue.queueMessage(CanBus::CAN_BUS1, makeMessage(1), CanTxPriority::HIGH, 2000);
+    queue.queueMessage(CanBus::CAN_BUS1, makeMessage(2), CanTxPriority::HIGH, 5000);
+    queue.queueMessage(CanBus::CAN_BUS1, makeMessage(3));
+
+    clock.time = 2;
+    queue.drain();
+    EXPECT_EQ(3, queue.getNumQueued(CanBus::CAN_BUS1));
+
+    clock.time = 3;
+    ON_CALL(drivers.can, isReadyToSend).WillByDefault(Return(true));
+    queue.drain();
+
+    ASSERT_EQ(2u, sent.size());
+    EXPECT_EQ(2u, sent[0].second.getIdentifier());
+    EXPECT_EQ(3u, sent[1].second.getIdentifier());
+    EXPECT_EQ(1u, queue.getTxQueueStats(CanBus::CAN_BUS1).expired);
+}
+
+TEST_F(CanTxQueueTest, queueMessage_replacing_frame_renews_deadline)
+{
+    ON_CALL(drivers.can, isReadyToSend).WillByDefault(Return(false));
+
+    queue.queueMessage(CanBus::CAN_BUS1, makeMessage(1, 1), CanTxPriority::HIGH, 2000);
+    clock.time = 2;
+    queue.queueMessage(CanBus::CAN_BUS1, makeMessage(1, 2), CanTxPriority::HIGH, 2000);
+    clock.time = 3;
+
+    ON_CALL(drivers.can, isReadyToSend).WillByDefault(Return(true));
+    queue.drain();
+
+    ASSERT_EQ(1u, sent.size());
+    EXPECT_EQ(makeMessage(1, 2), sent[0].second);
+}
+
+TEST_F(CanTxQueueTest, queueMessage_full_queue_evicts_lower_priority_frame)
+{
+    ON_CALL(drivers.can, isReadyToSend).WillByDefault(Return(false));
+
+    for (uint32_t id = 0; id < CanTxQueue::CAPACITY - 1; id++)
+    {
+        EXPECT_TRUE(queue.queueMessage(CanBus::CAN_BUS1, makeMessage(id), CanTxPriority::HIGH));
+    }
+    EXPECT_TRUE(queue.queueMessage(CanBus::CAN_BUS1, makeMessage(0x100), CanTxPriority::LOW));
+
+    // Same priority as everything queued, rejected
+    EXPECT_FALSE(queue.queueMessage(CanBus::CAN_BUS1, makeMessage(0x101), CanTxPriority::LOW));
+    // Higher priority, evicts the low priority frame
+    EXPECT_TRUE(queue.queueMessage(CanBus::CAN_BUS1, makeMessage(0x102), CanTxPriority::NORMAL));
+    // Replacing a waiting frame never needs space
+    EXPECT_TRUE(queue.queueMessage(CanBus::CAN_BUS1, makeMessage(0), CanTxPriority::HIGH));
+
+    EXPECT_EQ(CanTxQueue::CAPACITY, queue.getNumQueued(CanBus::CAN_BUS1));
+    EXPECT_EQ(2u, queue.getTxQueueStats(CanBus::CAN_BUS1).dropped);
+    EXPECT_EQ(CanTxQueue::CAPACITY, queue.getTxQueueStats(CanBus::CAN_BUS1).maxQueued);
+
+    ON_CALL(drivers.can, isReadyToSend).WillByDefault(Return(true));
+    queue.drain();
+
+    ASSERT_EQ(CanTxQueue::CAPACITY, sent.size());
+    EXPECT_EQ(0x102u, sent.back().second.getIdentifier());
+}
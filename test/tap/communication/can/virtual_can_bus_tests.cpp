@@ -0,0 +1,264 @@
+/*
+ * Copyright (c) 2026 Advanced Robotics at the University of Washington <robomstr@uw.edu>
+ *
+ * This file is part of Taproot.
+ *
+ * Taproot is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Taproot is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Taproot.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "tap/communication/can/can_bus_load_monitor.hpp"
+#include "tap/communication/can/virtual_can_bus.hpp"
+#include "tap/communication/can/virtual_can_controller.hpp"
+
+using namespace tap::can;
+
+/**
+ * Records every frame it receives and sends the frames it is given on its first update.
+ */
+class RecordingNode : public VirtualCanNode
+{
+public:
+    struct ReceivedFrame
+    {
+        uint32_t identifier;
+        uint64_t time;
+    };
+
+    void onFrameReceived(const modm::can::Message &message, uint64_t time) override
+    {
+        received.push_back({message.getIdentifier(), time});
+    }
+
+    void onFrameTransmitted(const modm::can::Message &, uint64_t time) override
+    {
+        transmitTimes.push_back(time);
+    }
+
+    uint64_t update(uint64_t time) override
+    {
+        updateTimes.push_back(time);
+        return updatePeriod == 0 ? NO_UPDATE : time + updatePeriod;
+    }
+
+    std::vector<ReceivedFrame> received;
+    std::vector<uint64_t> transmitTimes;
+    std::vector<uint64_t> updateTimes;
+    uint64_t updatePeriod = 0;
+};
+
+class VirtualCanBusTest : public testing::Test
+{
+protected:
+    VirtualCanBusTest()
+    {
+        bus.attachNode(&a);
+        bus.attachNode(&b);
+        bus.attachNode(&listener);
+        bus.advanceTo(0);
+    }
+
+    VirtualCanBus bus;
+    RecordingNode a;
+    RecordingNode b;
+    RecordingNode listener;
+};
+
+TEST_F(VirtualCanBusTest, frame_is_delivered_once_end_of_frame_is_sent)
+{
+    modm::can::Message message(0x201, 8, 0x1234, false);
+    uint32_t frameTime = bus.getFrameTime(message);
+    EXPECT_EQ(CanBusLoadMonitor::getFrameBits(message), frameTime);
+
+    bus.transmit(&a, message);
+    bus.advanceTo(frameTime - VirtualCanBus::INTERFRAME_SPACE_BITS - 1);
+    EXPECT_TRUE(listener.received.empty());
+
+    bus.advanceTo(frameTime);
+    ASSERT_EQ(1u, listener.received.size());
+    EXPECT_EQ(0x201u, listener.received[0].identifier);
+    EXPECT_EQ(frameTime - VirtualCanBus::INTERFRAME_SPACE_BITS, listener.received[0].time);
+    ASSERT_EQ(1u, b.received.size());
+    EXPECT_TRUE(a.received.empty());
+    ASSERT_EQ(1u, a.transmitTimes.size());
+    EXPECT_EQ(1u, bus.getFramesSent());
+}
+
+TEST_F(VirtualCanBusTest, lowest_identifier_wins_arbitration)
+{
+    bus.transmit(&a, modm::can::Message(0x205, 8, 0, false));
+    bus.transmit(&b, modm::can::Message(0x201, 8, 0, false));
+    bus.transmit(&a, modm::can::Message(0x203, 8, 0, false));
+
+    bus.advanceTo(10'000);
+
+    ASSERT_EQ(3u, listener.received.size());
+    EXPECT_EQ(0x201u, listener.received[0].identifier);
+    EXPECT_EQ(0x203u, listener.received[1].identifier);
+    EXPECT_EQ(0x205u, listener.received[2].identifier);
+}
+
+TEST_F(VirtualCanBusTest, frames_wait_for_busy_bus)
+{
+    modm::can::Message first(0x300, 8, 0, false);
+    modm::can::Message second(0x100, 8, 0, false);
+
+    bus.transmit(&a, first);
+    bus.advanceTo(10);
+    // Higher priority, but queued after the first frame started
+    bus.transmit(&b, second);
+    bus.advanceTo(10'000);
+
+    ASSERT_EQ(2u, listener.received.size());
+    EXPECT_EQ(0x300u, listener.received[0].identifier);
+    EXPECT_EQ(0x100u, listener.received[1].identifier);
+    EXPECT_EQ(
+        bus.getFrameTime(first) + bus.getFrameTime(second) - VirtualCanBus::INTERFRAME_SPACE_BITS,
+        listener.received[1].time);
+}
+
+TEST_F(VirtualCanBusTest, frame_queued_on_idle_bus_starts_immediately)
+{
+    bus.advanceTo(5'000);
+    modm::can::Message message(0x200, 8, 0, false);
+    bus.transmit(&a, message);
+    bus.advanceTo(10'000);
+
+    ASSERT_EQ(1u, listener.received.size());
+    EXPECT_EQ(
+        5'000 + bus.getFrameTime(message) - VirtualCanBus::INTERFRAME_SPACE_BITS,
+        listener.received[0].time);
+}
+
+TEST(VirtualCanBus, getArbitrationKey_orders_frames_like_the_wire)
+{
+    auto key = [](uint32_t id, bool extended, bool remote = false) {
+        modm::can::Message message(id, 0, 0, extended);
+        message.setRemoteTransmitRequest(remote);
+        return VirtualCanBus::getArbitrationKey(message);
+    };
+
+    EXPECT_LT(key(0x100, false), key(0x101, false));
+    // Data frame beats remote frame with the same identifier
+    EXPECT_LT(key(0x100, false), key(0x100, false, true));
+    // Standard frame beats extended frame with the same base identifier, even a remote one
+    EXPECT_LT(key(0x100, false, true), key(0x100 << 18, true));
+    // Only the base identifier is compared before the IDE bit
+    EXPECT_LT(key((0x0ff << 18) | 0x3'ffff, true), key(0x100, false));
+    EXPECT_LT(key(0x0205'0001, true), key(0x0205'0002, true));
+}
+
+TEST_F(VirtualCanBusTest, nodes_are_updated_at_requested_times)
+{
+    RecordingNode periodic;
+    periodic.updatePeriod = 1'000;
+    bus.advanceTo(500);
+    bus.attachNode(&periodic);
+
+    bus.advanceTo(3'600);
+
+    EXPECT_EQ(std::vector<uint64_t>({500, 1'500, 2'500, 3'500}), periodic.updateTimes);
+    bus.detachNode(&periodic);
+}
+
+TEST(VirtualCanBus, first_advanceTo_starts_bus_at_that_time)
+{
+    constexpr uint64_t START = 3'600'000'000;
+
+    VirtualCanBus bus;
+    RecordingNode periodic;
+    RecordingNode sender;
+    RecordingNode listener;
+    periodic.updatePeriod = 1'000;
+    bus.attachNode(&periodic);
+    bus.attachNode(&sender);
+    bus.attachNode(&listener);
+
+    modm::can::Message message(0x201, 8, 0, false);
+    bus.transmit(&sender, message);
+    bus.advanceTo(START);
+
+    EXPECT_EQ(START, bus.getTime());
+    EXPECT_EQ(std::vector<uint64_t>({START}), periodic.updateTimes);
+    EXPECT_TRUE(listener.received.empty());
+
+    bus.advanceTo(START + 1'500);
+
+    EXPECT_EQ(std::vector<uint64_t>({START, START + 1'000}), periodic.updateTimes);
+    ASSERT_EQ(1u, listener.received.size());
+    EXPECT_EQ(
+        START + bus.getFrameTime(message) - VirtualCanBus::INTERFRAME_SPACE_BITS,
+        listener.received[0].time);
+}
+
+TEST_F(VirtualCanBusTest, detachNode_discards_waiting_frames)
+{
+    bus.transmit(&a, modm::can::Message(0x201, 8, 0, false));
+    bus.transmit(&b, modm::can::Message(0x202, 8, 0, false));
+    EXPECT_EQ(2u, bus.getNumWaiting());
+
+    bus.detachNode(&b);
+    bus.advanceTo(10'000);
+
+    ASSERT_EQ(1u, listener.received.size());
+    EXPECT_EQ(0x201u, listener.received[0].identifier);
+}
+
+TEST(VirtualCanController, mailboxes_free_up_once_frames_are_sent)
+{
+    VirtualCanBus bus;
+    VirtualCanController controller(&bus);
+    RecordingNode device;
+    bus.attachNode(&device);
+    bus.advanceTo(0);
+
+    modm::can::Message message(0x200, 8, 0, false);
+    for (int i = 0; i < VirtualCanController::NUM_TX_MAILBOXES; i++)
+    {
+        EXPECT_TRUE(controller.sendMessage(message));
+    }
+    EXPECT_FALSE(controller.isReadyToSend());
+    EXPECT_FALSE(controller.sendMessage(message));
+
+    bus.advanceTo(bus.getFrameTime(message));
+
+    EXPECT_TRUE(controller.isReadyToSend());
+    EXPECT_EQ(1u, device.received.size());
+}
+
+TEST(VirtualCanController, received_frames_are_read_with_arrival_time)
+{
+    VirtualCanBus bus;
+    VirtualCanController controller(&bus);
+    RecordingNode device;
+    bus.attachNode(&device);
+    bus.advanceTo(0);
+
+    modm::can::Message message(0x201, 8, 0xff, false);
+    bus.transmit(&device, message);
+    EXPECT_FALSE(controller.isMessageAvailable());
+
+    bus.advanceTo(1'000);
+
+    modm::can::Message received;
+    uint32_t arrivalTime = 0;
+    ASSERT_TRUE(controller.getMessage(&received, &arrivalTime));
+    EXPECT_EQ(0x201u, received.getIdentifier());
+    EXPECT_EQ(0xff, received.data[0]);
+    EXPECT_EQ(bus.getFrameTime(message) - VirtualCanBus::INTERFRAME_SPACE_BITS, arrivalTime);
+    EXPECT_FALSE(controller.getMessage(&received, nullptr));
+}
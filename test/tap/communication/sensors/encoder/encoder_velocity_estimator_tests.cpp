@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2026 Advanced Robotics at the University of Washington <robomstr@uw.edu>
+ *
+ * This file is part of Taproot.
+ *
+ * Taproot is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Taproot is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Taproot.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <cmath>
+
+#include <gtest/gtest.h>
+
+#include "tap/communication/sensors/encoder/encoder_velocity_estimator.hpp"
+
+using namespace tap::encoder;
+
+static constexpr float TICK = 2 * M_PI / 8192;
+
+/**
+ * Feeds `estimator` 1 kHz measurements of a shaft starting at rest with constant acceleration
+ * `acceleration` from `initialVelocity`, quantized to 8192 ticks per revolution. The reported
+ * velocity is rounded to whole RPM. Error statistics are collected after `settleUpdates`.
+ *
+ * @return The true velocity after the last update.
+ */
+static float simulate(
+    EncoderVelocityEstimator &estimator,
+    float initialVelocity,
+    float acceleration,
+    int updates,
+    float *maxVelocityError = nullptr,
+    float *meanAcceleration = nullptr,
+    int settleUpdates = 0)
+{
+    double position = 0;
+    int64_t lastTicks = 0;
+    float velocity = initialVelocity;
+    for (int i = 1; i <= updates; i++)
+    {
+        position += velocity * 1e-3 + 0.5 * acceleration * 1e-6;
+        velocity += acceleration * 1e-3f;
+
+        int64_t ticks = std::floor(position / TICK);
+        float reportedVelocity = std::round(velocity * 60 / (2 * M_PI)) * 2 * M_PI / 60;
+        estimator.update((ticks - lastTicks) * TICK, reportedVelocity, i * 1000);
+        lastTicks = ticks;
+
+        if (maxVelocityError != nullptr && i > settleUpdates)
+        {
+            *maxVelocityError =
+                std::max(*maxVelocityError, std::abs(estimator.getVelocity() - velocity));
+        }
+        if (meanAcceleration != nullptr && i > settleUpdates)
+        {
+            *meanAcceleration += estimator.getAcceleration() / (updates - settleUpdates);
+        }
+    }
+    return velocity;
+}
+
+TEST(EncoderVelocityEstimator, first_update_starts_at_reported_velocity)
+{
+    EncoderVelocityEstimator estimator;
+    EXPECT_FALSE(estimator.isInitialized());
+
+    estimator.update(1, 5, 1000);
+
+    EXPECT_TRUE(estimator.isInitialized());
+    EXPECT_FLOAT_EQ(5, estimator.getVelocity());
+    EXPECT_FLOAT_EQ(0, estimator.getAcceleration());
+}
+
+TEST(EncoderVelocityEstimator, tracks_low_constant_velocity_with_less_noise_than_ticks)
+{
+    EncoderVelocityEstimator estimator;
+    float maxError = 0;
+
+    float meanAcceleration = 0;
+
+    simulate(estimator, 1, 0, 3000, &maxError, &meanAcceleration, 1000);
+
+    // A single tick per update is an error of 0.77 rad/s when differentiated directly, and the
+    // reported RPM is off by up to 0.05 rad/s
+    EXPECT_LT(maxError, 0.05f);
+    EXPECT_NEAR(0, meanAcceleration, 0.5f);
+}
+
+TEST(EncoderVelocityEstimator, tracks_constant_acceleration_without_lag)
+{
+    EncoderVelocityEstimator estimator;
+    float maxError = 0;
+
+    float meanAcceleration = 0;
+
+    simulate(estimator, 0, 20, 3000, &maxError, &meanAcceleration, 1000);
+
+    EXPECT_LT(maxError, 0.1f);
+    EXPECT_NEAR(20, meanAcceleration, 0.5f);
+}
+
+TEST(EncoderVelocityEstimator, update_at_same_time_ignored)
+{
+    EncoderVelocityEstimator estimator;
+    estimator.update(0, 0, 1000);
+
+    estimator.update(1, 0, 1000);
+
+    EXPECT_FLOAT_EQ(0, estimator.getVelocity());
+    EXPECT_FLOAT_EQ(0, estimator.getAcceleration());
+}
+
+TEST(EncoderVelocityEstimator, restarts_after_long_gap)
+{
+    EncoderVelocityEstimatorConfig config;
+    config.maxUpdatePeriodUs = 5000;
+    EncoderVelocityEstimator estimator(config);
+    simulate(estimator, 10, 0, 100);
+
+    estimator.update(100, 2, 100'000 + 5001);
+
+    EXPECT_FLOAT_EQ(2, estimator.getVelocity());
+    EXPECT_FLOAT_EQ(0, estimator.getAcceleration());
+}
+
+TEST(EncoderVelocityEstimator, reported_velocity_weight_of_one_follows_reported_velocity)
+{
+    EncoderVelocityEstimatorConfig config;
+    config.reportedVelocityWeight = 1;
+    EncoderVelocityEstimator estimator(config);
+
+    estimator.update(0, 0, 1000);
+    estimator.update(0.1f, 3, 2000);
+
+    EXPECT_FLOAT_EQ(3, estimator.getVelocity());
+}
+
+TEST(EncoderVelocityEstimator, reset_forgets_updates)
+{
+    EncoderVelocityEstimator estimator;
+    simulate(estimator, 10, 0, 100);
+
+    estimator.reset();
+
+    EXPECT_FALSE(estimator.isInitialized());
+    EXPECT_FLOAT_EQ(0, estimator.getVelocity());
+}
@@ -299,6 +299,16 @@ TEST(MultiEncoderTests, get_velocity_averages_no_online_velocities_without_prima
     EXPECT_FLOAT_EQ(multi.getVelocity(), 0);
 }
 
+TEST(MultiEncoderTests, get_acceleration_averages_online_accelerations)
+{
+    SETUP_TEST(true, true);
+
+    EXPECT_CALL(mock, getAcceleration).WillOnce(Return(3));
+    EXPECT_CALL(mock2, getAcceleration).WillOnce(Return(1));
+
+    EXPECT_FLOAT_EQ(multi.getAcceleration(), 2);
+}
+
 TEST(MultiEncoderTests, get_velocity_averages_offline)
 {
     SETUP_TEST(false, false);
@@ -112,6 +112,25 @@ TEST(WrappedEncoder, calculates_velocity_correctly)
     EXPECT_FLOAT_EQ(M_PI_2, encoder.getVelocity());
 }
 
+TEST(WrappedEncoder, calculates_acceleration_correctly)
+{
+    tap::arch::clock::ClockStub clock;
+    WrappedEncoder encoder(false, 8);
+
+    clock.time = 1000;
+    encoder.updateEncoderValue(0);
+    clock.time = 2000;
+    encoder.updateEncoderValue(1);
+    clock.time = 3000;
+    encoder.updateEncoderValue(2);
+    EXPECT_NEAR(0, encoder.getAcceleration(), 1e-5);
+
+    // 1 s later, 2 ticks instead of 1
+    clock.time = 4000;
+    encoder.updateEncoderValue(4);
+    EXPECT_NEAR(M_PI_4, encoder.getAcceleration(), 1e-5);
+}
+
 TEST(WrappedEncoder, calculates_velocity_through_time_wrap)
 {
     tap::arch::clock::ClockStub clock;
@@ -17,6 +17,11 @@
  * along with Taproot.  If not, see <https://www.gnu.org/licenses/>.
  */
 
+#include <cmath>
+#include <cstring>
+#include <memory>
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include "tap/architecture/clock.hpp"
@@ -321,7 +326,7 @@ TEST(CommandScheduler, addCommand_successfully_removes_previously_added_command_
 
     set<Subsystem *> cmdMockRequirement{&s};
     EXPECT_CALL(c1, getRequirementsBitwise)
-        .Times(3)
+        .Times(2)
         .WillRepeatedly(Return(calcRequirementsBitwise(cmdMockRequirement)));
     EXPECT_CALL(c1, initialize);
     EXPECT_CALL(c1, end);
@@ -359,7 +364,7 @@ TEST(
     set<Subsystem *> subRequirementsC2{&s1, &s2, &s3};
 
     EXPECT_CALL(c1, getRequirementsBitwise)
-        .Times(3)
+        .Times(2)
         .WillRepeatedly(Return(calcRequirementsBitwise(subRequirementsC1)));
     EXPECT_CALL(c1, initialize);
     EXPECT_CALL(c1, end);
@@ -403,7 +408,7 @@ TEST(
     set<Subsystem *> subRequirementsC2{&s2, &s3};
 
     EXPECT_CALL(c1, getRequirementsBitwise)
-        .Times(3)
+        .Times(2)
         .WillRepeatedly(Return(calcRequirementsBitwise(subRequirementsC1)));
     EXPECT_CALL(c1, initialize);
     EXPECT_CALL(c1, end);
@@ -450,7 +455,7 @@ TEST(
     set<Subsystem *> subRequirementsC3{&s1};
 
     EXPECT_CALL(c1, getRequirementsBitwise)
-        .Times(3)
+        .Times(2)
         .WillRepeatedly(Return(calcRequirementsBitwise(subRequirementsC1)));
     EXPECT_CALL(c1, initialize);
     EXPECT_CALL(c1, end);
@@ -499,7 +504,7 @@ TEST(
     set<Subsystem *> subRequirementsC2{&s1, &s2};
 
     EXPECT_CALL(c1, getRequirementsBitwise)
-        .Times(3)
+        .Times(2)
         .WillRepeatedly(Return(calcRequirementsBitwise(subRequirementsC1)));
     EXPECT_CALL(c1, initialize);
     EXPECT_CALL(c1, end);
@@ -549,17 +554,17 @@ TEST(CommandScheduler, addCommand_add_multiple_commands_with_overlapping_sub_req
     set<Subsystem *> subRequirementsC4{&s2, &s3, &s5};
 
     EXPECT_CALL(c1, getRequirementsBitwise)
-        .Times(3)
+        .Times(2)
         .WillRepeatedly(Return(calcRequirementsBitwise(subRequirementsC1)));
     EXPECT_CALL(c1, initialize);
     EXPECT_CALL(c1, end);
     EXPECT_CALL(c2, getRequirementsBitwise)
-        .Times(4)
+        .Times(2)
         .WillRepeatedly(Return(calcRequirementsBitwise(subRequirementsC2)));
     EXPECT_CALL(c2, initialize);
     EXPECT_CALL(c2, end);
     EXPECT_CALL(c3, getRequirementsBitwise)
-        .Times(3)
+        .Times(2)
         .WillRepeatedly(Return(calcRequirementsBitwise(subRequirementsC3)));
     EXPECT_CALL(c3, initialize);
     EXPECT_CALL(c3, end);
@@ -840,8 +845,7 @@ TEST(CommandScheduler, run_with_many_registered_subsystems_and_commands_calls_re
         EXPECT_CALL(*cmds[i], execute).Times(RUN_TIMES);
         EXPECT_CALL(*cmds[i], isFinished).Times(RUN_TIMES).WillRepeatedly(Return(false));
         EXPECT_CALL(*cmds[i], getRequirementsBitwise)
-            .Times(CMDS_AND_SUBS_TO_ADD - i)
-            .WillRepeatedly(Return(calcRequirementsBitwise(cmdRequirements[i])));
+            .WillOnce(Return(calcRequirementsBitwise(cmdRequirements[i])));
         EXPECT_CALL(*cmds[i], initialize);
 
         scheduler.registerSubsystem(subs[i]);
@@ -889,12 +893,10 @@ TEST(CommandScheduler, addCommand_disjoint_required_subsystems_successfully_adde
     set<Subsystem *> subRequirementsC3{&s4, &s6};
 
     EXPECT_CALL(c1, getRequirementsBitwise)
-        .Times(3)
-        .WillRepeatedly(Return(calcRequirementsBitwise(subRequirementsC1)));
+        .WillOnce(Return(calcRequirementsBitwise(subRequirementsC1)));
     EXPECT_CALL(c1, initialize);
     EXPECT_CALL(c2, getRequirementsBitwise)
-        .Times(2)
-        .WillRepeatedly(Return(calcRequirementsBitwise(subRequirementsC2)));
+        .WillOnce(Return(calcRequirementsBitwise(subRequirementsC2)));
     EXPECT_CALL(c2, initialize);
     EXPECT_CALL(c3, getRequirementsBitwise)
         .Times(1)
@@ -1048,7 +1050,7 @@ TEST(
 
     EXPECT_CALL(c1, initialize);
     EXPECT_CALL(c1, getRequirementsBitwise)
-        .Times(3)
+        .Times(2)
         .WillRepeatedly(Return(calcRequirementsBitwise(subRequirementsC1)));
     EXPECT_CALL(s2, getDefaultCommand).WillOnce(Return(&c2));
 
@@ -1422,9 +1424,7 @@ TEST(CommandScheduler, iterators_couple_cmd_sub_iterated_through)
 
     EXPECT_CALL(cmd1, initialize);
     EXPECT_CALL(cmd2, initialize);
-    EXPECT_CALL(cmd1, getRequirementsBitwise)
-        .Times(2)
-        .WillRepeatedly(Return(calcRequirementsBitwise({&sub1})));
+    EXPECT_CALL(cmd1, getRequirementsBitwise).WillOnce(Return(calcRequirementsBitwise({&sub1})));
     EXPECT_CALL(cmd2, getRequirementsBitwise).WillOnce(Return(calcRequirementsBitwise({&sub2})));
 
     scheduler.registerSubsystem(&sub1);
@@ -1647,3 +1647,768 @@ TEST(CommandScheduler, refreshSafeDisconnect_only_called_once)
 
     scheduler.run();
 }
+
+TEST(CommandScheduler, run_refresh_divisor_decimates_refresh)
+{
+    Drivers drivers;
+    CommandScheduler scheduler(&drivers, true);
+    NiceMock<SubsystemMock> s1(&drivers);
+    NiceMock<SubsystemMock> s2(&drivers);
+    s2.setRefreshDivisor(4);
+
+    scheduler.registerSubsystem(&s1);
+    scheduler.registerSubsystem(&s2);
+
+    EXPECT_CALL(s1, refresh).Times(8);
+    EXPECT_CALL(s2, refresh).Times(2);
+
+    for (int i = 0; i < 8; i++)
+    {
+        scheduler.run();
+    }
+}
+
+TEST(CommandScheduler, run_subsystems_with_same_refresh_divisor_are_staggered)
+{
+    Drivers drivers;
+    CommandScheduler scheduler(&drivers, true);
+    NiceMock<SubsystemMock> subs[4]{
+        NiceMock<SubsystemMock>(&drivers),
+        NiceMock<SubsystemMock>(&drivers),
+        NiceMock<SubsystemMock>(&drivers),
+        NiceMock<SubsystemMock>(&drivers)};
+
+    int refreshesThisTick = 0;
+    for (auto &sub : subs)
+    {
+        sub.setRefreshDivisor(4);
+        ON_CALL(sub, refresh).WillByDefault([&] { refreshesThisTick++; });
+        EXPECT_CALL(sub, refresh).Times(3);
+        scheduler.registerSubsystem(&sub);
+    }
+
+    for (int i = 0; i < 12; i++)
+    {
+        refreshesThisTick = 0;
+        scheduler.run();
+        EXPECT_EQ(1, refreshesThisTick);
+    }
+}
+
+TEST(CommandScheduler, run_subsystems_with_different_refresh_divisors_are_staggered)
+{
+    Drivers drivers;
+    CommandScheduler scheduler(&drivers, true);
+    NiceMock<SubsystemMock> s1(&drivers);
+    NiceMock<SubsystemMock> s2(&drivers);
+    NiceMock<SubsystemMock> s3(&drivers);
+    s1.setRefreshDivisor(2);
+    s2.setRefreshDivisor(4);
+    s3.setRefreshDivisor(4);
+
+    int refreshesThisTick = 0;
+    for (auto *sub : {&s1, &s2, &s3})
+    {
+        ON_CALL(*sub, refresh).WillByDefault([&] { refreshesThisTick++; });
+        scheduler.registerSubsystem(sub);
+    }
+
+    // s1 takes the even ticks, s2 and s3 share the odd ticks
+    for (int i = 0; i < 8; i++)
+    {
+        refreshesThisTick = 0;
+        scheduler.run();
+        EXPECT_EQ(1, refreshesThisTick);
+    }
+}
+
+TEST(CommandScheduler, run_decimated_subsystem_default_command_added_on_first_tick)
+{
+    Drivers drivers;
+    CommandScheduler scheduler(&drivers, true);
+
+    NiceMock<SubsystemMock> s1(&drivers);
+    NiceMock<SubsystemMock> s2(&drivers);
+    s1.setRefreshDivisor(3);
+    s2.setRefreshDivisor(3);
+    scheduler.registerSubsystem(&s1);
+    scheduler.registerSubsystem(&s2);
+
+    NiceMock<CommandMock> c;
+    ON_CALL(c, getRequirementsBitwise)
+        .WillByDefault(Return(calcRequirementsBitwise(set<Subsystem *>{&s2})));
+    ON_CALL(s2, getDefaultCommand).WillByDefault(Return(&c));
+
+    // s2 is staggered so it is not refreshed on the first tick
+    EXPECT_CALL(s2, refresh).Times(0);
+    EXPECT_CALL(c, initialize);
+
+    scheduler.run();
+
+    EXPECT_TRUE(scheduler.isCommandScheduled(&c));
+}
+
+TEST(CommandScheduler, run_decimated_subsystem_hardware_test_tracked_every_tick)
+{
+    Drivers drivers;
+    CommandScheduler scheduler(&drivers, true);
+
+    NiceMock<SubsystemMock> s(&drivers);
+    s.setRefreshDivisor(10);
+    scheduler.registerSubsystem(&s);
+
+    NiceMock<CommandMock> testCommand;
+    ON_CALL(testCommand, getRequirementsBitwise)
+        .WillByDefault(Return(calcRequirementsBitwise(set<Subsystem *>{&s})));
+    EXPECT_CALL(s, getTestCommand).WillRepeatedly(Return(&testCommand));
+    ON_CALL(testCommand, isFinished).WillByDefault(Return(true));
+
+    scheduler.runHardwareTest(&s);
+    EXPECT_FALSE(scheduler.hasPassedTest(&s));
+
+    // First tick runs and removes the finished test command, second notices it has passed, even
+    // though the subsystem is not refreshed on either of them
+    scheduler.run();
+    scheduler.run();
+
+    EXPECT_TRUE(scheduler.hasPassedTest(&s));
+}
+
+TEST(CommandScheduler, run_decimated_subsystem_refreshSafeDisconnect_called_every_tick)
+{
+    Drivers drivers;
+    RemoteSafeDisconnectFunction func(&drivers);
+    CommandScheduler scheduler(&drivers, true, &func);
+
+    NiceMock<SubsystemMock> s(&drivers);
+    s.setRefreshDivisor(4);
+    scheduler.registerSubsystem(&s);
+
+    ON_CALL(drivers.remote, isConnected).WillByDefault(Return(false));
+
+    EXPECT_CALL(s, refreshSafeDisconnect).Times(4);
+    EXPECT_CALL(s, refresh).Times(0);
+
+    for (int i = 0; i < 4; i++)
+    {
+        scheduler.run();
+    }
+}
+
+TEST(CommandScheduler, run_default_command_only_looked_up_when_subsystem_has_no_command)
+{
+    Drivers drivers;
+    CommandScheduler scheduler(&drivers, true);
+
+    SubsystemMock s(&drivers);
+    NiceMock<CommandMock> c;
+    ON_CALL(c, getRequirementsBitwise)
+        .WillByDefault(Return(calcRequirementsBitwise(set<Subsystem *>{&s})));
+
+    EXPECT_CALL(s, refresh).Times(10);
+    // Default and test commands are only looked at on the first tick, once c is running the
+    // subsystem has nothing pending
+    EXPECT_CALL(s, getDefaultCommand).WillOnce(Return(&c));
+    EXPECT_CALL(s, getTestCommand).WillOnce(Return(nullptr));
+
+    scheduler.registerSubsystem(&s);
+    for (int i = 0; i < 10; i++)
+    {
+        scheduler.run();
+    }
+
+    EXPECT_TRUE(scheduler.isCommandScheduled(&c));
+}
+
+TEST(CommandScheduler, run_default_command_reinstated_only_for_subsystems_that_lost_command)
+{
+    Drivers drivers;
+    CommandScheduler scheduler(&drivers, true);
+
+    NiceMock<SubsystemMock> s1(&drivers);
+    NiceMock<SubsystemMock> s2(&drivers);
+    NiceMock<SubsystemMock> s3(&drivers);
+    scheduler.registerSubsystem(&s1);
+    scheduler.registerSubsystem(&s2);
+    scheduler.registerSubsystem(&s3);
+
+    NiceMock<CommandMock> defaultCommand;
+    NiceMock<CommandMock> otherCommand;
+    NiceMock<CommandMock> s12Command;
+    ON_CALL(defaultCommand, getRequirementsBitwise)
+        .WillByDefault(Return(calcRequirementsBitwise({&s1})));
+    ON_CALL(otherCommand, getRequirementsBitwise)
+        .WillByDefault(Return(calcRequirementsBitwise({&s2})));
+    ON_CALL(s12Command, getRequirementsBitwise)
+        .WillByDefault(Return(calcRequirementsBitwise({&s1, &s2})));
+
+    ON_CALL(s1, getDefaultCommand).WillByDefault(Return(&defaultCommand));
+    scheduler.addCommand(&otherCommand);
+    scheduler.run();
+    ASSERT_TRUE(scheduler.isCommandScheduled(&defaultCommand));
+
+    // s12Command interrupts both commands, so after it is removed s1 gets its default back and
+    // s2, which has no default command, is left without a command
+    scheduler.addCommand(&s12Command);
+    EXPECT_FALSE(scheduler.isCommandScheduled(&defaultCommand));
+    EXPECT_FALSE(scheduler.isCommandScheduled(&otherCommand));
+    scheduler.run();
+    EXPECT_FALSE(scheduler.isCommandScheduled(&defaultCommand));
+
+    scheduler.removeCommand(&s12Command, true);
+    scheduler.run();
+    EXPECT_TRUE(scheduler.isCommandScheduled(&defaultCommand));
+    EXPECT_FALSE(scheduler.isCommandScheduled(&otherCommand));
+    EXPECT_EQ(1, scheduler.commandListSize());
+}
+
+TEST(CommandScheduler, addCommand_multi_subsystem_command_interrupts_each_owner_once)
+{
+    Drivers drivers;
+    CommandScheduler scheduler(&drivers, true);
+
+    NiceMock<SubsystemMock> s1(&drivers);
+    NiceMock<SubsystemMock> s2(&drivers);
+    NiceMock<SubsystemMock> s3(&drivers);
+    NiceMock<SubsystemMock> s4(&drivers);
+    scheduler.registerSubsystem(&s1);
+    scheduler.registerSubsystem(&s2);
+    scheduler.registerSubsystem(&s3);
+    scheduler.registerSubsystem(&s4);
+
+    NiceMock<CommandMock> c12;
+    NiceMock<CommandMock> c34;
+    NiceMock<CommandMock> c23;
+    ON_CALL(c12, getRequirementsBitwise).WillByDefault(Return(calcRequirementsBitwise({&s1, &s2})));
+    ON_CALL(c34, getRequirementsBitwise).WillByDefault(Return(calcRequirementsBitwise({&s3, &s4})));
+    ON_CALL(c23, getRequirementsBitwise).WillByDefault(Return(calcRequirementsBitwise({&s2, &s3})));
+
+    scheduler.addCommand(&c12);
+    scheduler.addCommand(&c34);
+
+    // c23 overlaps both running commands, each of which must be ended exactly once
+    EXPECT_CALL(c12, end(true));
+    EXPECT_CALL(c34, end(true));
+    EXPECT_CALL(c23, initialize);
+
+    scheduler.addCommand(&c23);
+
+    EXPECT_TRUE(scheduler.isCommandScheduled(&c23));
+    EXPECT_FALSE(scheduler.isCommandScheduled(&c12));
+    EXPECT_FALSE(scheduler.isCommandScheduled(&c34));
+}
+
+TEST(CommandScheduler, addCommand_only_interrupts_owners_of_required_subsystems)
+{
+    Drivers drivers;
+    CommandScheduler scheduler(&drivers, true);
+
+    NiceMock<SubsystemMock> s1(&drivers);
+    NiceMock<SubsystemMock> s2(&drivers);
+    NiceMock<SubsystemMock> s3(&drivers);
+    scheduler.registerSubsystem(&s1);
+    scheduler.registerSubsystem(&s2);
+    scheduler.registerSubsystem(&s3);
+
+    NiceMock<CommandMock> c12;
+    NiceMock<CommandMock> c3;
+    NiceMock<CommandMock> c1;
+    NiceMock<CommandMock> c2;
+    ON_CALL(c12, getRequirementsBitwise).WillByDefault(Return(calcRequirementsBitwise({&s1, &s2})));
+    ON_CALL(c3, getRequirementsBitwise).WillByDefault(Return(calcRequirementsBitwise({&s3})));
+    ON_CALL(c1, getRequirementsBitwise).WillByDefault(Return(calcRequirementsBitwise({&s1})));
+    ON_CALL(c2, getRequirementsBitwise).WillByDefault(Return(calcRequirementsBitwise({&s2})));
+
+    scheduler.addCommand(&c12);
+    scheduler.addCommand(&c3);
+
+    EXPECT_CALL(c12, end(true));
+    EXPECT_CALL(c3, end).Times(0);
+
+    // c1 takes s1 from c12, which also frees s2
+    scheduler.addCommand(&c1);
+    EXPECT_TRUE(scheduler.isCommandScheduled(&c1));
+    EXPECT_TRUE(scheduler.isCommandScheduled(&c3));
+    EXPECT_FALSE(scheduler.isCommandScheduled(&c12));
+
+    // s2 has no owner left, so adding c2 interrupts nothing
+    EXPECT_CALL(c1, end).Times(0);
+    scheduler.addCommand(&c2);
+    EXPECT_TRUE(scheduler.isCommandScheduled(&c1));
+    EXPECT_TRUE(scheduler.isCommandScheduled(&c2));
+    EXPECT_TRUE(scheduler.isCommandScheduled(&c3));
+}
+
+TEST(CommandScheduler, addCommand_readding_multi_subsystem_command_interrupts_it_once)
+{
+    Drivers drivers;
+    CommandScheduler scheduler(&drivers, true);
+
+    NiceMock<SubsystemMock> s1(&drivers);
+    NiceMock<SubsystemMock> s2(&drivers);
+    scheduler.registerSubsystem(&s1);
+    scheduler.registerSubsystem(&s2);
+
+    NiceMock<CommandMock> c;
+    ON_CALL(c, getRequirementsBitwise).WillByDefault(Return(calcRequirementsBitwise({&s1, &s2})));
+
+    EXPECT_CALL(c, initialize).Times(2);
+    EXPECT_CALL(c, end(true));
+
+    scheduler.addCommand(&c);
+    scheduler.addCommand(&c);
+
+    EXPECT_TRUE(scheduler.isCommandScheduled(&c));
+}
+
+/**
+ * Latches a simulated sensor reading on refresh.
+ */
+class SensorSubsystem : public Subsystem
+{
+public:
+    SensorSubsystem(Drivers *drivers) : Subsystem(drivers) {}
+    void refresh() override { reading = rawSensor; }
+    int rawSensor = 0;
+    int reading = 0;
+};
+
+/**
+ * Sends the last commanded output to a simulated motor on refresh.
+ */
+class ActuatorSubsystem : public Subsystem
+{
+public:
+    ActuatorSubsystem(Drivers *drivers) : Subsystem(drivers) {}
+    void refresh() override { motorOutput = desiredOutput; }
+    int desiredOutput = 0;
+    int motorOutput = 0;
+};
+
+/**
+ * Passes the sensor reading straight through to the actuator.
+ */
+class PassthroughCommand : public Command
+{
+public:
+    PassthroughCommand(SensorSubsystem *sensor, ActuatorSubsystem *actuator)
+        : sensor(sensor),
+          actuator(actuator)
+    {
+        addSubsystemRequirement(actuator);
+    }
+    const char *getName() const override { return "passthrough"; }
+    void initialize() override {}
+    void execute() override { actuator->desiredOutput = sensor->reading; }
+    void end(bool) override {}
+    bool isFinished() const override { return false; }
+
+private:
+    SensorSubsystem *sensor;
+    ActuatorSubsystem *actuator;
+};
+
+/**
+ * Runs the scheduler until a step in the raw sensor value reaches the motor output and returns
+ * how many ticks after the step that took.
+ */
+static int measureSensorToOutputLatency(bool usePhases)
+{
+    Drivers drivers;
+    CommandScheduler scheduler(&drivers, true);
+    SensorSubsystem sensor(&drivers);
+    ActuatorSubsystem actuator(&drivers);
+    PassthroughCommand command(&sensor, &actuator);
+
+    if (usePhases)
+    {
+        sensor.setSchedulerPhase(SchedulerPhase::SENSE);
+        actuator.setSchedulerPhase(SchedulerPhase::ACTUATE);
+    }
+    scheduler.registerSubsystem(&sensor);
+    scheduler.registerSubsystem(&actuator);
+    scheduler.addCommand(&command);
+    scheduler.run();
+
+    sensor.rawSensor = 1;
+    for (int tick = 0; tick < 5; tick++)
+    {
+        scheduler.run();
+        if (actuator.motorOutput == 1)
+        {
+            return tick;
+        }
+    }
+    return -1;
+}
+
+TEST(CommandScheduler, run_phases_remove_one_tick_of_sensor_to_output_latency)
+{
+    EXPECT_EQ(1, measureSensorToOutputLatency(false));
+    EXPECT_EQ(0, measureSensorToOutputLatency(true));
+}
+
+TEST(CommandScheduler, run_executes_commands_and_refreshes_subsystems_in_phase_order)
+{
+    Drivers drivers;
+    CommandScheduler scheduler(&drivers, true);
+
+    NiceMock<SubsystemMock> actuate(&drivers);
+    NiceMock<SubsystemMock> compute(&drivers);
+    NiceMock<SubsystemMock> sense(&drivers);
+    actuate.setSchedulerPhase(SchedulerPhase::ACTUATE);
+    sense.setSchedulerPhase(SchedulerPhase::SENSE);
+    scheduler.registerSubsystem(&actuate);
+    scheduler.registerSubsystem(&compute);
+    scheduler.registerSubsystem(&sense);
+
+    NiceMock<CommandMock> actuateCommand;
+    NiceMock<CommandMock> computeCommand;
+    actuateCommand.setSchedulerPhase(SchedulerPhase::ACTUATE);
+    ON_CALL(actuateCommand, getRequirementsBitwise)
+        .WillByDefault(Return(calcRequirementsBitwise({&actuate})));
+    ON_CALL(computeCommand, getRequirementsBitwise)
+        .WillByDefault(Return(calcRequirementsBitwise({&compute})));
+    scheduler.addCommand(&actuateCommand);
+    scheduler.addCommand(&computeCommand);
+
+    {
+        InSequence seq;
+        EXPECT_CALL(sense, refresh);
+        EXPECT_CALL(computeCommand, execute);
+        EXPECT_CALL(compute, refresh);
+        EXPECT_CALL(actuateCommand, execute);
+        EXPECT_CALL(actuate, refresh);
+    }
+
+    scheduler.run();
+}
+
+/**
+ * A subsystem that integrates some floating point state and mixes it with shared "world" values,
+ * declaring the world values it touches as its refresh data dependencies.
+ */
+class SimulatedSubsystem : public Subsystem
+{
+public:
+    static constexpr int WORLD_SIZE = 4;
+
+    SimulatedSubsystem(Drivers *drivers, double *world, uint32_t worldMask, int seed)
+        : Subsystem(drivers),
+          world(world),
+          worldMask(worldMask),
+          state(seed * 0.37 + 1)
+    {
+        setRefreshDataDependencies(worldMask);
+    }
+
+    void refresh() override
+    {
+        for (int step = 0; step < 200; step++)
+        {
+            state = std::sin(state) * 1.0001 + std::cos(state * 0.5) * 0.01;
+        }
+        for (int i = 0; i < WORLD_SIZE; i++)
+        {
+            if (worldMask & (1u << i))
+            {
+                world[i] = world[i] * 0.9 + state;
+                state += world[i] * 1e-3;
+            }
+        }
+    }
+
+    double *world;
+    uint32_t worldMask;
+    double state;
+};
+
+/**
+ * Runs a small simulation and returns the final subsystem states followed by the world values.
+ */
+static std::vector<double> runSimulation(int numThreads)
+{
+    // Masks chosen so some subsystems are independent and others chain through shared values
+    static constexpr uint32_t WORLD_MASKS[] = {0b0001, 0b0010, 0b0011, 0b0000, 0b0100, 0b1100,
+                                               0b0000, 0b1000, 0b0001, 0b0000};
+    static constexpr int NUM_SUBSYSTEMS = sizeof(WORLD_MASKS) / sizeof(WORLD_MASKS[0]);
+
+    Drivers drivers;
+    CommandScheduler scheduler(&drivers, true);
+    scheduler.setParallelRefreshThreadCount(numThreads);
+
+    double world[SimulatedSubsystem::WORLD_SIZE] = {};
+    std::vector<std::unique_ptr<SimulatedSubsystem>> subs;
+    for (int i = 0; i < NUM_SUBSYSTEMS; i++)
+    {
+        subs.emplace_back(std::make_unique<SimulatedSubsystem>(&drivers, world, WORLD_MASKS[i], i));
+        scheduler.registerSubsystem(subs.back().get());
+    }
+
+    // Leave one subsystem with the default "depends on everything" mask
+    subs[NUM_SUBSYSTEMS - 1]->setRefreshDataDependencies(
+        Subsystem::ALL_REFRESH_DATA_DEPENDENCIES);
+    subs[NUM_SUBSYSTEMS - 1]->worldMask = 0b1111;
+
+    for (int tick = 0; tick < 100; tick++)
+    {
+        scheduler.run();
+    }
+
+    std::vector<double> result;
+    for (const auto &sub : subs)
+    {
+        result.push_back(sub->state);
+    }
+    result.insert(result.end(), world, world + SimulatedSubsystem::WORLD_SIZE);
+    return result;
+}
+
+TEST(CommandScheduler, run_parallel_refresh_bit_identical_to_serial_refresh)
+{
+    std::vector<double> serial = runSimulation(1);
+
+    for (int numThreads : {2, 4})
+    {
+        std::vector<double> parallel = runSimulation(numThreads);
+        ASSERT_EQ(serial.size(), parallel.size());
+        EXPECT_EQ(0, std::memcmp(serial.data(), parallel.data(), serial.size() * sizeof(double)))
+            << "with " << numThreads << " threads";
+    }
+}
+
+/**
+ * A command that mixes the states of the subsystems it requires whenever it starts, runs or
+ * ends, finishing after a few ticks so that default commands keep getting added.
+ */
+class MixingCommand : public Command
+{
+public:
+    MixingCommand(std::initializer_list<SimulatedSubsystem *> requirements, int runTicks)
+        : requirements(requirements),
+          runTicks(runTicks)
+    {
+        for (SimulatedSubsystem *sub : requirements)
+        {
+            addSubsystemRequirement(sub);
+        }
+    }
+
+    const char *getName() const override { return "mixing command"; }
+    void initialize() override
+    {
+        ticks = 0;
+        mix(0.25);
+    }
+    void execute() override
+    {
+        ticks++;
+        mix(0.1);
+    }
+    void end(bool) override { mix(0.5); }
+    bool isFinished() const override { return ticks >= runTicks; }
+
+private:
+    void mix(double amount)
+    {
+        double sum = 0;
+        for (SimulatedSubsystem *sub : requirements)
+        {
+            sum += sub->state;
+        }
+        for (SimulatedSubsystem *sub : requirements)
+        {
+            sub->state = sub->state * (1 - amount) + sum * amount * 0.5;
+        }
+    }
+
+    std::vector<SimulatedSubsystem *> requirements;
+    int runTicks;
+    int ticks = 0;
+};
+
+/**
+ * Like runSimulation, but with default commands that require several subsystems and that read
+ * and write subsystem state, so the order default commands are added in relative to the
+ * subsystem refreshes matters.
+ */
+static std::vector<double> runSimulationWithDefaultCommands(int numThreads)
+{
+    static constexpr uint32_t WORLD_MASKS[] = {0b0001, 0b0010, 0b0000, 0b0110, 0b1000, 0b0000};
+    static constexpr int NUM_SUBSYSTEMS = sizeof(WORLD_MASKS) / sizeof(WORLD_MASKS[0]);
+
+    Drivers drivers;
+    CommandScheduler scheduler(&drivers, true);
+    scheduler.setParallelRefreshThreadCount(numThreads);
+
+    double world[SimulatedSubsystem::WORLD_SIZE] = {};
+    std::vector<std::unique_ptr<SimulatedSubsystem>> subs;
+    for (int i = 0; i < NUM_SUBSYSTEMS; i++)
+    {
+        subs.emplace_back(std::make_unique<SimulatedSubsystem>(&drivers, world, WORLD_MASKS[i], i));
+    }
+
+    MixingCommand c0({subs[0].get()}, 2);
+    MixingCommand c13({subs[1].get(), subs[3].get()}, 3);
+    MixingCommand c25({subs[2].get(), subs[5].get()}, 4);
+    subs[0]->setDefaultCommand(&c0);
+    subs[1]->setDefaultCommand(&c13);
+    subs[3]->setDefaultCommand(&c13);
+    subs[5]->setDefaultCommand(&c25);
+    subs[2]->setDefaultCommand(&c25);
+
+    for (const auto &sub : subs)
+    {
+        scheduler.registerSubsystem(sub.get());
+    }
+
+    for (int tick = 0; tick < 100; tick++)
+    {
+        scheduler.run();
+    }
+
+    std::vector<double> result;
+    for (const auto &sub : subs)
+    {
+        result.push_back(sub->state);
+    }
+    result.insert(result.end(), world, world + SimulatedSubsystem::WORLD_SIZE);
+    return result;
+}
+
+TEST(
+    CommandScheduler,
+    run_parallel_refresh_with_multi_subsystem_default_commands_bit_identical_to_serial_refresh)
+{
+    std::vector<double> serial = runSimulationWithDefaultCommands(1);
+
+    for (int numThreads : {2, 4})
+    {
+        std::vector<double> parallel = runSimulationWithDefaultCommands(numThreads);
+        ASSERT_EQ(serial.size(), parallel.size());
+        EXPECT_EQ(0, std::memcmp(serial.data(), parallel.data(), serial.size() * sizeof(double)))
+            << "with " << numThreads << " threads";
+    }
+}
+
+TEST(CommandScheduler, run_parallel_refresh_adds_default_commands_and_honors_divisor)
+{
+    Drivers drivers;
+    CommandScheduler scheduler(&drivers, true);
+    scheduler.setParallelRefreshThreadCount(2);
+
+    NiceMock<SubsystemMock> s1(&drivers);
+    NiceMock<SubsystemMock> s2(&drivers);
+    s1.setRefreshDataDependencies(0);
+    s2.setRefreshDataDependencies(0);
+    s2.setRefreshDivisor(2);
+    scheduler.registerSubsystem(&s1);
+    scheduler.registerSubsystem(&s2);
+
+    NiceMock<CommandMock> c;
+    ON_CALL(c, getRequirementsBitwise).WillByDefault(Return(calcRequirementsBitwise({&s1})));
+    ON_CALL(s1, getDefaultCommand).WillByDefault(Return(&c));
+
+    EXPECT_CALL(s1, refresh).Times(4);
+    EXPECT_CALL(s2, refresh).Times(2);
+    EXPECT_CALL(c, initialize);
+    EXPECT_CALL(c, execute).Times(3);
+
+    for (int i = 0; i < 4; i++)
+    {
+        scheduler.run();
+    }
+
+    EXPECT_TRUE(scheduler.isCommandScheduled(&c));
+}
+
+#ifdef TAPROOT_SCHEDULER_EXECUTION_TIMING
+TEST(CommandScheduler, run_records_command_and_subsystem_execution_time)
+{
+    Drivers drivers;
+    CommandScheduler scheduler(&drivers, true);
+    tap::arch::clock::ClockStub clock;
+
+    NiceMock<SubsystemMock> s(&drivers);
+    NiceMock<CommandMock> c;
+    set<Subsystem *> subRequirements{&s};
+    ON_CALL(c, getRequirementsBitwise)
+        .WillByDefault(Return(calcRequirementsBitwise(subRequirements)));
+
+    // execute takes 1 ms, refresh takes 2 ms
+    ON_CALL(c, execute).WillByDefault([&]() { clock.time += 1; });
+    ON_CALL(s, refresh).WillByDefault([&]() { clock.time += 2; });
+
+    scheduler.registerSubsystem(&s);
+    scheduler.addCommand(&c);
+    scheduler.run();
+    scheduler.run();
+
+    ExecutionTimeStats cmdStats = scheduler.getCommandExecutionTimeStats(&c);
+    EXPECT_EQ(2, cmdStats.count);
+    EXPECT_EQ(1000, cmdStats.min);
+    EXPECT_EQ(1000, cmdStats.max);
+    EXPECT_FLOAT_EQ(1000, cmdStats.mean());
+    EXPECT_EQ(2, cmdStats.overrunCount);
+
+    ExecutionTimeStats subStats = scheduler.getSubsystemRefreshTimeStats(&s);
+    EXPECT_EQ(2, subStats.count);
+    EXPECT_EQ(2000, subStats.min);
+    EXPECT_EQ(2000, subStats.max);
+    EXPECT_EQ(2, subStats.overrunCount);
+
+    ExecutionTimeStats runStats = scheduler.getRunTimeStats();
+    EXPECT_EQ(2, runStats.count);
+    EXPECT_EQ(3000, runStats.max);
+    EXPECT_EQ(2, runStats.overrunCount);
+}
+
+TEST(CommandScheduler, run_execution_time_overrun_threshold_configurable)
+{
+    Drivers drivers;
+    CommandScheduler scheduler(&drivers, true);
+    tap::arch::clock::ClockStub clock;
+
+    NiceMock<SubsystemMock> s(&drivers);
+    NiceMock<CommandMock> c;
+    set<Subsystem *> subRequirements{&s};
+    ON_CALL(c, getRequirementsBitwise)
+        .WillByDefault(Return(calcRequirementsBitwise(subRequirements)));
+
+    ON_CALL(c, execute).WillByDefault([&]() { clock.time += 1; });
+    ON_CALL(s, refresh).WillByDefault([&]() { clock.time += 2; });
+
+    scheduler.setExecutionTimeOverrunThreshold(1500);
+    scheduler.registerSubsystem(&s);
+    scheduler.addCommand(&c);
+    scheduler.run();
+
+    EXPECT_EQ(0, scheduler.getCommandExecutionTimeStats(&c).overrunCount);
+    EXPECT_EQ(1, scheduler.getSubsystemRefreshTimeStats(&s).overrunCount);
+}
+
+TEST(CommandScheduler, resetExecutionTimeStats_clears_stats)
+{
+    Drivers drivers;
+    CommandScheduler scheduler(&drivers, true);
+
+    NiceMock<SubsystemMock> s(&drivers);
+    NiceMock<CommandMock> c;
+    set<Subsystem *> subRequirements{&s};
+    ON_CALL(c, getRequirementsBitwise)
+        .WillByDefault(Return(calcRequirementsBitwise(subRequirements)));
+
+    scheduler.registerSubsystem(&s);
+    scheduler.addCommand(&c);
+    scheduler.run();
+
+    EXPECT_EQ(1, scheduler.getCommandExecutionTimeStats(&c).count);
+    EXPECT_EQ(1, scheduler.getSubsystemRefreshTimeStats(&s).count);
+
+    scheduler.resetExecutionTimeStats();
+
+    EXPECT_EQ(0, scheduler.getCommandExecutionTimeStats(&c).count);
+    EXPECT_EQ(0, scheduler.getSubsystemRefreshTimeStats(&s).count);
+    EXPECT_EQ(0, scheduler.getRunTimeStats().count);
+}
+#endif
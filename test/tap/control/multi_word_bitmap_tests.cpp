@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2026 Advanced Robotics at the University of Washington <robomstr@uw.edu>
+ *
+ * This file is part of Taproot.
+ *
+ * Taproot is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Taproot is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Taproot.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "tap/control/multi_word_bitmap.hpp"
+
+using tap::control::MultiWordBitmap;
+
+using SingleWordBitmap = MultiWordBitmap<1>;
+using ThreeWordBitmap = MultiWordBitmap<3>;
+
+TEST(MultiWordBitmap, default_constructed_bitmap_is_empty)
+{
+    ThreeWordBitmap bitmap;
+
+    EXPECT_TRUE(bitmap.none());
+    EXPECT_FALSE(bitmap.any());
+    EXPECT_EQ(0, bitmap.count());
+    EXPECT_EQ(192, ThreeWordBitmap::SIZE);
+}
+
+TEST(MultiWordBitmap, integer_constructor_sets_lowest_word_only)
+{
+    ThreeWordBitmap bitmap(0x8000'0000'0000'0001ull);
+
+    EXPECT_EQ(0x8000'0000'0000'0001ull, bitmap.getWord(0));
+    EXPECT_EQ(0u, bitmap.getWord(1));
+    EXPECT_EQ(0u, bitmap.getWord(2));
+    EXPECT_TRUE(bitmap.test(0));
+    EXPECT_TRUE(bitmap.test(63));
+    EXPECT_FALSE(bitmap.test(64));
+}
+
+TEST(MultiWordBitmap, set_test_reset_across_word_boundaries)
+{
+    ThreeWordBitmap bitmap;
+
+    for (int i : {0, 63, 64, 127, 128, 191})
+    {
+        bitmap.set(i);
+        EXPECT_TRUE(bitmap.test(i));
+    }
+    EXPECT_EQ(6, bitmap.count());
+    EXPECT_FALSE(bitmap.test(1));
+    EXPECT_FALSE(bitmap.test(65));
+    EXPECT_FALSE(bitmap.test(190));
+
+    bitmap.reset(64);
+    EXPECT_FALSE(bitmap.test(64));
+    EXPECT_TRUE(bitmap.test(63));
+    EXPECT_TRUE(bitmap.test(127));
+    EXPECT_EQ(5, bitmap.count());
+}
+
+TEST(MultiWordBitmap, bitwise_operators_apply_to_every_word)
+{
+    ThreeWordBitmap a = ThreeWordBitmap::oneHot(5) | ThreeWordBitmap::oneHot(70);
+    ThreeWordBitmap b = ThreeWordBitmap::oneHot(70) | ThreeWordBitmap::oneHot(150);
+
+    EXPECT_EQ(ThreeWordBitmap::oneHot(70), a & b);
+    EXPECT_EQ(3, (a | b).count());
+    EXPECT_EQ(ThreeWordBitmap::oneHot(5) | ThreeWordBitmap::oneHot(150), a ^ b);
+
+    ThreeWordBitmap inverted = ~a;
+    EXPECT_EQ(ThreeWordBitmap::SIZE - 2, inverted.count());
+    EXPECT_FALSE(inverted.test(5));
+    EXPECT_FALSE(inverted.test(70));
+    EXPECT_TRUE((inverted & a).none());
+
+    a &= ~ThreeWordBitmap::oneHot(70);
+    EXPECT_EQ(ThreeWordBitmap::oneHot(5), a);
+    EXPECT_NE(ThreeWordBitmap::oneHot(6), a);
+}
+
+TEST(MultiWordBitmap, shift_left_carries_into_next_word)
+{
+    ThreeWordBitmap one(1);
+
+    EXPECT_EQ(ThreeWordBitmap::oneHot(0), one << 0);
+    EXPECT_EQ(ThreeWordBitmap::oneHot(63), one << 63);
+    EXPECT_EQ(ThreeWordBitmap::oneHot(64), one << 64);
+    EXPECT_EQ(ThreeWordBitmap::oneHot(130), one << 130);
+
+    ThreeWordBitmap lowWord(~0ull);
+    ThreeWordBitmap shifted = lowWord << 4;
+    EXPECT_EQ(~0ull << 4, shifted.getWord(0));
+    EXPECT_EQ(0xfull, shifted.getWord(1));
+    EXPECT_EQ(0u, shifted.getWord(2));
+
+    // Bits shifted past the last word are dropped
+    EXPECT_TRUE((ThreeWordBitmap::oneHot(191) << 1).none());
+}
+
+TEST(MultiWordBitmap, findNextSetBit_skips_empty_words)
+{
+    ThreeWordBitmap bitmap;
+    bitmap.set(3);
+    bitmap.set(130);
+
+    EXPECT_EQ(3, bitmap.findNextSetBit(0, ThreeWordBitmap::SIZE));
+    EXPECT_EQ(3, bitmap.findNextSetBit(3, ThreeWordBitmap::SIZE));
+    EXPECT_EQ(130, bitmap.findNextSetBit(4, ThreeWordBitmap::SIZE));
+    EXPECT_EQ(130, bitmap.findNextSetBit(64, ThreeWordBitmap::SIZE));
+    EXPECT_EQ(ThreeWordBitmap::NO_SET_BIT, bitmap.findNextSetBit(131, ThreeWordBitmap::SIZE));
+}
+
+TEST(MultiWordBitmap, findNextSetBit_respects_end)
+{
+    ThreeWordBitmap bitmap;
+    bitmap.set(100);
+
+    EXPECT_EQ(ThreeWordBitmap::NO_SET_BIT, bitmap.findNextSetBit(0, 100));
+    EXPECT_EQ(ThreeWordBitmap::NO_SET_BIT, bitmap.findNextSetBit(0, 64));
+    EXPECT_EQ(100, bitmap.findNextSetBit(0, 101));
+    EXPECT_EQ(ThreeWordBitmap::NO_SET_BIT, bitmap.findNextSetBit(50, 50));
+    EXPECT_EQ(ThreeWordBitmap::NO_SET_BIT, bitmap.findNextSetBit(-1, 101));
+}
+
+TEST(MultiWordBitmap, single_word_bitmap_matches_uint64_operations)
+{
+    uint64_t raw = 0;
+    SingleWordBitmap bitmap;
+
+    for (int i : {0, 7, 31, 32, 63})
+    {
+        raw |= 1ull << i;
+        bitmap.set(i);
+        EXPECT_EQ(raw, bitmap.getWord(0));
+    }
+
+    EXPECT_EQ(5, bitmap.count());
+    EXPECT_EQ(~raw, (~bitmap).getWord(0));
+    EXPECT_EQ(7, bitmap.findNextSetBit(1, SingleWordBitmap::SIZE));
+    EXPECT_EQ(SingleWordBitmap::NO_SET_BIT, bitmap.findNextSetBit(33, 63));
+    EXPECT_EQ(sizeof(uint64_t), sizeof(SingleWordBitmap));
+}
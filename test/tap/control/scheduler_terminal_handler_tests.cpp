@@ -233,3 +233,66 @@ TEST(SchedulerTerminalHandler, terminalSerialStreamCallback__repeatedly_prints_c
     EXPECT_THAT(output, HasSubstr("s1"));
     EXPECT_THAT(output, HasSubstr("s2"));
 }
+
+#ifdef TAPROOT_SCHEDULER_EXECUTION_TIMING
+TEST(SchedulerTerminalHandler, terminalSerialCallback__timing_prints_execution_time_stats)
+{
+    Drivers drivers;
+    SchedulerTerminalHandler serialHandler(&drivers);
+    tap::stub::TerminalDeviceStub terminalDevice(&drivers);
+    modm::IOStream stream(terminalDevice);
+
+    NiceMock<SubsystemMock> s1(&drivers);
+    NiceMock<CommandMock> c1;
+
+    ON_CALL(drivers.commandScheduler, cmdMapBegin).WillByDefault([&]() {
+        return drivers.commandScheduler.CommandScheduler::cmdMapBegin();
+    });
+    ON_CALL(drivers.commandScheduler, cmdMapEnd).WillByDefault([&]() {
+        return drivers.commandScheduler.CommandScheduler::cmdMapEnd();
+    });
+    ON_CALL(drivers.commandScheduler, subMapBegin).WillByDefault([&]() {
+        return drivers.commandScheduler.CommandScheduler::subMapBegin();
+    });
+    ON_CALL(drivers.commandScheduler, subMapEnd).WillByDefault([&]() {
+        return drivers.commandScheduler.CommandScheduler::subMapEnd();
+    });
+
+    ExecutionTimeStats subStats;
+    subStats.update(42, 100);
+    ExecutionTimeStats cmdStats;
+    cmdStats.update(1234, 100);
+
+    ON_CALL(drivers.commandScheduler, getSubsystemRefreshTimeStats(&s1))
+        .WillByDefault(Return(subStats));
+    ON_CALL(drivers.commandScheduler, getCommandExecutionTimeStats(&c1))
+        .WillByDefault(Return(cmdStats));
+
+    ON_CALL(c1, getName).WillByDefault(Return("c1"));
+    ON_CALL(s1, getName).WillByDefault(Return("s1"));
+    ON_CALL(c1, getRequirementsBitwise).WillByDefault(Return(1 << s1.getGlobalIdentifier()));
+
+    drivers.commandScheduler.CommandScheduler::registerSubsystem(&s1);
+    drivers.commandScheduler.CommandScheduler::addCommand(&c1);
+
+    char input[] = "timing";
+    EXPECT_TRUE(serialHandler.terminalSerialCallback(input, stream, false));
+
+    std::string output = terminalDevice.readAllItemsFromWriteBufferToString();
+    EXPECT_THAT(output, HasSubstr(" s1\t1\t42\t42\t42.0\t0\n"));
+    EXPECT_THAT(output, HasSubstr(" c1\t1\t1234\t1234\t1234.0\t1\n"));
+}
+
+TEST(SchedulerTerminalHandler, terminalSerialCallback__resettiming_resets_stats)
+{
+    Drivers drivers;
+    SchedulerTerminalHandler serialHandler(&drivers);
+    tap::stub::TerminalDeviceStub terminalDevice(&drivers);
+    modm::IOStream stream(terminalDevice);
+
+    EXPECT_CALL(drivers.commandScheduler, resetExecutionTimeStats);
+
+    char input[] = "resettiming";
+    EXPECT_TRUE(serialHandler.terminalSerialCallback(input, stream, false));
+}
+#endif
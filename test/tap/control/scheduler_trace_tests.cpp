@@ -0,0 +1,344 @@
+/*
+ * Copyright (c) 2026 Advanced Robotics at the University of Washington <robomstr@uw.edu>
+ *
+ * This file is part of Taproot.
+ *
+ * Taproot is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Taproot is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Taproot.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "tap/architecture/clock.hpp"
+#include "tap/control/command_scheduler.hpp"
+#include "tap/control/scheduler_trace.hpp"
+#include "tap/control/scheduler_trace_replayer.hpp"
+#include "tap/drivers.hpp"
+
+#include "test_subsystem.hpp"
+
+using tap::Drivers;
+using namespace tap::control;
+
+using Type = SchedulerTraceEventType;
+
+/**
+ * Finishes after executing a fixed number of times since it was last initialized, so that its
+ * behavior only depends on the scheduler.
+ */
+class CountdownCommand : public Command
+{
+public:
+    CountdownCommand(TestSubsystem *sub, int executions) : executions(executions)
+    {
+        addSubsystemRequirement(sub);
+    }
+
+    void initialize() override { remaining = executions; }
+    void execute() override { remaining--; }
+    void end(bool) override {}
+    bool isFinished() const override { return remaining <= 0; }
+    const char *getName() const override { return "countdown command"; }
+
+    int executions;
+
+private:
+    int remaining = 0;
+};
+
+class ToggleSafeDisconnectFunction : public SafeDisconnectFunction
+{
+public:
+    bool operator()() override { return disconnected; }
+    bool disconnected = false;
+};
+
+static void expectEvent(
+    const SchedulerTraceEvent &event,
+    Type type,
+    const Command *command,
+    bool external)
+{
+    EXPECT_EQ(type, event.type);
+    if (command != nullptr)
+    {
+        EXPECT_EQ(command->getGlobalIdentifier(), event.globalIdentifier);
+    }
+    EXPECT_EQ(external, event.isExternal());
+}
+
+TEST(SchedulerTrace, record_overwrites_oldest_event_when_full)
+{
+    StaticSchedulerTrace<4> trace;
+
+    for (int i = 0; i < 6; i++)
+    {
+        trace.record(i, Type::COMMAND_ADDED, i, 0);
+    }
+
+    EXPECT_EQ(4, trace.size());
+    EXPECT_EQ(6, trace.getTotalRecorded());
+    EXPECT_EQ(2, trace.getDroppedCount());
+    for (int i = 0; i < 4; i++)
+    {
+        EXPECT_EQ(i + 2, trace.getEvent(i).timestamp);
+        EXPECT_EQ(i + 2, trace.getEvent(i).globalIdentifier);
+    }
+
+    trace.clear();
+    EXPECT_EQ(0, trace.size());
+    EXPECT_EQ(0, trace.getDroppedCount());
+}
+
+TEST(SchedulerTrace, scheduler_records_adds_default_commands_and_ends)
+{
+    Drivers drivers;
+    tap::arch::clock::ClockStub clock;
+    CommandScheduler scheduler(&drivers, true);
+    StaticSchedulerTrace<32> trace;
+    scheduler.setTrace(&trace);
+
+    TestSubsystem sub(&drivers);
+    CountdownCommand defaultCmd(&sub, 1000);
+    CountdownCommand cmd(&sub, 1);
+    sub.setDefaultCommand(&defaultCmd);
+    scheduler.registerSubsystem(&sub);
+
+    clock.time = 1;
+    scheduler.run();
+    scheduler.addCommand(&cmd);
+    clock.time = 2;
+    scheduler.run();
+
+    ASSERT_EQ(7, trace.size());
+    expectEvent(trace.getEvent(0), Type::RUN, nullptr, false);
+    expectEvent(trace.getEvent(1), Type::DEFAULT_COMMAND_ADDED, &defaultCmd, false);
+    expectEvent(trace.getEvent(2), Type::COMMAND_INTERRUPTED, &defaultCmd, true);
+    expectEvent(trace.getEvent(3), Type::COMMAND_ADDED, &cmd, true);
+    expectEvent(trace.getEvent(4), Type::RUN, nullptr, false);
+    expectEvent(trace.getEvent(5), Type::COMMAND_FINISHED, &cmd, false);
+    expectEvent(trace.getEvent(6), Type::DEFAULT_COMMAND_ADDED, &defaultCmd, false);
+
+    EXPECT_EQ(1000, trace.getEvent(0).timestamp);
+    EXPECT_EQ(2000, trace.getEvent(6).timestamp);
+}
+
+TEST(SchedulerTrace, scheduler_records_safe_disconnect_changes)
+{
+    Drivers drivers;
+    ToggleSafeDisconnectFunction disconnect;
+    CommandScheduler scheduler(&drivers, true, &disconnect);
+    StaticSchedulerTrace<32> trace;
+    scheduler.setTrace(&trace);
+
+    TestSubsystem sub(&drivers);
+    CountdownCommand defaultCmd(&sub, 1000);
+    sub.setDefaultCommand(&defaultCmd);
+    scheduler.registerSubsystem(&sub);
+
+    scheduler.run();
+    disconnect.disconnected = true;
+    scheduler.run();
+    scheduler.run();
+    disconnect.disconnected = false;
+    scheduler.run();
+
+    ASSERT_EQ(9, trace.size());
+    expectEvent(trace.getEvent(0), Type::RUN, nullptr, false);
+    expectEvent(trace.getEvent(1), Type::DEFAULT_COMMAND_ADDED, &defaultCmd, false);
+    expectEvent(trace.getEvent(2), Type::SAFE_DISCONNECT_ENTERED, nullptr, false);
+    expectEvent(trace.getEvent(3), Type::RUN, nullptr, false);
+    expectEvent(trace.getEvent(4), Type::COMMAND_INTERRUPTED, &defaultCmd, false);
+    expectEvent(trace.getEvent(5), Type::RUN, nullptr, false);
+    expectEvent(trace.getEvent(6), Type::SAFE_DISCONNECT_EXITED, nullptr, false);
+    expectEvent(trace.getEvent(7), Type::RUN, nullptr, false);
+    expectEvent(trace.getEvent(8), Type::DEFAULT_COMMAND_ADDED, &defaultCmd, false);
+}
+
+TEST(SchedulerTrace, no_events_recorded_without_trace)
+{
+    Drivers drivers;
+    CommandScheduler scheduler(&drivers, true);
+    StaticSchedulerTrace<8> trace;
+
+    TestSubsystem sub(&drivers);
+    CountdownCommand cmd(&sub, 1);
+    scheduler.registerSubsystem(&sub);
+
+    scheduler.setTrace(&trace);
+    scheduler.setTrace(nullptr);
+    scheduler.addCommand(&cmd);
+    scheduler.run();
+
+    EXPECT_EQ(nullptr, scheduler.getTrace());
+    EXPECT_EQ(0, trace.getTotalRecorded());
+}
+
+TEST(SchedulerTraceReplayer, trace_file_round_trip)
+{
+    std::vector<SchedulerTraceEvent> events = {
+        {1, 0, Type::RUN, 0},
+        {2, 3, Type::COMMAND_ADDED, SchedulerTraceEvent::FLAG_EXTERNAL},
+        {3, 3, Type::COMMAND_FINISHED, 0},
+    };
+    std::string path = testing::TempDir() + "scheduler_trace_round_trip.bin";
+
+    ASSERT_TRUE(SchedulerTraceReplayer::writeTraceFile(path, events));
+
+    std::vector<SchedulerTraceEvent> read;
+    ASSERT_TRUE(SchedulerTraceReplayer::readTraceFile(path, read));
+    ASSERT_EQ(events.size(), read.size());
+    EXPECT_EQ(-1, SchedulerTraceReplayer::findFirstDifference(events, read));
+    EXPECT_EQ(2, read[1].timestamp);
+}
+
+TEST(SchedulerTraceReplayer, readTraceFile_rejects_missing_or_malformed_file)
+{
+    std::vector<SchedulerTraceEvent> read;
+    EXPECT_FALSE(SchedulerTraceReplayer::readTraceFile(testing::TempDir() + "no_such_trace", read));
+
+    // Header claims one event but the file ends before it
+    std::string path = testing::TempDir() + "scheduler_trace_malformed.bin";
+    {
+        std::ofstream file(path, std::ios::binary);
+        uint32_t header[2] = {1, 1};
+        file.write("TAPTRACE", 8);
+        file.write(reinterpret_cast<const char *>(header), sizeof(header));
+    }
+
+    EXPECT_FALSE(SchedulerTraceReplayer::readTraceFile(path, read));
+}
+
+TEST(SchedulerTraceReplayer, findFirstDifference_ignores_timestamps)
+{
+    std::vector<SchedulerTraceEvent> a = {{1, 0, Type::RUN, 0}, {2, 1, Type::COMMAND_ADDED, 1}};
+    std::vector<SchedulerTraceEvent> b = {{5, 0, Type::RUN, 0}, {9, 1, Type::COMMAND_ADDED, 1}};
+
+    EXPECT_EQ(-1, SchedulerTraceReplayer::findFirstDifference(a, b));
+
+    b[1].type = Type::COMMAND_FINISHED;
+    EXPECT_EQ(1, SchedulerTraceReplayer::findFirstDifference(a, b));
+
+    b.resize(1);
+    EXPECT_EQ(1, SchedulerTraceReplayer::findFirstDifference(a, b));
+}
+
+/**
+ * Records a scenario covering external adds and removes, commands finishing on their own,
+ * default commands and safe disconnect, using the given commands.
+ */
+static std::vector<SchedulerTraceEvent> recordScenario(
+    Drivers *drivers,
+    std::vector<TestSubsystem *> subs,
+    std::vector<CountdownCommand *> cmds)
+{
+    ToggleSafeDisconnectFunction disconnect;
+    CommandScheduler scheduler(drivers, true, &disconnect);
+    StaticSchedulerTrace<128> trace;
+    scheduler.setTrace(&trace);
+
+    for (TestSubsystem *sub : subs)
+    {
+        scheduler.registerSubsystem(sub);
+    }
+
+    for (int tick = 0; tick < 20; tick++)
+    {
+        if (tick == 2)
+        {
+            scheduler.addCommand(cmds[0]);
+        }
+        if (tick == 4)
+        {
+            scheduler.addCommand(cmds[1]);
+        }
+        if (tick == 6)
+        {
+            scheduler.removeCommand(cmds[1], true);
+        }
+        if (tick == 8 || tick == 10)
+        {
+            disconnect.disconnected = !disconnect.disconnected;
+        }
+        if (tick == 12)
+        {
+            scheduler.addCommand(cmds[1]);
+        }
+        scheduler.run();
+    }
+
+    return SchedulerTraceReplayer::toVector(trace);
+}
+
+class SchedulerTraceReplayerScenarioTest : public testing::Test
+{
+protected:
+    SchedulerTraceReplayerScenarioTest()
+        : sub1(&drivers),
+          sub2(&drivers),
+          default1(&sub1, 1000),
+          cmd1(&sub1, 3),
+          cmd2(&sub2, 5)
+    {
+        sub1.setDefaultCommand(&default1);
+    }
+
+    Drivers drivers;
+    TestSubsystem sub1;
+    TestSubsystem sub2;
+    CountdownCommand default1;
+    CountdownCommand cmd1;
+    CountdownCommand cmd2;
+};
+
+TEST_F(SchedulerTraceReplayerScenarioTest, replay_reproduces_recorded_decisions)
+{
+    std::vector<SchedulerTraceEvent> recorded =
+        recordScenario(&drivers, {&sub1, &sub2}, {&cmd1, &cmd2});
+
+    CommandScheduler scheduler(&drivers, true);
+    scheduler.registerSubsystem(&sub1);
+    scheduler.registerSubsystem(&sub2);
+
+    SchedulerTraceReplayer replayer(&scheduler);
+    std::vector<SchedulerTraceEvent> replayed = replayer.replay(recorded);
+
+    EXPECT_EQ(recorded.size(), replayed.size());
+    EXPECT_EQ(-1, SchedulerTraceReplayer::findFirstDifference(recorded, replayed));
+
+    // Replaying leaves the scheduler's trace as it was
+    EXPECT_EQ(nullptr, scheduler.getTrace());
+}
+
+TEST_F(SchedulerTraceReplayerScenarioTest, replay_detects_changed_decisions)
+{
+    std::vector<SchedulerTraceEvent> recorded =
+        recordScenario(&drivers, {&sub1, &sub2}, {&cmd1, &cmd2});
+
+    CommandScheduler scheduler(&drivers, true);
+    scheduler.registerSubsystem(&sub1);
+    scheduler.registerSubsystem(&sub2);
+
+    cmd1.executions = 2;
+    SchedulerTraceReplayer replayer(&scheduler);
+    std::vector<SchedulerTraceEvent> replayed = replayer.replay(recorded);
+
+    int difference = SchedulerTraceReplayer::findFirstDifference(recorded, replayed);
+    ASSERT_GE(difference, 0);
+    EXPECT_EQ(Type::COMMAND_FINISHED, replayed[difference].type);
+    EXPECT_EQ(cmd1.getGlobalIdentifier(), replayed[difference].globalIdentifier);
+}
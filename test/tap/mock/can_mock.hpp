@@ -38,13 +38,20 @@ class CanMock : public tap::can::Can
 
     MOCK_METHOD(void, initialize, (), (override));
     MOCK_METHOD(bool, isMessageAvailable, (tap::can::CanBus bus), (const override));
-    MOCK_METHOD(bool, getMessage, (tap::can::CanBus bus, modm::can::Message *message), (override));
+    MOCK_METHOD(
+        bool,
+        getMessage,
+        (tap::can::CanBus bus, modm::can::Message *message, uint32_t *arrivalTime),
+        (override));
+    MOCK_METHOD(uint32_t, getRxOverflowCount, (tap::can::CanBus bus), (const override));
     MOCK_METHOD(bool, isReadyToSend, (tap::can::CanBus bus), (const override));
     MOCK_METHOD(
         bool,
         sendMessage,
         (tap::can::CanBus bus, const modm::can::Message &message),
         (override));
+    MOCK_METHOD(uint8_t, getTransmitErrorCount, (tap::can::CanBus bus), (const override));
+    MOCK_METHOD(uint8_t, getReceiveErrorCount, (tap::can::CanBus bus), (const override));
 };  // class CanMock
 }  // namespace mock
 }  // namespace tap
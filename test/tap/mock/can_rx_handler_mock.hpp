@@ -39,6 +39,7 @@ class CanRxHandlerMock : public tap::can::CanRxHandler
 
     MOCK_METHOD(void, attachReceiveHandler, (tap::can::CanRxListener* const listener), (override));
     MOCK_METHOD(void, pollCanData, (), (override));
+    MOCK_METHOD(void, resetRxStats, (), (override));
     MOCK_METHOD(
         void,
         removeReceiveHandler,
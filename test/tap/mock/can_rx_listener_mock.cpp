@@ -21,8 +21,12 @@
 
 namespace tap::mock
 {
-CanRxListenerMock::CanRxListenerMock(tap::Drivers *drivers, uint32_t id, can::CanBus bus)
-    : can::CanRxListener(drivers, id, bus)
+CanRxListenerMock::CanRxListenerMock(
+    tap::Drivers *drivers,
+    uint32_t id,
+    can::CanBus bus,
+    can::CanRxIdType idType)
+    : can::CanRxListener(drivers, id, bus, idType)
 {
 }
 CanRxListenerMock::~CanRxListenerMock() {}
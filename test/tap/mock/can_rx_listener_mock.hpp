@@ -35,7 +35,11 @@ namespace mock
 class CanRxListenerMock : public tap::can::CanRxListener
 {
 public:
-    CanRxListenerMock(tap::Drivers* drivers, uint32_t id, tap::can::CanBus bus);
+    CanRxListenerMock(
+        tap::Drivers* drivers,
+        uint32_t id,
+        tap::can::CanBus bus,
+        tap::can::CanRxIdType idType = tap::can::CanRxIdType::STANDARD);
     virtual ~CanRxListenerMock();
 
     MOCK_METHOD(void, processMessage, (const modm::can::Message& message), (override));
@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2026 Advanced Robotics at the University of Washington <robomstr@uw.edu>
+ *
+ * This file is part of Taproot.
+ *
+ * Taproot is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Taproot is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Taproot.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef TAPROOT_CAN_TX_QUEUE_MOCK_HPP_
+#define TAPROOT_CAN_TX_QUEUE_MOCK_HPP_
+
+#include <gmock/gmock.h>
+
+#include "tap/communication/can/can_tx_queue.hpp"
+
+namespace tap::mock
+{
+/**
+ * Mock of `CanTxQueue` that queues and drains frames like the real queue unless a test overrides
+ * the behavior.
+ */
+class CanTxQueueMock : public tap::can::CanTxQueue
+{
+public:
+    CanTxQueueMock(tap::Drivers *drivers);
+    virtual ~CanTxQueueMock();
+
+    using tap::can::CanTxQueue::drain;
+
+    MOCK_METHOD(
+        bool,
+        queueMessage,
+        (tap::can::CanBus bus,
+         const modm::can::Message &message,
+         tap::can::CanTxPriority priority,
+         uint32_t maxAgeUs),
+        (override));
+    MOCK_METHOD(void, drain, (), (override));
+};  // class CanTxQueueMock
+}  // namespace tap::mock
+
+#endif  // TAPROOT_CAN_TX_QUEUE_MOCK_HPP_
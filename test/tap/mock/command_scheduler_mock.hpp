@@ -63,6 +63,21 @@ class CommandSchedulerMock : public control::CommandScheduler
         (),
         (const override));
     MOCK_METHOD(control::command_scheduler_bitmap_t, getAddedCommandBitmap, (), (const override));
+#ifdef TAPROOT_SCHEDULER_EXECUTION_TIMING
+    MOCK_METHOD(
+        control::ExecutionTimeStats,
+        getCommandExecutionTimeStats,
+        (const control::Command *),
+        (const override));
+    MOCK_METHOD(
+        control::ExecutionTimeStats,
+        getSubsystemRefreshTimeStats,
+        (const control::Subsystem *),
+        (const override));
+    MOCK_METHOD(control::ExecutionTimeStats, getRunTimeStats, (), (const override));
+    MOCK_METHOD(void, resetExecutionTimeStats, (), (override));
+    MOCK_METHOD(void, setExecutionTimeOverrunThreshold, (uint32_t), (override));
+#endif
 };  // class CommandSchedulerMock
 }  // namespace mock
 }  // namespace tap
@@ -42,13 +42,25 @@ class DjiMotorEncoderMock : public tap::motor::DjiMotorEncoder
 
     MOCK_METHOD(float, getVelocity, (), (const override));
 
+    MOCK_METHOD(float, getAcceleration, (), (const override));
+
     MOCK_METHOD(tap::algorithms::WrappedFloat, getEncoder, (), (const));
 
     MOCK_METHOD(int16_t, getShaftRPM, (), (const override));
 
+    MOCK_METHOD(void, setVelocitySource, (VelocitySource source), (override));
+
+    MOCK_METHOD(VelocitySource, getVelocitySource, (), (const override));
+
     MOCK_METHOD(void, resetEncoderValue, (), (override));
 
     MOCK_METHOD(void, processMessage, (const modm::can::Message& message), (override));
+
+    MOCK_METHOD(
+        void,
+        processMessage,
+        (const modm::can::Message& message, uint32_t arrivalTime),
+        (override));
 };
 
 }  // namespace tap::mock
@@ -40,6 +40,8 @@ class EncoderInterfaceMock : public tap::encoder::EncoderInterface
 
     MOCK_METHOD(float, getVelocity, (), (const override));
 
+    MOCK_METHOD(float, getAcceleration, (), (const override));
+
     MOCK_METHOD(void, resetEncoderValue, (), (override));
 
     MOCK_METHOD(void, alignWith, (EncoderInterface*), (override));
@@ -17,6 +17,8 @@
  * along with Taproot.  If not, see <https://www.gnu.org/licenses/>.
  */
 
+#include <cmath>
+
 #include <gtest/gtest.h>
 
 #include "tap/drivers.hpp"
@@ -183,6 +185,61 @@ TEST(DjiMotor, parseCanRxData_encoder_info_interpreted_correctly_with_ratio)
         encoder.getPosition().getUnwrappedValue());
 }
 
+/**
+ * Feeds `encoder` 1 kHz messages of its shaft turning at `velocity` radians / second, starting
+ * just before the encoder wraps.
+ */
+static void feedConstantVelocity(DjiMotorEncoder &encoder, float velocity, int messages)
+{
+    modm::can::Message msg(MOTOR1, 8, {}, false);
+    MotorData motorData = {};
+    motorData.shaftRPM = std::round(velocity * 60 / static_cast<float>(M_TWOPI));
+
+    double ticks = DjiMotorEncoder::ENC_RESOLUTION - 100;
+    for (int i = 1; i <= messages; i++)
+    {
+        ticks += velocity * 1e-3 * DjiMotorEncoder::ENC_RESOLUTION / M_TWOPI;
+        int32_t wrapped = static_cast<int32_t>(std::floor(ticks)) % DjiMotorEncoder::ENC_RESOLUTION;
+        motorData.encoder = wrapped < 0 ? wrapped + DjiMotorEncoder::ENC_RESOLUTION : wrapped;
+        motorData.encode(msg.data);
+        encoder.processMessage(msg, i * 1000);
+    }
+}
+
+TEST(DjiMotorEncoder, velocity_source_defaults_to_reported_rpm)
+{
+    tap::arch::clock::ClockStub clock;
+    DjiMotorEncoder encoder(false);
+
+    feedConstantVelocity(encoder, 2, 100);
+
+    EXPECT_EQ(DjiMotorEncoder::VelocitySource::REPORTED_RPM, encoder.getVelocitySource());
+    EXPECT_FLOAT_EQ(19 * static_cast<float>(M_TWOPI) / 60.f, encoder.getVelocity());
+}
+
+TEST(DjiMotorEncoder, estimated_velocity_tracks_position_across_encoder_wrap)
+{
+    tap::arch::clock::ClockStub clock;
+    DjiMotorEncoder encoder(false);
+    encoder.setVelocitySource(DjiMotorEncoder::VelocitySource::ESTIMATED);
+
+    feedConstantVelocity(encoder, 2, 1000);
+
+    EXPECT_NEAR(2, encoder.getVelocity(), 0.05f);
+    EXPECT_NEAR(0, encoder.getAcceleration(), 20);
+}
+
+TEST(DjiMotorEncoder, estimated_velocity_inverted_and_geared)
+{
+    tap::arch::clock::ClockStub clock;
+    DjiMotorEncoder encoder(true, 0.5f);
+    encoder.setVelocitySource(DjiMotorEncoder::VelocitySource::ESTIMATED);
+
+    feedConstantVelocity(encoder, -40, 1000);
+
+    EXPECT_NEAR(20, encoder.getVelocity(), 0.1f);
+}
+
 TEST(DjiMotor, setDesiredOutput_limits_output)
 {
     tap::Drivers drivers;
@@ -194,22 +194,67 @@ TEST_F(DjiMotorTxHandlerTest, encodeAndSendCanData_error_if_sendMessage_fails)
 {
     ON_CALL(drivers.can, sendMessage).WillByDefault(Return(false));
 
-    EXPECT_CALL(drivers.errorController, addToErrorList);
+    EXPECT_CALL(drivers.errorController, addToErrorList).Times(AtLeast(1));
 
     addAllMotors();
 
     djiMotorTxHandler.encodeAndSendCanData();
 }
 
+TEST_F(DjiMotorTxHandlerTest, encodeAndSendCanData_messages_stay_queued_if_sendMessage_fails)
+{
+    ON_CALL(drivers.can, sendMessage).WillByDefault(Return(false));
+
+    EXPECT_CALL(drivers.errorController, addToErrorList).Times(AnyNumber());
+
+    addAllMotors();
+
+    djiMotorTxHandler.encodeAndSendCanData();
+
+    EXPECT_EQ(3, drivers.canTxQueue.getNumQueued(can::CanBus::CAN_BUS1));
+    EXPECT_EQ(3, drivers.canTxQueue.getNumQueued(can::CanBus::CAN_BUS2));
+}
+
 TEST_F(DjiMotorTxHandlerTest, encodeAndSendCanData_does_not_send_if_can_bus_busy)
 {
     ON_CALL(drivers.can, isReadyToSend).WillByDefault(Return(false));
 
+    EXPECT_CALL(drivers.can, sendMessage).Times(0);
+
     addAllMotors();
 
     djiMotorTxHandler.encodeAndSendCanData();
 }
 
+TEST_F(DjiMotorTxHandlerTest, encodeAndSendCanData_busy_bus_sends_newest_setpoints_once_ready)
+{
+    ON_CALL(drivers.can, isReadyToSend).WillByDefault(Return(false));
+
+    int16_t setpoint = 1;
+    ON_CALL(*motors[0], serializeCanSendData)
+        .WillByDefault([&setpoint](modm::can::Message *txMessage) {
+            convertToLittleEndian(setpoint, txMessage->data);
+        });
+    djiMotorTxHandler.addMotorToManager(motors[0]);
+
+    djiMotorTxHandler.encodeAndSendCanData();
+    setpoint = 2;
+    djiMotorTxHandler.encodeAndSendCanData();
+
+    EXPECT_EQ(1, drivers.canTxQueue.getNumQueued(can::CanBus::CAN_BUS1));
+
+    modm::can::Message expected(
+        DjiMotorTxHandler::CAN_DJI_LOW_IDENTIFIER,
+        DjiMotorTxHandler::CAN_DJI_MESSAGE_SEND_LENGTH,
+        0,
+        false);
+    convertToLittleEndian<int16_t>(2, expected.data);
+    EXPECT_CALL(drivers.can, sendMessage(can::CanBus::CAN_BUS1, expected));
+
+    ON_CALL(drivers.can, isReadyToSend).WillByDefault(Return(true));
+    drivers.canTxQueue.drain();
+}
+
 TEST_F(DjiMotorTxHandlerTest, encodeAndSendCanData_valid_encoding)
 {
     modm::can::Message can1MessageLow(
@@ -285,6 +330,62 @@ TEST_F(DjiMotorTxHandlerTest, encodeAndSendCanData_valid_encoding)
     djiMotorTxHandler.encodeAndSendCanData();
 }
 
+TEST_F(DjiMotorTxHandlerTest, encodeAndSendCanData_stops_sending_message_of_removed_motor)
+{
+    djiMotorTxHandler.addMotorToManager(motors[0]);
+    djiMotorTxHandler.addMotorToManager(motors[4]);
+    djiMotorTxHandler.removeFromMotorManager(*motors[4]);
+
+    modm::can::Message expected(
+        DjiMotorTxHandler::CAN_DJI_LOW_IDENTIFIER,
+        DjiMotorTxHandler::CAN_DJI_MESSAGE_SEND_LENGTH,
+        0,
+        false);
+    EXPECT_CALL(drivers.can, sendMessage).Times(0);
+    EXPECT_CALL(drivers.can, sendMessage(can::CanBus::CAN_BUS1, expected));
+
+    djiMotorTxHandler.encodeAndSendCanData();
+}
+
+TEST_F(DjiMotorTxHandlerTest, encodeAndSendCanData_clears_output_of_removed_motor)
+{
+    ON_CALL(*motors[0], serializeCanSendData).WillByDefault([](modm::can::Message *txMessage) {
+        convertToLittleEndian<int16_t>(1, txMessage->data);
+    });
+    ON_CALL(*motors[1], serializeCanSendData).WillByDefault([](modm::can::Message *txMessage) {
+        convertToLittleEndian<int16_t>(2, txMessage->data + 2);
+    });
+    djiMotorTxHandler.addMotorToManager(motors[0]);
+    djiMotorTxHandler.addMotorToManager(motors[1]);
+    djiMotorTxHandler.encodeAndSendCanData();
+
+    djiMotorTxHandler.removeFromMotorManager(*motors[1]);
+
+    modm::can::Message expected(
+        DjiMotorTxHandler::CAN_DJI_LOW_IDENTIFIER,
+        DjiMotorTxHandler::CAN_DJI_MESSAGE_SEND_LENGTH,
+        0,
+        false);
+    convertToLittleEndian<int16_t>(1, expected.data);
+    EXPECT_CALL(drivers.can, sendMessage(can::CanBus::CAN_BUS1, expected));
+
+    djiMotorTxHandler.encodeAndSendCanData();
+}
+
+TEST_F(DjiMotorTxHandlerTest, encodeAndSendCanData_6020_current_motors_only_sent_in_current_message)
+{
+    djiMotorTxHandler.addMotorToManager(motors[14]);
+
+    EXPECT_CALL(*motors[14], serializeCanSendData).Times(1);
+    EXPECT_CALL(drivers.can, sendMessage(can::CanBus::CAN_BUS2, _))
+        .WillOnce([](can::CanBus, const modm::can::Message &message) {
+            EXPECT_EQ(DjiMotorTxHandler::CAN_DJI_6020_CURRENT_IDENTIFIER, message.getIdentifier());
+            return true;
+        });
+
+    djiMotorTxHandler.encodeAndSendCanData();
+}
+
 #define TEST_getCanNMotor(n)                                                              \
     TEST_F(DjiMotorTxHandlerTest, getCan##n##Motor_returns_nullptr_when_invalid_motorid)  \
     {                                                                                     \
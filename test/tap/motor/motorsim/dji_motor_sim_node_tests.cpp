@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2026 Advanced Robotics at the University of Washington <robomstr@uw.edu>
+ *
+ * This file is part of Taproot.
+ *
+ * Taproot is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Taproot is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Taproot.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include "tap/communication/can/virtual_can_bus.hpp"
+#include "tap/communication/can/virtual_can_controller.hpp"
+#include "tap/motor/dji_motor_tx_handler.hpp"
+#include "tap/motor/motorsim/dji_motor_sim_handler.hpp"
+#include "tap/motor/motorsim/dji_motor_sim_node.hpp"
+
+#include "modm/architecture/interface/can_message.hpp"
+
+using namespace tap::can;
+using namespace tap::motor;
+using namespace tap::motor::motorsim;
+
+class DjiMotorSimNodeTest : public testing::Test
+{
+protected:
+    DjiMotorSimNodeTest()
+        : controller(&bus),
+          node(&bus, CanBus::CAN_BUS1, &handler),
+          sim(std::make_shared<MotorSim>(MotorSim::M3508_CONFIG))
+    {
+        handler.registerSim(sim, std::tuple<CanBus, MotorId>(CanBus::CAN_BUS1, MOTOR2));
+        handler.resetMotorSims();
+        bus.advanceTo(0);
+    }
+
+    VirtualCanBus bus;
+    VirtualCanController controller;
+    DjiMotorSimHandler handler;
+    DjiMotorSimNode node;
+    std::shared_ptr<MotorSim> sim;
+};
+
+TEST_F(DjiMotorSimNodeTest, registered_sims_send_feedback_every_period)
+{
+    modm::can::Message message;
+    uint32_t arrivalTime = 0;
+
+    bus.advanceTo(DjiMotorSimNode::FEEDBACK_PERIOD_US - 1);
+    ASSERT_TRUE(controller.getMessage(&message, &arrivalTime));
+    EXPECT_EQ(static_cast<uint32_t>(MOTOR2), message.getIdentifier());
+    EXPECT_FALSE(message.isExtended());
+    EXPECT_LT(0u, arrivalTime);
+    EXPECT_FALSE(controller.getMessage(&message, nullptr));
+
+    bus.advanceTo(10 * DjiMotorSimNode::FEEDBACK_PERIOD_US - 1);
+    int received = 0;
+    while (controller.getMessage(&message, nullptr))
+    {
+        EXPECT_EQ(static_cast<uint32_t>(MOTOR2), message.getIdentifier());
+        received++;
+    }
+    EXPECT_EQ(9, received);
+}
+
+TEST_F(DjiMotorSimNodeTest, control_frames_set_sim_input)
+{
+    modm::can::Message command(DjiMotorTxHandler::CAN_DJI_LOW_IDENTIFIER, 8, 0, false);
+    // Motor 2 is the second big endian int16 of the low identifier frame
+    command.data[2] = 0x03;
+    command.data[3] = 0xe8;
+
+    EXPECT_TRUE(controller.sendMessage(command));
+    bus.advanceTo(DjiMotorSimNode::FEEDBACK_PERIOD_US);
+
+    EXPECT_EQ(1000, sim->getInput());
+}
+
+TEST_F(DjiMotorSimNodeTest, frames_for_other_identifiers_are_ignored)
+{
+    modm::can::Message command(DjiMotorTxHandler::CAN_DJI_LOW_IDENTIFIER, 8, 0, true);
+    command.data[2] = 0x03;
+    command.data[3] = 0xe8;
+
+    EXPECT_TRUE(controller.sendMessage(command));
+    bus.advanceTo(DjiMotorSimNode::FEEDBACK_PERIOD_US);
+
+    EXPECT_EQ(0, sim->getInput());
+}
+
+/**
+ * Keeps the bus busy with a frame that wins arbitration against every DJI frame.
+ */
+class FloodNode : public VirtualCanNode
+{
+public:
+    explicit FloodNode(VirtualCanBus *bus) : bus(bus)
+    {
+        bus->attachNode(this);
+        bus->transmit(this, modm::can::Message(0x001, 8, 0, false));
+    }
+
+    ~FloodNode() { bus->detachNode(this); }
+
+    void onFrameReceived(const modm::can::Message &, uint64_t) override {}
+
+    void onFrameTransmitted(const modm::can::Message &message, uint64_t) override
+    {
+        bus->transmit(this, message);
+    }
+
+    VirtualCanBus *bus;
+};
+
+TEST_F(DjiMotorSimNodeTest, feedback_not_queued_while_previous_feedback_waits)
+{
+    auto flood = std::make_unique<FloodNode>(&bus);
+    bus.advanceTo(10 * DjiMotorSimNode::FEEDBACK_PERIOD_US);
+
+    // At most one flood frame and one feedback frame
+    EXPECT_GE(2u, bus.getNumWaiting());
+
+    flood.reset();
+    modm::can::Message message;
+    while (controller.getMessage(&message, nullptr))
+    {
+    }
+    bus.advanceTo(12 * DjiMotorSimNode::FEEDBACK_PERIOD_US - 1);
+
+    int received = 0;
+    while (controller.getMessage(&message, nullptr))
+    {
+        received += message.getIdentifier() == static_cast<uint32_t>(MOTOR2);
+    }
+    // The feedback frame that waited and the one sent at the start of the next period
+    EXPECT_EQ(2, received);
+}
+
+TEST(DjiMotorSimNode, bus_started_late_sends_feedback_from_start_time)
+{
+    constexpr uint64_t START = 3'600'000'000;
+
+    VirtualCanBus bus;
+    VirtualCanController controller(&bus);
+    DjiMotorSimHandler handler;
+    DjiMotorSimNode node(&bus, CanBus::CAN_BUS1, &handler);
+    handler.registerSim(
+        std::make_shared<MotorSim>(MotorSim::M3508_CONFIG),
+        std::tuple<CanBus, MotorId>(CanBus::CAN_BUS1, MOTOR2));
+    handler.resetMotorSims();
+
+    bus.advanceTo(START);
+    bus.advanceTo(START + 10 * DjiMotorSimNode::FEEDBACK_PERIOD_US - 1);
+
+    modm::can::Message message;
+    uint32_t arrivalTime = 0;
+    int received = 0;
+    while (controller.getMessage(&message, &arrivalTime))
+    {
+        if (received == 0)
+        {
+            EXPECT_LT(static_cast<uint32_t>(START), arrivalTime);
+        }
+        received++;
+    }
+    EXPECT_EQ(10, received);
+}
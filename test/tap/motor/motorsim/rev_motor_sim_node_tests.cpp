@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2026 Advanced Robotics at the University of Washington <robomstr@uw.edu>
+ *
+ * This file is part of Taproot.
+ *
+ * Taproot is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Taproot is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Taproot.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <cmath>
+#include <cstring>
+
+#include <gtest/gtest.h>
+
+#include "tap/communication/can/virtual_can_bus.hpp"
+#include "tap/communication/can/virtual_can_controller.hpp"
+#include "tap/motor/motorsim/rev_motor_sim_node.hpp"
+
+#include "modm/architecture/interface/can_message.hpp"
+
+using namespace tap::can;
+using namespace tap::motor;
+using namespace tap::motor::motorsim;
+
+class RevMotorSimNodeTest : public testing::Test
+{
+protected:
+    static constexpr uint8_t DEVICE_ID = 3;
+
+    RevMotorSimNodeTest() : controller(&bus), node(&bus, DEVICE_ID) { bus.advanceTo(0); }
+
+    static uint32_t getIdentifier(RevMotor::APICommand command, uint8_t deviceId = DEVICE_ID)
+    {
+        return (0x0205 << 16) | (static_cast<uint32_t>(command) << 6) | deviceId;
+    }
+
+    void send(RevMotor::APICommand command, float value, uint8_t deviceId = DEVICE_ID)
+    {
+        modm::can::Message message(getIdentifier(command, deviceId), 8, 0, true);
+        std::memcpy(message.data, &value, sizeof(value));
+        EXPECT_TRUE(controller.sendMessage(message));
+    }
+
+    void sendHeartbeat()
+    {
+        modm::can::Message message(getIdentifier(RevMotor::APICommand::Heartbeat), 8, 0, true);
+        std::memset(message.data, 0xff, 8);
+        EXPECT_TRUE(controller.sendMessage(message));
+    }
+
+    /// @return The float in the first 4 bytes of the last frame received with `status`.
+    float readLastStatus(RevMotor::APICommand status)
+    {
+        float value = NAN;
+        modm::can::Message message;
+        while (controller.getMessage(&message, nullptr))
+        {
+            if (message.getIdentifier() == getIdentifier(status))
+            {
+                std::memcpy(&value, message.data, sizeof(value));
+            }
+        }
+        return value;
+    }
+
+    VirtualCanBus bus;
+    VirtualCanController controller;
+    RevMotorSimNode node;
+};
+
+TEST_F(RevMotorSimNodeTest, sends_status_frames_at_default_rates)
+{
+    bus.advanceTo(RevMotorSimNode::STATUS_1_PERIOD_US * 5 - 1);
+
+    int status0 = 0;
+    int status1 = 0;
+    int status2 = 0;
+    modm::can::Message message;
+    while (controller.getMessage(&message, nullptr))
+    {
+        EXPECT_TRUE(message.isExtended());
+        status0 += message.getIdentifier() == getIdentifier(RevMotor::APICommand::Period0);
+        status1 += message.getIdentifier() == getIdentifier(RevMotor::APICommand::Period1);
+        status2 += message.getIdentifier() == getIdentifier(RevMotor::APICommand::Period2);
+    }
+
+    EXPECT_EQ(10, status0);
+    EXPECT_EQ(5, status1);
+    EXPECT_EQ(5, status2);
+}
+
+TEST_F(RevMotorSimNodeTest, output_disabled_without_heartbeat)
+{
+    send(RevMotor::APICommand::DutyCycle, 0.5f);
+    bus.advanceTo(1'000);
+
+    EXPECT_FALSE(node.isEnabled());
+    EXPECT_EQ(RevMotor::APICommand::DutyCycle, node.getControlCommand());
+    EXPECT_FLOAT_EQ(0.5f, node.getSetpoint());
+    EXPECT_FLOAT_EQ(0, node.getAppliedOutput());
+}
+
+TEST_F(RevMotorSimNodeTest, duty_cycle_command_spins_motor)
+{
+    sendHeartbeat();
+    send(RevMotor::APICommand::DutyCycle, 0.5f);
+    // Long enough for the second status 1 frame to arrive
+    bus.advanceTo(RevMotorSimNode::STATUS_1_PERIOD_US + 1'000);
+
+    EXPECT_TRUE(node.isEnabled());
+    EXPECT_FLOAT_EQ(0.5f, node.getAppliedOutput());
+    EXPECT_FLOAT_EQ(0.5f * RevMotorSimNode::FREE_SPEED_RPM, node.getVelocity());
+    EXPECT_FLOAT_EQ(
+        0.5f * RevMotorSimNode::FREE_SPEED_RPM,
+        readLastStatus(RevMotor::APICommand::Period1));
+}
+
+TEST_F(RevMotorSimNodeTest, velocity_command_integrates_position)
+{
+    sendHeartbeat();
+    send(RevMotor::APICommand::Velocity, 600);
+    bus.advanceTo(50'000);
+    sendHeartbeat();
+    bus.advanceTo(100'000);
+
+    // 600 RPM for 0.1 s, less the time taken to receive the command
+    EXPECT_NEAR(1.0f, node.getPosition(), 0.01f);
+
+    // Status frame sent at 100 ms
+    bus.advanceTo(101'000);
+    EXPECT_NEAR(1.0f, readLastStatus(RevMotor::APICommand::Period2), 0.01f);
+}
+
+TEST_F(RevMotorSimNodeTest, motor_stops_once_heartbeat_times_out)
+{
+    sendHeartbeat();
+    send(RevMotor::APICommand::Velocity, 600);
+    bus.advanceTo(RevMotorSimNode::HEARTBEAT_TIMEOUT_US / 2);
+    EXPECT_FLOAT_EQ(600, node.getVelocity());
+
+    bus.advanceTo(RevMotorSimNode::HEARTBEAT_TIMEOUT_US * 2);
+
+    EXPECT_FALSE(node.isEnabled());
+    EXPECT_FLOAT_EQ(0, node.getVelocity());
+}
+
+TEST_F(RevMotorSimNodeTest, frames_for_other_devices_are_ignored)
+{
+    sendHeartbeat();
+    send(RevMotor::APICommand::DutyCycle, 0.5f, DEVICE_ID + 1);
+    bus.advanceTo(1'000);
+
+    EXPECT_FLOAT_EQ(0, node.getSetpoint());
+}